@@ -13,61 +13,104 @@
 #include <Arduino_GFX_Library.h>
 
 #include "secrets.h"
+#include "monitor_config.h"
 #include "fruit_profiles.h"
 #include "sensors.h"
 #include "freshness_model.h"
 #include "ui_manager.h"
+#include "scheduler.h"
+#include "buttons.h"
+#include "acquisition.h"
+#include "uplink_batch.h"
+#include "report_policy.h"
+#include "uplink_queue.h"
+#include "lora_transport.h"
+#include "flash_log.h"
+#include "session_store.h"
+#include "samd_nvm.h"
+#include "decision_rules.h"
+#include "trace_format.h"
+#include "heap_guard.h"          // 最后包含：之后的代码不能再用String/malloc
 
 // ==================== 配置选项 ====================
 #define TFT_TEST_MODE false  // TFT测试：true=测试，false=正常
 #define TFT_DRIVER 1         // 1=ILI9488, 2=ILI9341, 3=ST7796
+#define TFT_BUS 3            // 1=软件SPI, 2=硬件SPI, 3=硬件SPI+DMA
+#define TFT_COLOR_DEPTH 18   // ILI9488: 18=RGB666, 16=RGB565
 
 // ==================== 全局对象 ====================
 LoRaModem modem;
 Sensors sensors;
 FreshnessModel freshnessModel;
 UIManager ui;
+TaskScheduler scheduler;
+AcquisitionPipeline acquisition(sensors, freshnessModel);
 
 // ==================== 按钮配置 ====================
 #define BTN_SWITCH_FRUIT  0  // D0 - 黄色按钮
 #define BTN_CONFIRM       1  // D1 - 绿色按钮
 
-bool lastSwitchState = HIGH;
-bool lastConfirmState = HIGH;
-unsigned long lastDebounceTime = 0;
-const unsigned long DEBOUNCE_DELAY = 50;
-
-// 长按校准功能
-unsigned long greenButtonPressTime = 0;
-bool greenButtonLongPressHandled = false;
-const unsigned long LONG_PRESS_TIME = 3000;  // 3秒长按
+// 去抖和长按（3秒 = 重新校准）由ButtonInput在中断里处理
+unsigned long worstInputLatency = 0;  // 边沿到处理的最大延迟 (ms)
 
 // ==================== 系统状态 ====================
 FruitType currentFruit = FRUIT_BANANA;
 bool systemReady = false;
 bool inFruitTestMode = false;  // 🆕 水果测试模式标志
 
-unsigned long lastUploadTime = 0;
-const unsigned long UPLOAD_INTERVAL = 300000;  // 5分钟
+// ==================== 调度任务 ====================
+// 周期见monitor_config.h
+int buttonTaskId = -1;
+int sampleTaskId = -1;
+int renderTaskId = -1;
+int uplinkTaskId = -1;
+int radioTaskId = -1;
+int backfillTaskId = -1;
+int sessionTaskId = -1;
+int consoleTaskId = -1;
+
+// 采样由acquisition统一完成，各模块订阅快照
+bool latestEnvBad = false;      // 显示订阅者算出的环境判断
+bool renderPending = false;
+bool fruitTestPending = false;  // 等待下一次快照做水果测试
+bool traceCapture = false;      // 串口输出紧凑记录（'c'切换）
 
-unsigned long lastDisplayUpdate = 0;
-const unsigned long DISPLAY_UPDATE_INTERVAL = 2000;  // 2秒
+UplinkBatch uplinkBatch;        // 每分钟一个样本，上传时打包成一帧
+uint8_t uplinkFrame[BATCH_MAX_FRAME];
+ReportPolicy reportPolicy;      // 没变化就不发，报警时优先上传
+LoRaTransport loraTransport(SerialLoRa);
+UplinkQueue uplinkQueue(loraTransport);  // 上传任务只排队，无线任务负责发送和重试
+int uplinkDataRate = 0;         // 打包时用的数据速率（发送期间不查询modem）
+bool loraJoined = false;        // 没入网时样本直接存进flash
 
-// ==================== 🆕 根据你的环境调整的阈值 ====================
-// v3.5更新：根据你的实际环境条件(28.8°C, 48.7%)调整阈值
-// 你的环境Score约40.5，原45.0阈值太严格
+// 断网时的样本日志（flash），网络恢复后从最旧的开始补发
+#define BACKFILL_TAG  1         // 队列里补发帧的标记
+SamdNvmStorage nvmStorage(NVM_AREA_LOG);
+FlashLog flashLog(nvmStorage);
+UplinkBatch backfillBatch;
+BatchSample logSamples[BATCH_CAPACITY];   // 存日志和补发时共用
+int backfillSamples = 0;        // 正在发的补发帧里的样本数（0=没有）
 
-// 香蕉测试阈值（适中）- 用于测试单个水果
-const int BANANA_GAS_TEST_THRESHOLD = 10;      // Gas Delta阈值
-const float BANANA_SCORE_TEST_THRESHOLD = 38.0; // 🆕 降低！从45.0改为38.0
+// LoRaWAN会话（flash）：上电时恢复，不用每次都入网
+SamdNvmStorage sessionStorage(NVM_AREA_SESSION);
+SessionStore sessionStore(sessionStorage);
+bool sessionRestored = false;   // 当前会话是从flash恢复的，还没收到过ACK
+bool firstUplinkPending = false; // 恢复会话后第一个有效样本马上上传，不等上传周期
+unsigned long sessionStart = 0; // 入网/恢复的时刻
+unsigned long rejoinWait = SESSION_REJOIN_MIN;
+unsigned long nextRejoinTime = 0;
+bool screenTransition = false;  // 画面切换/提示期间暂停渲染
 
-// 橘子测试阈值（适中）
-const int ORANGE_GAS_TEST_THRESHOLD = 15;      
-const float ORANGE_SCORE_TEST_THRESHOLD = 45.0; // 🆕 降低！从50.0改为45.0
+// 启动流程和校准流程的进度
+int calibrationStep = 0;
+int joinAttempts = 0;
+bool recalibrating = false;
+int recalibrationStep = 0;
+int recalibrationOldBaseline = 0;
 
-// 环境判断阈值（宽松）- 用于环境监测
-const int ENV_GAS_SPIKE_THRESHOLD = 30;        // 降低！原50
-const float ENV_SCORE_THRESHOLD = 30.0;
+// ==================== 判断阈值 ====================
+// 阈值和判断逻辑见decision_rules.h
+DecisionRules decisionRules;
 
 // ==================== Setup ====================
 void setup() {
@@ -83,9 +126,8 @@ void setup() {
   Serial.println("        MOSI=8, SCK=9, MISO=10");
   Serial.println("========================================\n");
   
-  // 1. 按钮
-  pinMode(BTN_SWITCH_FRUIT, INPUT_PULLUP);
-  pinMode(BTN_CONFIRM, INPUT_PULLUP);
+  // 1. 按钮（外部中断）
+  ButtonInput::begin(BTN_SWITCH_FRUIT, BTN_CONFIRM);
   Serial.println("1. Buttons initialized");
   
   // 2. TFT
@@ -100,63 +142,140 @@ void setup() {
   #endif
   
   ui.showBootScreen();
-  delay(2000);
   
   // 3. 传感器
   Serial.println("3. Initializing sensors...");
   sensors.begin();
   
-  // 4. 气体校准
-  Serial.println("4. Calibrating gas sensor (10s)...");
-  ui.showCalibrationScreen();
-  
-  for (int i = 0; i < 10; i++) {
-    sensors.calibrateGasSensor();
-    ui.updateCalibrationProgress((i + 1) * 10);
-    delay(1000);
+  // 断网日志（flash）
+  flashLog.begin();
+  Serial.print("   Flash log: boot ");
+  Serial.print(flashLog.getBoot());
+  Serial.print(", ");
+  Serial.print(flashLog.getPendingSamples());
+  Serial.println(" samples to backfill");
+  Serial.print("   LoRaWAN session: ");
+  Serial.println(sessionStore.begin() ? "saved" : "none");
+  
+  // 调度任务：启动完成前只有按钮和串口任务在跑
+  buttonTaskId = scheduler.addTask("buttons", handleButtons, BUTTON_POLL_INTERVAL);
+  sampleTaskId = scheduler.addTask("sample", sampleTask, DISPLAY_UPDATE_INTERVAL);
+  renderTaskId = scheduler.addTask("render", renderTask, RENDER_INTERVAL);
+  uplinkTaskId = scheduler.addTask("uplink", uploadLoRaData, UPLOAD_INTERVAL);
+  radioTaskId = scheduler.addTask("radio", radioTask, UPLINK_POLL_INTERVAL);
+  backfillTaskId = scheduler.addTask("backfill", backfillTask, BACKFILL_INTERVAL);
+  sessionTaskId = scheduler.addTask("session", sessionTask, SESSION_CHECK_INTERVAL);
+  consoleTaskId = scheduler.addTask("console", consoleTask, CONSOLE_INTERVAL);
+  
+  // 任务表满了（SCHED_MAX_TASKS太小）：没注册上的任务永远不会运行，停在错误画面
+  if (buttonTaskId < 0 || sampleTaskId < 0 || renderTaskId < 0 || uplinkTaskId < 0 ||
+      radioTaskId < 0 || backfillTaskId < 0 || sessionTaskId < 0 || consoleTaskId < 0) {
+    Serial.println("Task table full, raise SCHED_MAX_TASKS");
+    ui.showErrorScreen("Task Table Full");
+    return;
   }
-  
-  int baseline = sensors.getGasBaseline();
-  Serial.print("   Gas Baseline: ");
-  Serial.print(baseline);
-  Serial.println(" ADC");
-  
-  // 5. LoRa
-  Serial.println("5. Initializing LoRaWAN...");
-  ui.showLoRaJoiningScreen();
-  
+  scheduler.setEnabled(sampleTaskId, false);
+  scheduler.setEnabled(uplinkTaskId, false);
+  scheduler.setEnabled(radioTaskId, false);
+  scheduler.setEnabled(backfillTaskId, false);
+  scheduler.setEnabled(sessionTaskId, false);
+  
+  // 快照订阅者（按顺序调用：先显示判断，再日志，再上传编码和水果测试）
+  acquisition.subscribe(onSnapshotDisplay);
+  acquisition.subscribe(onSnapshotLog);
+  acquisition.subscribe(onSnapshotCapture);
+  acquisition.subscribe(onSnapshotUplink);
+  acquisition.subscribe(onSnapshotFruitTest);
+  
+  // 4. LoRa模块：有保存的会话就在这里恢复（几条AT命令），不等启动画面和校准
+  Serial.println("4. Initializing LoRaWAN...");
   if (!modem.begin(EU868)) {
     Serial.println("   LoRa init failed!");
     ui.showErrorScreen("LoRa Failed");
-    while (1);
+    return;  // 停在错误画面
   }
   
   Serial.print("   Device EUI: ");
   Serial.println(modem.deviceEUI());
+  restoreSession();
   
-  int attempts = 0;
-  bool connected = false;
+  // 之后的启动步骤由延时事件串联，loop()从不阻塞
+  scheduler.postDelayed(startCalibration, 2000);
+}
+
+// ==================== Loop ====================
+void loop() {
+  scheduler.run();
+}
+
+// ==================== 启动流程 ====================
+
+// 5. 气体校准（每秒一次，共10次）
+void startCalibration() {
+  Serial.println("5. Calibrating gas sensor (10s)...");
+  ui.showCalibrationScreen();
   
-  while (!connected && attempts < 3) {
-    attempts++;
-    Serial.print("   Join attempt ");
-    Serial.print(attempts);
-    Serial.println("/3...");
-    
-    connected = modem.joinOTAA(TTN_APP_EUI, TTN_APP_KEY);
-    
-    if (!connected) {
-      delay(5000);
-    }
+  calibrationStep = 0;
+  scheduler.postDelayed(calibrationTick, 0);
+}
+
+void calibrationTick() {
+  sensors.calibrateGasSensor();
+  calibrationStep++;
+  ui.updateCalibrationProgress(calibrationStep * 10);
+  
+  if (calibrationStep < 10) {
+    scheduler.postDelayed(calibrationTick, 1000);
+  } else {
+    scheduler.postDelayed(startJoin, 1000);
+  }
+}
+
+// 6. 入网：setup()里已经恢复了会话就直接进入监测
+void startJoin() {
+  int baseline = sensors.getGasBaseline();
+  Serial.print("   Gas Baseline: ");
+  Serial.print(baseline);
+  Serial.println(" ADC");
+  
+  if (loraJoined) {
+    finishBoot();
+    return;
   }
   
+  Serial.println("6. Joining TTN...");
+  ui.showLoRaJoiningScreen();
+  joinAttempts = 0;
+  scheduler.postDelayed(joinAttempt, 0);
+}
+
+// 每次入网尝试之间间隔5秒（joinOTAA本身仍会阻塞到入网结果返回）
+void joinAttempt() {
+  joinAttempts++;
+  Serial.print("   Join attempt ");
+  Serial.print(joinAttempts);
+  Serial.println("/3...");
+  
+  bool connected = modem.joinOTAA(TTN_APP_EUI, TTN_APP_KEY);
+  
   if (connected) {
     Serial.println("   ✅ Joined TTN!");
+    loraJoined = true;
+    sessionStart = millis();
+    saveSession();
+  } else if (joinAttempts < 3) {
+    scheduler.postDelayed(joinAttempt, 5000);
+    return;
   } else {
-    Serial.println("   ⚠️ Offline mode");
+    Serial.println("   ⚠️ Offline mode (samples go to flash)");
+    nextRejoinTime = millis() + rejoinWait;
   }
   
-  // 6. 模型初始化
+  finishBoot();
+}
+
+// 7. 模型初始化，进入环境监测
+void finishBoot() {
   freshnessModel.setFruitType(currentFruit);
   
   Serial.println("\n========================================");
@@ -164,131 +283,168 @@ void setup() {
   Serial.println("========================================");
   Serial.println("🌍 Mode: Environment Monitoring");
   Serial.println("   - Shows: Env suitable for storage");
-  Serial.println("   - Yellow: Switch fruit (🍌 ↔ 🍊)");
+  Serial.println("   - Yellow: Switch fruit (🍌 → 🍊 → 🍎 → 🍇)");
+  Serial.println("   - Hold Yellow 3s: New fruit (reset shelf life)");
   Serial.println("   - Green: Enter Fruit Test Mode");
+  Serial.println("   - Serial 't': task latency, uplink + heap stats");
+  Serial.println("   - Serial 'b': model cycle counts");
+  Serial.println("   - Serial 'c': compact trace capture");
   Serial.println("========================================");
+  const DecisionThresholds& thresholds = decisionRules.getThresholds();
   Serial.println("📊 Adjusted Thresholds:");
   Serial.print("   Banana Test: GasΔ>");
-  Serial.print(BANANA_GAS_TEST_THRESHOLD);
+  Serial.print(thresholds.bananaGasTest);
   Serial.print(" OR Score<");
-  Serial.println(BANANA_SCORE_TEST_THRESHOLD);
+  Serial.println(thresholds.bananaScoreTest);
   Serial.print("   Orange Test: GasΔ>");
-  Serial.print(ORANGE_GAS_TEST_THRESHOLD);
+  Serial.print(thresholds.orangeGasTest);
   Serial.print(" OR Score<");
-  Serial.println(ORANGE_SCORE_TEST_THRESHOLD);
+  Serial.println(thresholds.orangeScoreTest);
   Serial.println("========================================\n");
   
+  // 第一次采样在一个采样周期之后，那时这次转换早已完成
+  sensors.startReading();
+  
   systemReady = true;
+  HeapGuard::seal();    // 启动和入网都完成了，之后堆不应再增长
+  scheduler.setEnabled(sampleTaskId, true);
+  scheduler.setEnabled(uplinkTaskId, true);
+  scheduler.setEnabled(radioTaskId, true);
+  scheduler.setEnabled(backfillTaskId, true);
+  scheduler.setEnabled(sessionTaskId, true);
   
   // 显示环境监测界面
   ui.showMonitoringScreen(currentFruit);
-  delay(500);
-  updateSensorReadings();
+  screenTransition = true;
+  scheduler.postDelayed(finishTransition, 500);
   
   Serial.println("✅ Display initialized!\n");
 }
 
-// ==================== Loop ====================
-void loop() {
-  if (!systemReady) return;
-  
-  // 处理按钮
-  handleButtons();
-  
-  // 🌍 环境监测模式：自动刷新和上传
-  if (!inFruitTestMode) {
-    unsigned long currentTime = millis();
-    
-    // 每2秒更新显示
-    if (currentTime - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL) {
-      updateSensorReadings();
-      lastDisplayUpdate = currentTime;
-    }
+// ==================== 画面切换 ====================
+
+// 显示提示画面，delayMs后回到环境监测界面
+void returnToMonitoringAfter(unsigned long delayMs) {
+  cancelTransition();
+  screenTransition = true;
+  scheduler.postDelayed(returnToMonitoring, delayMs);
+}
+
+void returnToMonitoring() {
+  ui.showMonitoringScreen(currentFruit);
+  scheduler.postDelayed(finishTransition, 500);
+}
+
+// 画面就绪：用缓存的采样数据立即刷新，不额外读传感器
+void finishTransition() {
+  screenTransition = false;
+  acquisition.refresh();
+}
+
+void cancelTransition() {
+  scheduler.cancel(returnToMonitoring);
+  scheduler.cancel(finishTransition);
+  screenTransition = false;
+}
+
+// ==================== 串口命令 ====================
+void consoleTask() {
+  while (Serial.available()) {
+    char c = Serial.read();
     
-    // 每5分钟上传
-    if (currentTime - lastUploadTime >= UPLOAD_INTERVAL) {
-      uploadLoRaData();
-      lastUploadTime = currentTime;
+    if (c == 't') {
+      scheduler.printStats();
+      Serial.print("Input latency (worst): ");
+      Serial.print(worstInputLatency);
+      Serial.print(" ms, dropped events: ");
+      Serial.println(ButtonInput::getDroppedEvents());
+      Serial.print("Sensor reads: ");
+      Serial.print(acquisition.getSensorReads());
+      Serial.print(", DHT22 failures: ");
+      Serial.println(sensors.getDHTFailures());
+      reportPolicy.printStats();
+      uplinkQueue.printStats();
+      flashLog.printStats();
+      sessionStore.printStats();
+      HeapGuard::printStats();
+    } else if (c == 'c') {
+      traceCapture = !traceCapture;
+      Serial.println(traceCapture ? "Trace capture ON" : "Trace capture OFF");
+    } else if (c == 'b') {
+      freshnessModel.benchmark();
+    } else if (c == 'r') {
+      scheduler.resetStats();
+      worstInputLatency = 0;
+      Serial.println("Scheduler stats reset");
     }
   }
-  // 🧪 水果测试模式：不自动刷新，只响应按钮
 }
 
 // ==================== 按钮处理 ====================
 void handleButtons() {
-  unsigned long currentTime = millis();
+  ButtonEvent event;
   
-  bool switchState = digitalRead(BTN_SWITCH_FRUIT);
-  bool confirmState = digitalRead(BTN_CONFIRM);
-  
-  // 🔄 检测绿色按钮长按（环境模式下）
-  if (!inFruitTestMode && confirmState == LOW) {
-    if (greenButtonPressTime == 0) {
-      greenButtonPressTime = currentTime;
-      greenButtonLongPressHandled = false;
-    }
+  while (ButtonInput::poll(event)) {
+    // 启动和校准期间的按键直接丢弃
+    if (!systemReady || recalibrating) continue;
     
-    // 长按3秒 = 重新校准baseline
-    if (!greenButtonLongPressHandled && 
-        (currentTime - greenButtonPressTime) >= LONG_PRESS_TIME) {
-      
-      Serial.println("\n>>> 🔵 LONG PRESS: Recalibrating Baseline <<<\n");
-      recalibrateGasSensor();
-      greenButtonLongPressHandled = true;
-      return;  // 不处理短按
-    }
-  } else if (confirmState == HIGH && greenButtonPressTime != 0) {
-    // 按钮释放
-    unsigned long pressDuration = currentTime - greenButtonPressTime;
-    greenButtonPressTime = 0;
+    unsigned long latency = millis() - event.time;
+    if (latency > worstInputLatency) worstInputLatency = latency;
     
-    // 如果是短按（<3秒）且已处理过长按，则忽略
-    if (greenButtonLongPressHandled) {
-      greenButtonLongPressHandled = false;
-      lastConfirmState = confirmState;
-      return;
+    if (event.button == BUTTON_YELLOW) {
+      handleYellowButton(event);
+    } else {
+      handleGreenButton(event);
     }
   }
-  
-  // 防抖
-  if ((switchState != lastSwitchState || confirmState != lastConfirmState) &&
-      (currentTime - lastDebounceTime) > DEBOUNCE_DELAY) {
-    
-    lastDebounceTime = currentTime;
-    
-    // 🟡 黄色按钮
-    if (switchState == LOW && lastSwitchState == HIGH) {
+}
+
+// 🟡 黄色按钮：测试模式按下即退出；环境模式短按松开切换水果，长按3秒放入新水果
+void handleYellowButton(const ButtonEvent& event) {
+  if (inFruitTestMode) {
+    if (event.type == BUTTON_PRESS) {
       Serial.println("\n>>> 🟡 YELLOW BUTTON <<<");
-      
-      if (inFruitTestMode) {
-        // 🧪 测试模式：退出测试
-        exitFruitTestMode();
-      } else {
-        // 🌍 环境模式：切换水果
-        switchFruit();
-      }
+      // 🧪 测试模式：退出测试
+      exitFruitTestMode();
     }
-    
-    // 🟢 绿色按钮（短按）
-    if (confirmState == LOW && lastConfirmState == HIGH && !greenButtonLongPressHandled) {
+    return;
+  }
+  
+  if (event.type == BUTTON_LONG_PRESS) {
+    Serial.println("\n>>> 🟡 LONG PRESS: New Fruit <<<");
+    startNewFruit();
+  } else if (event.type == BUTTON_RELEASE && event.duration < BUTTON_LONG_PRESS_MS) {
+    Serial.println("\n>>> 🟡 YELLOW BUTTON <<<");
+    // 🌍 环境模式：切换水果
+    switchFruit();
+  }
+}
+
+// 🟢 绿色按钮：测试模式按下即重测；环境模式短按松开进入测试，长按3秒重新校准
+void handleGreenButton(const ButtonEvent& event) {
+  if (inFruitTestMode) {
+    if (event.type == BUTTON_PRESS) {
       Serial.println("\n>>> 🟢 GREEN BUTTON <<<");
-      
-      if (inFruitTestMode) {
-        // 🧪 测试模式：重新测试
-        runFruitTest();
-      } else {
-        // 🌍 环境模式：进入测试
-        enterFruitTestMode();
-      }
+      // 🧪 测试模式：重新测试
+      runFruitTest();
     }
+    return;
   }
   
-  lastSwitchState = switchState;
-  lastConfirmState = confirmState;
+  if (event.type == BUTTON_LONG_PRESS) {
+    Serial.println("\n>>> 🔵 LONG PRESS: Recalibrating Baseline <<<\n");
+    recalibrateGasSensor();
+  } else if (event.type == BUTTON_RELEASE && event.duration < BUTTON_LONG_PRESS_MS) {
+    Serial.println("\n>>> 🟢 GREEN BUTTON <<<");
+    // 🌍 环境模式：进入测试
+    enterFruitTestMode();
+  }
 }
 
 // ==================== 🔵 重新校准Baseline ====================
 void recalibrateGasSensor() {
+  recalibrating = true;
+  screenTransition = true;
   ui.showCalibrationScreen();
   
   Serial.println("╔═══════════════════════════════════╗");
@@ -301,22 +457,33 @@ void recalibrateGasSensor() {
   Serial.println("║ Calibrating... (5 samples)        ║");
   Serial.println("╚═══════════════════════════════════╝\n");
   
-  int oldBaseline = sensors.getGasBaseline();
+  recalibrationOldBaseline = sensors.getGasBaseline();
   
-  // 重新校准（5次取平均）
-  for (int i = 0; i < 5; i++) {
-    sensors.calibrateGasSensor();
-    
-    // 读取当前值显示
-    SensorData data = sensors.readSensors();
-    Serial.print("  Sample ");
-    Serial.print(i + 1);
-    Serial.print("/5: ");
-    Serial.print(data.gasRaw);
-    Serial.println(" ADC");
-    delay(200);
-  }
+  // 重新校准（5次取平均，间隔200ms）
+  recalibrationStep = 0;
+  scheduler.postDelayed(recalibrationTick, 0);
+}
+
+void recalibrationTick() {
+  int reading = sensors.calibrateGasSensor();
+  recalibrationStep++;
+  
+  // 显示本次校准读数
+  Serial.print("  Sample ");
+  Serial.print(recalibrationStep);
+  Serial.print("/5: ");
+  Serial.print(reading);
+  Serial.println(" ADC");
   
+  if (recalibrationStep < 5) {
+    scheduler.postDelayed(recalibrationTick, 200);
+  } else {
+    scheduler.postDelayed(finishRecalibration, 200);
+  }
+}
+
+void finishRecalibration() {
+  int oldBaseline = recalibrationOldBaseline;
   int newBaseline = sensors.getGasBaseline();
   
   Serial.println("\n╔═══════════════════════════════════╗");
@@ -336,35 +503,44 @@ void recalibrateGasSensor() {
   Serial.println(" ADC");
   Serial.println("╚═══════════════════════════════════╝\n");
   
-  delay(2000);
+  recalibrating = false;
   
-  // 回到环境监测
-  ui.showMonitoringScreen(currentFruit);
-  delay(500);
-  updateSensorReadings();
+  // 2秒后回到环境监测
+  returnToMonitoringAfter(2000);
 }
 
 // ==================== 🟡 切换水果（环境模式）====================
 void switchFruit() {
-  currentFruit = (FruitType)((currentFruit + 1) % 2);
+  currentFruit = (FruitType)((currentFruit + 1) % FRUIT_COUNT);
   
-  String fruitName = FruitDatabase::getTypeName(currentFruit);
-  String fruitEmoji = FruitDatabase::getEmoji(currentFruit);
+  const char* fruitName = FruitDatabase::getTypeName(currentFruit);
+  const char* fruitEmoji = FruitDatabase::getEmoji(currentFruit);
   
   Serial.print("Switched to: ");
   Serial.print(fruitEmoji);
   Serial.print(" ");
   Serial.println(fruitName);
   
+  // 每种水果每次采样都在算，这里只切换显示，不重置任何状态
   freshnessModel.setFruitType(currentFruit);
   
   ui.showFruitSwitchAnimation(currentFruit);
-  delay(1000);
   
-  ui.showMonitoringScreen(currentFruit);
-  delay(500);
+  // 动画显示1秒后回到监测界面
+  returnToMonitoringAfter(1000);
+}
+
+// ==================== 🟡 放入新水果（环境模式）====================
+// 切换水果不会清零已用寿命，换了一批水果时长按黄色按钮重新开始
+void startNewFruit() {
+  freshnessModel.startNewFruit();
+  acquisition.restartTrend();
+  
+  Serial.print("New ");
+  Serial.print(FruitDatabase::getTypeName(currentFruit));
+  Serial.println(": shelf life restarted");
   
-  updateSensorReadings();
+  acquisition.refresh();
 }
 
 // ==================== 🟢 进入水果测试模式 ====================
@@ -376,68 +552,54 @@ void enterFruitTestMode() {
   Serial.println("Testing if THIS fruit is safe to eat");
   Serial.println("═══════════════════════════════════════\n");
   
+  cancelTransition();
   inFruitTestMode = true;
   
   runFruitTest();
 }
 
 // ==================== 🧪 运行水果测试 ====================
+// 把下一次采样提前到现在，结果由onSnapshotFruitTest处理
 void runFruitTest() {
   Serial.println("\n--- 🧪 Running Fruit Test ---");
   
-  // 读传感器
-  SensorData data = sensors.readSensors();
-  
-  if (!data.valid) {
-    Serial.println("❌ Sensor read failed!");
-    return;
-  }
-  
-  // 更新模型
-  freshnessModel.updateReadings(data.temperature, data.humidity, data.gasDelta);
-  float score = freshnessModel.getScore();
+  fruitTestPending = true;
+  scheduler.triggerNow(sampleTaskId);
+}
+
+void onSnapshotFruitTest(const Snapshot& snapshot) {
+  if (!fruitTestPending) return;
+  fruitTestPending = false;
   
   // 评估：这个水果能不能吃
-  bool isSpoiled = evaluateFruitTest(currentFruit, data.gasDelta, score);
+  bool isSpoiled = evaluateFruitTest(snapshot.fruit, snapshot.data.gasDelta, snapshot.score);
   
   // 打印结果
-  printFruitTestResult(data, score, isSpoiled);
+  printFruitTestResult(snapshot.data, snapshot.score, isSpoiled);
   
   // 显示结果
-  ui.showFruitTestResult(currentFruit, isSpoiled);
+  ui.showFruitTestResult(snapshot.fruit, isSpoiled);
 }
 
 // ==================== 评估水果测试 ====================
 bool evaluateFruitTest(FruitType fruit, int gasDelta, float score) {
-  int gasThreshold;
-  float scoreThreshold;
-  
-  if (fruit == FRUIT_BANANA) {
-    gasThreshold = BANANA_GAS_TEST_THRESHOLD;
-    scoreThreshold = BANANA_SCORE_TEST_THRESHOLD;
-  } else {  // FRUIT_ORANGE
-    gasThreshold = ORANGE_GAS_TEST_THRESHOLD;
-    scoreThreshold = ORANGE_SCORE_TEST_THRESHOLD;
-  }
-  
-  bool gasBad = (gasDelta > gasThreshold);
-  bool scoreBad = (score < scoreThreshold);
+  FruitTestDecision decision = decisionRules.evaluateFruitTest(fruit, gasDelta, score);
   
   Serial.print("   Gas Delta: ");
   Serial.print(gasDelta);
   Serial.print(" (threshold: >");
-  Serial.print(gasThreshold);
+  Serial.print(decision.gasThreshold);
   Serial.print(") ");
-  Serial.println(gasBad ? "❌ HIGH" : "✅ OK");
+  Serial.println(decision.gasBad ? "❌ HIGH" : "✅ OK");
   
   Serial.print("   Score: ");
   Serial.print(score, 1);
   Serial.print(" (threshold: >");
-  Serial.print(scoreThreshold, 1);
+  Serial.print(decision.scoreThreshold, 1);
   Serial.print(") ");
-  Serial.println(scoreBad ? "❌ LOW" : "✅ OK");
+  Serial.println(decision.scoreBad ? "❌ LOW" : "✅ OK");
   
-  return (gasBad || scoreBad);
+  return decision.spoiled;
 }
 
 // ==================== 打印测试结果 ====================
@@ -489,55 +651,75 @@ void exitFruitTestMode() {
   Serial.println("═══════════════════════════════════════\n");
   
   inFruitTestMode = false;
+  fruitTestPending = false;
   
-  // 显示返回提示（不强制等待）
+  // 显示返回提示2秒，再回到环境监测
   ui.showReturnPrompt();
-  delay(2000);  // 显示2秒提示
-  
-  // 直接回到环境监测
-  ui.showMonitoringScreen(currentFruit);
-  delay(500);
-  updateSensorReadings();
+  returnToMonitoringAfter(2000);
 }
 
-// ==================== 🌍 更新环境监测数据 ====================
-void updateSensorReadings() {
-  SensorData data = sensors.readSensors();
+// ==================== 🌍 采样任务 ====================
+// 固定节拍采样，唯一读取传感器的地方
+void sampleTask() {
+  if (acquisition.acquire()) return;
   
-  if (!data.valid) {
+  if (fruitTestPending) {
+    fruitTestPending = false;
+    Serial.println("❌ Sensor read failed!");
+  } else {
     Serial.println("Sensor read failed!");
-    return;
   }
+}
+
+// 显示订阅者：环境判断（宽松阈值），结果交给渲染任务
+void onSnapshotDisplay(const Snapshot& snapshot) {
+  // 🧪 水果测试模式：不自动刷新，只响应按钮
+  if (inFruitTestMode) return;
   
-  freshnessModel.updateReadings(data.temperature, data.humidity, data.gasDelta);
-  
-  float score = freshnessModel.getScore();
-  int remainDays = freshnessModel.getRemainingDays();
-  FreshnessStage stage = freshnessModel.getStage();
-  int storageQuality = freshnessModel.calculateStorageScore(data.temperature, data.humidity);
+  latestEnvBad = decisionRules.checkEnvironmentSpoilage(snapshot.data.gasDelta, snapshot.score);
+  renderPending = true;
+}
+
+// 日志订阅者
+void onSnapshotLog(const Snapshot& snapshot) {
+  if (inFruitTestMode || traceCapture) return;
   
-  // 环境判断（宽松阈值）
-  bool envBad = checkEnvironmentSpoilage(data.gasDelta, score);
+  printMonitoringData(snapshot.data, snapshot.score, snapshot.remainDays,
+                      snapshot.lifeUsedPermille, snapshot.spoil, snapshot.stage,
+                      snapshot.storageQuality, latestEnvBad);
+}
+
+// 记录订阅者：每个快照一行，主机trace_replay可以读回
+void onSnapshotCapture(const Snapshot& snapshot) {
+  if (!traceCapture) return;
   
-  printMonitoringData(data, score, remainDays, stage, storageQuality, envBad);
+  char line[TRACE_LINE_SIZE];
+  TraceFormat::write(snapshot, line, sizeof(line));
+  Serial.println(line);
+}
+
+// ==================== 🖥 渲染任务 ====================
+void renderTask() {
+  if (!renderPending || screenTransition || inFruitTestMode) return;
+  renderPending = false;
   
-  ui.updateMonitoringData(currentFruit, &data, score, remainDays, stage, storageQuality);
+  const Snapshot& latest = acquisition.latest();
+  ui.updateMonitoringData(latest.fruit, &latest.data, latest.score, latest.remainDays,
+                          latest.stage, latest.storageQuality, latest.spoil);
   
-  if (envBad) {
+  if (latestEnvBad) {
     ui.showSpoilageWarning();
+  } else {
+    ui.clearSpoilageWarning();
   }
-}
-
-// ==================== 环境变坏判断（宽松）====================
-bool checkEnvironmentSpoilage(int gasDelta, float score) {
-  bool gasSpike = (gasDelta > ENV_GAS_SPIKE_THRESHOLD);
-  bool lowScore = (score < ENV_SCORE_THRESHOLD);
   
-  return (gasSpike || lowScore);
+  Serial.print("TFT pixels pushed: ");
+  Serial.println(ui.getLastUpdatePixels());
 }
 
 // ==================== 打印环境监测数据 ====================
 void printMonitoringData(const SensorData& data, float score, int remainDays,
+                         uint16_t lifeUsedPermille, const SpoilProjection& spoil,
                          FreshnessStage stage, int storageQuality, bool envBad) {
   Serial.println("\n┌─────────────────────────────────────┐");
   Serial.print("│ 🌍 Env Monitor: ");
@@ -556,7 +738,11 @@ void printMonitoringData(const SensorData& data, float score, int remainDays,
   
   Serial.print("│ Gas Raw:  ");
   Serial.print(data.gasRaw);
-  Serial.println(" ADC");
+  Serial.print(" ADC (");
+  Serial.print(data.gasMin);
+  Serial.print("-");
+  Serial.print(data.gasMax);
+  Serial.println(")");
   
   Serial.print("│ Gas Base: ");
   Serial.print(data.gasBaseline);
@@ -589,6 +775,24 @@ void printMonitoringData(const SensorData& data, float score, int remainDays,
     Serial.println("Expired");
   }
   
+  Serial.print("│ Life used: ");
+  Serial.print(lifeUsedPermille / 10);
+  Serial.print(".");
+  Serial.print(lifeUsedPermille % 10);
+  Serial.println(" %");
+  
+  Serial.print("│ Spoil in: ");
+  if (spoil.hours == TREND_NO_PROJECTION) {
+    Serial.println("-- (not falling)");
+  } else {
+    Serial.print(spoil.hours);
+    Serial.print(" h (");
+    Serial.print(spoil.lowHours);
+    Serial.print("-");
+    Serial.print(spoil.highHours);
+    Serial.println(" h)");
+  }
+  
   Serial.print("│ Storage:  ");
   Serial.print(storageQuality);
   Serial.println(" / 100");
@@ -607,58 +811,330 @@ void printMonitoringData(const SensorData& data, float score, int remainDays,
   Serial.println("└─────────────────────────────────────┘\n");
 }
 
+// ==================== 上传编码订阅者 ====================
+// 每分钟取一个样本放进上传缓冲，并检查有没有超出死区
+void onSnapshotUplink(const Snapshot& snapshot) {
+  // 测试模式的数据是单个水果的，不上传
+  if (inFruitTestMode) return;
+  
+  uplinkBatch.add(snapshot);
+  
+  // 恢复的会话：第一帧不等5分钟的上传周期，同时尽早确认会话还有效
+  if (firstUplinkPending && snapshot.data.valid) {
+    firstUplinkPending = false;
+    scheduler.triggerNow(uplinkTaskId);
+  }
+  
+  // 报警刚出现：不等上传周期，马上发一帧（显示订阅者已经算好了latestEnvBad）
+  if (reportPolicy.observe(snapshot, latestEnvBad, millis())) {
+    scheduler.postDelayed(priorityUplink, 0);
+  }
+}
+
 // ==================== 上传LoRa数据 ====================
+// 周期任务：没变化就不发，超过最长静默时间发心跳
 void uploadLoRaData() {
-  Serial.println("\nUploading to TTN...");
-  
-  SensorData data = sensors.readSensors();
-  if (!data.valid) {
-    Serial.println("Invalid data, skip");
+  if (inFruitTestMode) return;
+  
+  ReportReason reason = reportPolicy.decide(millis());
+  if (reason == REPORT_NONE) {
+    reportPolicy.suppressed();
+    int dropped = uplinkBatch.discard();
+    Serial.print("No change, skip upload (");
+    Serial.print(dropped);
+    Serial.println(" samples dropped)");
     return;
   }
   
-  freshnessModel.updateReadings(data.temperature, data.humidity, data.gasDelta);
+  sendUplink(reason);
+}
+
+// 报警的优先上传（延时事件）
+void priorityUplink() {
+  if (inFruitTestMode) return;
   
-  uint8_t payload[13];
+  // 周期任务可能刚好已经发过了
+  if (reportPolicy.decide(millis()) != REPORT_ALARM) return;
   
-  payload[0] = (uint8_t)currentFruit;
+  sendUplink(REPORT_ALARM);
+}
+
+void sendUplink(ReportReason reason) {
+  Serial.print("\nUploading to TTN (");
+  Serial.print(ReportPolicy::reasonName(reason));
+  Serial.println(")...");
   
-  int16_t temp = (int16_t)(data.temperature * 100);
-  payload[1] = (temp >> 8) & 0xFF;
-  payload[2] = temp & 0xFF;
+  if (uplinkBatch.pending() == 0) {
+    Serial.println("No data yet, skip");
+    return;
+  }
   
-  uint16_t humid = (uint16_t)(data.humidity * 100);
-  payload[3] = (humid >> 8) & 0xFF;
-  payload[4] = humid & 0xFF;
+  // 没入网，或者队列满（网络一直不通）：存进flash，恢复后补发
+  if (!loraJoined || uplinkQueue.isFull()) {
+    int stored = persistBatch();
+    reportPolicy.sent(reason, millis());
+    Serial.print(loraJoined ? "Uplink queue full, " : "Offline, ");
+    Serial.print("stored ");
+    Serial.print(stored);
+    Serial.println(" samples in flash");
+    return;
+  }
   
-  payload[5] = (data.gasRaw >> 8) & 0xFF;
-  payload[6] = data.gasRaw & 0xFF;
+  // 按当前数据速率的最大载荷打包，放不下的样本留给下一帧；
+  // 模块正在发送时用上次查到的数据速率
+  if (!uplinkQueue.isBusy()) {
+    uplinkDataRate = modem.getDataRate();
+  }
+  uint8_t size = BATCH_PREFIX_SIZE +
+                 uplinkBatch.encode(uplinkFrame + BATCH_PREFIX_SIZE,
+                                    UplinkBatch::maxPayload(uplinkDataRate) - BATCH_PREFIX_SIZE);
+  int samples = uplinkBatch.getEncodedCount();
+  
+  // 报警帧要确认，其余按每N帧确认一次；恢复的会话收到ACK之前都要确认。
+  // 前缀（最后一个样本距今多少分钟）由队列在交给模块时写
+  uplinkQueue.push(BATCH_PORT, uplinkFrame, size, samples, reason == REPORT_ALARM || sessionRestored,
+                   0, 0, uplinkBatch.getEncodedLastMinute());
+  uplinkBatch.consume();
+  reportPolicy.sent(reason, millis());
+  
+  Serial.print("Queued ");
+  Serial.print(samples);
+  Serial.print(" samples in ");
+  Serial.print(size);
+  Serial.print(" bytes (");
+  Serial.print(uplinkQueue.size());
+  Serial.println(" in queue)");
+}
+
+// ==================== 📡 无线任务 ====================
+// 推进发送队列：只读模块已经回的字符，不等接收窗口
+void radioTask() {
+  UplinkEvent event = uplinkQueue.poll();
+  if (event == UPLINK_EVENT_NONE) return;
+  
+  const QueuedFrame& frame = uplinkQueue.lastFrame();
+  if (frame.tag == BACKFILL_TAG) {
+    handleBackfillEvent(event, frame);
+    return;
+  }
   
-  int16_t delta = (int16_t)data.gasDelta;
-  payload[7] = (delta >> 8) & 0xFF;
-  payload[8] = delta & 0xFF;
+  switch (event) {
+    case UPLINK_EVENT_SENT:
+    case UPLINK_EVENT_ACKED:
+      Serial.print("✅ Sent ");
+      Serial.print(frame.samples);
+      Serial.print(" samples in ");
+      Serial.print(frame.size);
+      Serial.println(event == UPLINK_EVENT_ACKED ? " bytes (acked)" : " bytes");
+      break;
+    case UPLINK_EVENT_RETRY:
+      Serial.print("⚠️ Uplink attempt ");
+      Serial.print(frame.attempts);
+      Serial.println(" failed, will retry");
+      return;
+    default:
+      // 发不出去的样本存进flash，网络恢复后补发
+      persistFrame(frame.data + BATCH_PREFIX_SIZE, frame.size - BATCH_PREFIX_SIZE);
+      Serial.print("❌ Uplink dropped after ");
+      Serial.print(frame.attempts);
+      Serial.print(" attempts, ");
+      Serial.print(frame.samples);
+      Serial.println(" samples stored in flash");
+      break;
+  }
   
-  payload[9] = (uint8_t)freshnessModel.getScore();
+  // 切换画面期间不覆盖提示画面
+  if (!screenTransition) {
+    ui.showUploadStatus(event != UPLINK_EVENT_DROPPED);
+  }
+}
+
+// ==================== 💾 断网日志 ====================
+// 把一帧里的样本存进flash
+int persistFrame(const uint8_t* frame, uint8_t size) {
+  BatchHeader header;
+  int n = UplinkBatch::decode(frame, size, header, logSamples, BATCH_CAPACITY);
+  if (n <= 0) return 0;
+  flashLog.append(header, logSamples, n);
+  return n;
+}
+
+// 把上传缓冲里的样本全部存进flash
+int persistBatch() {
+  int stored = 0;
+  while (uplinkBatch.pending() > 0) {
+    uint8_t size = uplinkBatch.encode(uplinkFrame, BATCH_MAX_FRAME);
+    stored += persistFrame(uplinkFrame, size);
+    uplinkBatch.consume();
+  }
+  return stored;
+}
+
+// 补发任务：网络正常、队列空闲时从日志里取最旧的样本打包一帧（确认帧）
+void backfillTask() {
+  if (!loraJoined || backfillSamples > 0 || uplinkQueue.size() > 0 ||
+      uplinkQueue.isLinkDown() || !flashLog.hasPending()) {
+    return;
+  }
   
-  int remainDays = freshnessModel.getRemainingDays();
-  payload[10] = (uint8_t)(remainDays < 0 ? 255 : remainDays);
+  BatchHeader status;
+  uint16_t recordBoot = 0;
+  int n = flashLog.read(status, recordBoot, logSamples, BATCH_CAPACITY);
+  if (n == 0) return;
   
-  payload[11] = (uint8_t)freshnessModel.getStage();
+  backfillBatch.clear();
+  backfillBatch.setStatus(status.fruit, status.stage, status.remainDays, status.spoil);
+  for (int i = 0; i < n; i++) {
+    backfillBatch.addSample(logSamples[i]);
+  }
   
-  unsigned long ageHours = millis() / 3600000;
-  payload[12] = (uint8_t)(ageHours > 255 ? 255 : ageHours);
+  uplinkDataRate = modem.getDataRate();
+  uint8_t maxBytes = UplinkBatch::maxPayload(uplinkDataRate) - BACKFILL_PREFIX_SIZE;
+  uint8_t size = backfillBatch.encode(uplinkFrame + BACKFILL_PREFIX_SIZE, maxBytes);
+  int samples = backfillBatch.getEncodedCount();
+  
+  // 前缀：启动编号，最后一个样本距今多少分钟（队列发送时写；更早的启动无法换算）
+  uplinkFrame[0] = recordBoot >> 8;
+  uplinkFrame[1] = recordBoot & 0xFF;
+  uplinkFrame[2] = 0xFF;
+  uplinkFrame[3] = 0xFF;
+  int8_t ageOffset = UPLINK_NO_AGE;
+  if (recordBoot == flashLog.getBoot()) {
+    ageOffset = BACKFILL_PREFIX_SIZE - BATCH_PREFIX_SIZE;
+  }
   
-  modem.beginPacket();
-  modem.write(payload, 13);
-  int err = modem.endPacket(true);
+  uplinkQueue.push(BACKFILL_PORT, uplinkFrame, size + BACKFILL_PREFIX_SIZE, samples, true, BACKFILL_TAG,
+                   ageOffset, logSamples[samples - 1].minute);
+  backfillSamples = samples;
+}
+
+// 补发帧送达才从日志里移除；丢掉的留在日志里，下次再补
+void handleBackfillEvent(UplinkEvent event, const QueuedFrame& frame) {
+  if (event == UPLINK_EVENT_RETRY) return;
   
-  if (err > 0) {
-    Serial.println("✅ Sent!");
+  if (event == UPLINK_EVENT_DROPPED) {
+    Serial.println("❌ Backfill frame dropped, will retry later");
   } else {
-    Serial.print("❌ Failed: ");
-    Serial.println(err);
+    flashLog.consume(backfillSamples);
+    Serial.print("✅ Backfilled ");
+    Serial.print(frame.samples);
+    Serial.print(" samples, ");
+    Serial.print(flashLog.getPendingSamples());
+    Serial.println(" left in flash");
+  }
+  backfillSamples = 0;
+}
+
+// ==================== 🔑 LoRaWAN会话 ====================
+// 用保存的会话按ABP方式激活（几条AT命令，不到1秒）
+bool restoreSession() {
+  LoRaSession session;
+  if (!sessionStore.load(session)) return false;
+  
+  // MKRWAN只能设16位的计数，截断后的计数网络服务器不认（MIC按32位算），
+  // 计数超过16位就重新入网，新会话从0开始
+  if (session.fcntUp > 0xFFFF || session.fcntDown > 0xFFFF) {
+    Serial.println("   Saved session counters exceed 16 bits, joining instead");
+    return false;
+  }
+  
+  char devAddr[9];
+  char nwkSKey[33];
+  char appSKey[33];
+  SessionStore::formatHex(session.devAddr, sizeof(session.devAddr), devAddr);
+  SessionStore::formatHex(session.nwkSKey, sizeof(session.nwkSKey), nwkSKey);
+  SessionStore::formatHex(session.appSKey, sizeof(session.appSKey), appSKey);
+  
+  if (!modem.joinABP(devAddr, nwkSKey, appSKey)) {
+    Serial.println("   Saved session rejected, joining instead");
+    return false;
+  }
+  // 从预留值开始计数，然后重新预留
+  modem.setFCU((uint16_t)session.fcntUp);
+  modem.setFCD((uint16_t)session.fcntDown);
+  sessionStore.save(session);
+  
+  loraJoined = true;
+  sessionRestored = true;
+  firstUplinkPending = true;
+  sessionStart = millis();
+  Serial.print("   ✅ Restored session ");
+  Serial.print(devAddr);
+  Serial.print(", FCntUp ");
+  Serial.println(session.fcntUp);
+  return true;
+}
+
+// 入网成功后保存会话
+void saveSession() {
+  LoRaSession session;
+  if (!SessionStore::parseHex(modem.getDevAddr().c_str(), session.devAddr, sizeof(session.devAddr)) ||
+      !SessionStore::parseHex(modem.getNwkSKey().c_str(), session.nwkSKey, sizeof(session.nwkSKey)) ||
+      !SessionStore::parseHex(modem.getAppSKey().c_str(), session.appSKey, sizeof(session.appSKey))) {
+    Serial.println("   Could not read session keys, not saved");
+    return;
+  }
+  int32_t fcu = modem.getFCU();
+  int32_t fcd = modem.getFCD();
+  session.fcntUp = fcu > 0 ? fcu : 0;
+  session.fcntDown = fcd > 0 ? fcd : 0;
+  sessionStore.save(session);
+}
+
+// 会话任务：帧计数快用完预留时写flash；网络一直没有ACK时重新入网
+void sessionTask() {
+  // 发送期间不能用modem的其他AT命令
+  if (uplinkQueue.isBusy()) return;
+  unsigned long now = millis();
+  
+  if (!loraJoined) {
+    if ((long)(now - nextRejoinTime) >= 0) rejoin();
+    return;
+  }
+  
+  int32_t fcu = modem.getFCU();
+  int32_t fcd = modem.getFCD();
+  if (fcu >= 0 && fcd >= 0 && sessionStore.reserve(fcu, fcd)) {
+    Serial.print("Session: FCntUp reserved up to ");
+    Serial.println(sessionStore.getReservedUp());
+  }
+  
+  // 这个会话收到过ACK就算有效
+  bool acked = uplinkQueue.hasAck() && (long)(uplinkQueue.getLastAckTime() - sessionStart) >= 0;
+  if (acked) sessionRestored = false;
+  
+  // 恢复的会话可能已经被服务器作废（重新入网过、计数不对），等得短一些
+  unsigned long silence = now - (acked ? uplinkQueue.getLastAckTime() : sessionStart);
+  unsigned long limit = sessionRestored ? SESSION_VERIFY_TIMEOUT : SESSION_ACK_TIMEOUT;
+  if (uplinkQueue.isLinkDown() && silence > limit) {
+    Serial.print("No ACK for ");
+    Serial.print(silence / 60000);
+    Serial.println(" min, rejoining");
+    rejoinWait = SESSION_REJOIN_MIN;
+    rejoin();
+  }
+}
+
+// 运行中重新入网（阻塞最多SESSION_JOIN_TIMEOUT），失败后退避重试，期间样本存进flash
+void rejoin() {
+  Serial.println("Joining TTN...");
+  bool connected = modem.joinOTAA(TTN_APP_EUI, TTN_APP_KEY, NULL, SESSION_JOIN_TIMEOUT);
+  loraTransport.resetPort();
+  
+  if (connected) {
+    Serial.println("✅ Joined TTN");
+    loraJoined = true;
+    sessionRestored = false;
+    sessionStart = millis();
+    rejoinWait = SESSION_REJOIN_MIN;
+    saveSession();
+    return;
   }
   
-  ui.showUploadStatus(err > 0);
-  delay(2000);
+  loraJoined = false;
+  nextRejoinTime = millis() + rejoinWait;
+  Serial.print("⚠️ Join failed, next attempt in ");
+  Serial.print(rejoinWait / 60000);
+  Serial.println(" min");
+  rejoinWait = rejoinWait * 2 > SESSION_REJOIN_MAX ? SESSION_REJOIN_MAX : rejoinWait * 2;
 }
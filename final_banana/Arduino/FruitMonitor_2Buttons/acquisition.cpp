@@ -0,0 +1,100 @@
+/*
+ * Acquisition Pipeline Implementation
+ */
+
+#include "acquisition.h"
+
+// 构造函数
+AcquisitionPipeline::AcquisitionPipeline(Sensors& sensors, FreshnessModel& model, Clock& clock)
+    : sensors(sensors), model(model), clock(clock) {
+    snapshotValid = false;
+    sensorReads = 0;
+    subscriberCount = 0;
+    snapshot.sequence = 0;
+}
+
+// 注册订阅者（按注册顺序调用）
+bool AcquisitionPipeline::subscribe(SnapshotCallback callback) {
+    if (subscriberCount >= ACQ_MAX_SUBSCRIBERS) return false;
+    subscribers[subscriberCount++] = callback;
+    return true;
+}
+
+// 采样一次：唯一读取传感器的地方
+bool AcquisitionPipeline::acquire() {
+    SensorData data = sensors.readSensors();
+    sensorReads++;
+
+    if (!data.valid) {
+        return false;
+    }
+
+    snapshot.data = data;
+    snapshot.timestamp = clock.now();
+    snapshot.sequence++;
+    snapshotValid = true;
+
+    derive();
+    publish();
+    return true;
+}
+
+// 用缓存的传感器数据重新计算模型输出
+bool AcquisitionPipeline::refresh() {
+    if (!snapshotValid) return false;
+
+    derive();
+    publish();
+    return true;
+}
+
+// 计算并缓存模型输出
+void AcquisitionPipeline::derive() {
+    const SensorData& data = snapshot.data;
+
+#if FRESHNESS_FIXED_POINT
+    model.updateReadingsFixed(data.temperatureX10, data.humidityX10, data.gasDelta);
+    snapshot.storageQuality = model.calculateStorageScoreFixed(data.temperatureX10, data.humidityX10);
+#else
+    model.updateReadings(data.temperature, data.humidity, data.gasDelta);
+    snapshot.storageQuality = model.calculateStorageScore(data.temperature, data.humidity);
+#endif
+
+    snapshot.fruit = model.getFruitType();
+    snapshot.score = model.getScore();
+    snapshot.remainDays = model.getRemainingDays();
+    snapshot.lifeUsedPermille = model.getLifeUsedPermille();
+    snapshot.stage = model.getStage();
+
+    // 模型每次都算全部水果，趋势也全部更新；
+    // 同一条采样重新计算（refresh）时不重复喂给滤波器
+    for (int f = 0; f < FRUIT_COUNT; f++) {
+        TrendEstimator& trend = trends[f];
+        if (!trend.isStarted() || trend.getLastTime() != snapshot.timestamp) {
+            trend.update(snapshot.timestamp, model.getScore((FruitType)f));
+        }
+    }
+    snapshot.spoil = trends[snapshot.fruit].project();
+}
+
+void AcquisitionPipeline::restartTrend() {
+    trends[model.getFruitType()].reset();
+}
+
+void AcquisitionPipeline::publish() {
+    for (int i = 0; i < subscriberCount; i++) {
+        subscribers[i](snapshot);
+    }
+}
+
+bool AcquisitionPipeline::hasSnapshot() {
+    return snapshotValid;
+}
+
+const Snapshot& AcquisitionPipeline::latest() {
+    return snapshot;
+}
+
+uint32_t AcquisitionPipeline::getSensorReads() {
+    return sensorReads;
+}
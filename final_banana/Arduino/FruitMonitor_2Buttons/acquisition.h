@@ -0,0 +1,70 @@
+/*
+ * Acquisition Pipeline - 采样流水线
+ *
+ * 按固定节拍采样一次，更新新鲜度模型，把带时间戳的快照
+ * 分发给订阅者（界面、串口日志、LoRa上传……）。
+ * 其他模块只读缓存的快照，不再自己读传感器。
+ */
+
+#ifndef ACQUISITION_H
+#define ACQUISITION_H
+
+#include <Arduino.h>
+#include "sensors.h"
+#include "freshness_model.h"
+#include "trend_estimator.h"
+
+#define ACQ_MAX_SUBSCRIBERS  6
+
+// 一次采样的快照：原始数据 + 模型输出
+struct Snapshot {
+    SensorData data;
+    unsigned long timestamp;    // 采样时刻 (ms)
+    uint32_t sequence;          // 采样序号
+    FruitType fruit;            // 计算时使用的水果配置
+    float score;
+    int remainDays;
+    uint16_t lifeUsedPermille;  // Q10积分的已用寿命（千分之一）
+    FreshnessStage stage;
+    int storageQuality;
+    SpoilProjection spoil;      // 按评分趋势预计多久变坏
+};
+
+typedef void (*SnapshotCallback)(const Snapshot& snapshot);
+
+// 采样流水线类
+class AcquisitionPipeline {
+public:
+    AcquisitionPipeline(Sensors& sensors, FreshnessModel& model,
+                        Clock& clock = SystemClock::instance());
+
+    bool subscribe(SnapshotCallback callback);
+
+    bool acquire();         // 采样一次并分发
+    bool refresh();         // 不读传感器，用缓存数据重新计算并分发（如切换水果后）
+    void restartTrend();    // 放入新水果后当前水果的趋势重新估计
+
+    bool hasSnapshot();
+    const Snapshot& latest();
+    uint32_t getSensorReads();
+
+private:
+    Sensors& sensors;
+    FreshnessModel& model;
+    Clock& clock;
+
+    Snapshot snapshot;
+    bool snapshotValid;
+    uint32_t sensorReads;
+
+    // 每种水果一个趋势估计，每次采样都更新
+    TrendEstimator trends[FRUIT_COUNT];
+
+    SnapshotCallback subscribers[ACQ_MAX_SUBSCRIBERS];
+    int subscriberCount;
+
+    void derive();
+    void publish();
+};
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Button Input Implementation
+ */
+
+#include "buttons.h"
+
+ButtonInput::ButtonState ButtonInput::buttons[BUTTON_COUNT];
+ButtonEvent ButtonInput::queue[BUTTON_QUEUE_SIZE];
+volatile uint8_t ButtonInput::queueHead = 0;
+volatile uint8_t ButtonInput::queueTail = 0;
+volatile uint16_t ButtonInput::droppedEvents = 0;
+
+// 初始化按钮和外部中断
+void ButtonInput::begin(uint8_t yellowPin, uint8_t greenPin) {
+    buttons[BUTTON_YELLOW].pin = yellowPin;
+    buttons[BUTTON_GREEN].pin = greenPin;
+
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        ButtonState& b = buttons[i];
+        pinMode(b.pin, INPUT_PULLUP);
+        b.pressed = (digitalRead(b.pin) == LOW);
+        b.lastChange = millis();
+        b.pressTime = b.lastChange;
+        b.longPressReported = b.pressed;  // 上电时已按住的不算长按
+    }
+
+    attachInterrupt(digitalPinToInterrupt(yellowPin), yellowISR, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(greenPin), greenISR, CHANGE);
+
+    enableHardwareFilter(yellowPin);
+    enableHardwareFilter(greenPin);
+}
+
+// 开启EIC的3次采样多数表决滤波，滤掉极短毛刺
+void ButtonInput::enableHardwareFilter(uint8_t pin) {
+#if defined(ARDUINO_ARCH_SAMD)
+    uint8_t extint = g_APinDescription[pin].ulExtInt;
+    uint8_t config = extint / 8;
+    uint8_t pos = (extint % 8) * 4;
+    EIC->CONFIG[config].reg |= (EIC_CONFIG_FILTEN0 << pos);
+#endif
+}
+
+void ButtonInput::yellowISR() {
+    handleEdge(BUTTON_YELLOW, millis());
+}
+
+void ButtonInput::greenISR() {
+    handleEdge(BUTTON_GREEN, millis());
+}
+
+// 中断中处理边沿：第一个有效边沿立即生效，去抖窗口内的抖动忽略
+void ButtonInput::handleEdge(uint8_t id, unsigned long now) {
+    ButtonState& b = buttons[id];
+
+    if (now - b.lastChange < BUTTON_DEBOUNCE_MS) return;
+
+    bool pressed = (digitalRead(b.pin) == LOW);
+    if (pressed == b.pressed) return;
+
+    b.pressed = pressed;
+    b.lastChange = now;
+
+    if (pressed) {
+        b.pressTime = now;
+        b.longPressReported = false;
+        push(id, BUTTON_PRESS, now, 0);
+    } else {
+        push(id, BUTTON_RELEASE, now, now - b.pressTime);
+    }
+}
+
+// 写入环形队列（满了就丢弃并计数）
+void ButtonInput::push(uint8_t id, uint8_t type, unsigned long time, unsigned long duration) {
+    uint8_t head = queueHead;
+    uint8_t next = (head + 1) & (BUTTON_QUEUE_SIZE - 1);
+
+    if (next == queueTail) {
+        droppedEvents++;
+        return;
+    }
+
+    queue[head].button = id;
+    queue[head].type = type;
+    queue[head].time = time;
+    queue[head].duration = duration;
+    queueHead = next;
+}
+
+// 去抖窗口内最后一个边沿被忽略时，按实际电平补上状态变化
+void ButtonInput::resync(uint8_t id, unsigned long now) {
+    ButtonState& b = buttons[id];
+
+    noInterrupts();
+    if (now - b.lastChange >= BUTTON_DEBOUNCE_MS) {
+        bool pressed = (digitalRead(b.pin) == LOW);
+        if (pressed != b.pressed) {
+            handleEdge(id, now);
+        }
+    }
+    interrupts();
+}
+
+// 取出一个事件；队列为空时检查是否需要补发长按事件
+bool ButtonInput::poll(ButtonEvent& event) {
+    unsigned long now = millis();
+
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        resync(i, now);
+    }
+
+    uint8_t tail = queueTail;
+    if (tail != queueHead) {
+        event = queue[tail];
+        queueTail = (tail + 1) & (BUTTON_QUEUE_SIZE - 1);
+        return true;
+    }
+
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        ButtonState& b = buttons[i];
+        if (b.pressed && !b.longPressReported &&
+            now - b.pressTime >= BUTTON_LONG_PRESS_MS) {
+            b.longPressReported = true;
+            event.button = i;
+            event.type = BUTTON_LONG_PRESS;
+            event.time = b.pressTime + BUTTON_LONG_PRESS_MS;
+            event.duration = now - b.pressTime;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ButtonInput::isPressed(ButtonId button) {
+    return buttons[button].pressed;
+}
+
+uint16_t ButtonInput::getDroppedEvents() {
+    return droppedEvents;
+}
@@ -0,0 +1,74 @@
+/*
+ * Button Input - 中断驱动的按钮输入
+ *
+ * 每个按钮挂在一路EIC外部中断上（D0=EXTINT6, D1=EXTINT7），
+ * 中断里做去抖并把带时间戳的事件写入无锁环形队列，
+ * 主循环用poll()取事件，渲染或LoRa阻塞期间按键也不会丢。
+ */
+
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <Arduino.h>
+
+#define BUTTON_COUNT        2
+#define BUTTON_QUEUE_SIZE   16      // 必须是2的幂
+#define BUTTON_DEBOUNCE_MS  50
+#define BUTTON_LONG_PRESS_MS 3000   // 3秒长按
+
+// 按钮编号
+enum ButtonId {
+    BUTTON_YELLOW = 0,
+    BUTTON_GREEN = 1
+};
+
+// 事件类型
+enum ButtonEventType {
+    BUTTON_PRESS = 0,
+    BUTTON_LONG_PRESS = 1,
+    BUTTON_RELEASE = 2
+};
+
+// 按钮事件
+struct ButtonEvent {
+    uint8_t button;             // ButtonId
+    uint8_t type;               // ButtonEventType
+    unsigned long time;         // 边沿时刻 (ms)
+    unsigned long duration;     // 释放/长按时：已按下时长 (ms)
+};
+
+// 按钮输入类
+class ButtonInput {
+public:
+    static void begin(uint8_t yellowPin, uint8_t greenPin);
+    static bool poll(ButtonEvent& event);
+    static bool isPressed(ButtonId button);
+    static uint16_t getDroppedEvents();
+
+private:
+    struct ButtonState {
+        uint8_t pin;
+        volatile bool pressed;              // 去抖后的状态
+        volatile unsigned long lastChange;  // 上次接受边沿的时刻
+        volatile unsigned long pressTime;
+        volatile bool longPressReported;
+    };
+
+    static ButtonState buttons[BUTTON_COUNT];
+
+    // 单生产者（EIC中断）/单消费者（poll）环形队列
+    static ButtonEvent queue[BUTTON_QUEUE_SIZE];
+    static volatile uint8_t queueHead;
+    static volatile uint8_t queueTail;
+    static volatile uint16_t droppedEvents;
+
+    static void handleEdge(uint8_t id, unsigned long now);
+    static void push(uint8_t id, uint8_t type, unsigned long time, unsigned long duration);
+    static void enableHardwareFilter(uint8_t pin);
+    static void resync(uint8_t id, unsigned long now);
+
+    static void yellowISR();
+    static void greenISR();
+};
+
+#endif
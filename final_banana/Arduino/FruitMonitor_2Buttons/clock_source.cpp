@@ -0,0 +1,30 @@
+/*
+ * Clock Source Implementation
+ */
+
+#include "clock_source.h"
+
+unsigned long SystemClock::now() {
+    return millis();
+}
+
+SystemClock& SystemClock::instance() {
+    static SystemClock clock;
+    return clock;
+}
+
+SimulatedClock::SimulatedClock(unsigned long start) {
+    current = start;
+}
+
+unsigned long SimulatedClock::now() {
+    return current;
+}
+
+void SimulatedClock::set(unsigned long ms) {
+    current = ms;
+}
+
+void SimulatedClock::advance(unsigned long ms) {
+    current += ms;
+}
@@ -0,0 +1,42 @@
+/*
+ * Clock Source - 时间来源
+ *
+ * 模型、采样和调度器都从Clock取时间（毫秒）。
+ * 设备上用SystemClock（millis()）；主机回放用SimulatedClock，
+ * 一周的数据可以在几毫秒内跑完。
+ */
+
+#ifndef CLOCK_SOURCE_H
+#define CLOCK_SOURCE_H
+
+#include <Arduino.h>
+
+// 时间来源接口
+class Clock {
+public:
+    virtual unsigned long now() = 0;
+};
+
+// 系统时钟：millis()
+class SystemClock : public Clock {
+public:
+    unsigned long now();
+
+    // 全局实例（函数内静态变量，避免全局对象的构造顺序问题）
+    static SystemClock& instance();
+};
+
+// 模拟时钟：只在调用set/advance时前进
+class SimulatedClock : public Clock {
+public:
+    SimulatedClock(unsigned long start = 0);
+
+    unsigned long now();
+    void set(unsigned long ms);
+    void advance(unsigned long ms);
+
+private:
+    unsigned long current;
+};
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Decision Rules Implementation
+ */
+
+#include "decision_rules.h"
+
+DecisionRules::DecisionRules() : thresholds(defaults()) {
+}
+
+DecisionRules::DecisionRules(const DecisionThresholds& thresholds) : thresholds(thresholds) {
+}
+
+// 默认阈值（上面的常量）
+DecisionThresholds DecisionRules::defaults() {
+    DecisionThresholds t;
+    t.bananaGasTest = BANANA_GAS_TEST_THRESHOLD;
+    t.bananaScoreTest = BANANA_SCORE_TEST_THRESHOLD;
+    t.orangeGasTest = ORANGE_GAS_TEST_THRESHOLD;
+    t.orangeScoreTest = ORANGE_SCORE_TEST_THRESHOLD;
+    t.envGasSpike = ENV_GAS_SPIKE_THRESHOLD;
+    t.envScore = ENV_SCORE_THRESHOLD;
+    return t;
+}
+
+// 评估水果测试：这个水果能不能吃
+FruitTestDecision DecisionRules::evaluateFruitTest(FruitType fruit, int gasDelta, float score) const {
+    FruitTestDecision decision;
+    
+    if (fruit == FRUIT_BANANA) {
+        decision.gasThreshold = thresholds.bananaGasTest;
+        decision.scoreThreshold = thresholds.bananaScoreTest;
+    } else {  // FRUIT_ORANGE
+        decision.gasThreshold = thresholds.orangeGasTest;
+        decision.scoreThreshold = thresholds.orangeScoreTest;
+    }
+    
+    decision.gasBad = (gasDelta > decision.gasThreshold);
+    decision.scoreBad = (score < decision.scoreThreshold);
+    decision.spoiled = (decision.gasBad || decision.scoreBad);
+    
+    return decision;
+}
+
+// 环境变坏判断（宽松）
+bool DecisionRules::checkEnvironmentSpoilage(int gasDelta, float score) const {
+    bool gasSpike = (gasDelta > thresholds.envGasSpike);
+    bool lowScore = (score < thresholds.envScore);
+    
+    return (gasSpike || lowScore);
+}
+
+const DecisionThresholds& DecisionRules::getThresholds() const {
+    return thresholds;
+}
+
+void DecisionRules::setThresholds(const DecisionThresholds& newThresholds) {
+    thresholds = newThresholds;
+}
@@ -0,0 +1,67 @@
+/*
+ * Decision Rules - 判断规则
+ *
+ * 水果测试（单个水果能不能吃）和环境监测（存放环境是否变坏）的阈值与判断。
+ * 固件和主机回放/调参工具共用同一份代码。
+ */
+
+#ifndef DECISION_RULES_H
+#define DECISION_RULES_H
+
+#include <Arduino.h>
+#include "fruit_profiles.h"
+
+// ==================== 🆕 根据你的环境调整的阈值 ====================
+// v3.5更新：根据你的实际环境条件(28.8°C, 48.7%)调整阈值
+// 你的环境Score约40.5，原45.0阈值太严格
+
+// 香蕉测试阈值（适中）- 用于测试单个水果
+const int BANANA_GAS_TEST_THRESHOLD = 10;      // Gas Delta阈值
+const float BANANA_SCORE_TEST_THRESHOLD = 38.0; // 🆕 降低！从45.0改为38.0
+
+// 橘子测试阈值（适中）
+const int ORANGE_GAS_TEST_THRESHOLD = 15;      
+const float ORANGE_SCORE_TEST_THRESHOLD = 45.0; // 🆕 降低！从50.0改为45.0
+
+// 环境判断阈值（宽松）- 用于环境监测
+const int ENV_GAS_SPIKE_THRESHOLD = 30;        // 降低！原50
+const float ENV_SCORE_THRESHOLD = 30.0;
+
+// 一组阈值（调参工具会替换）
+struct DecisionThresholds {
+    int bananaGasTest;
+    float bananaScoreTest;
+    int orangeGasTest;              // 其他水果也用橘子的阈值
+    float orangeScoreTest;
+    int envGasSpike;
+    float envScore;
+};
+
+// 水果测试结果（带上用到的阈值，方便打印）
+struct FruitTestDecision {
+    int gasThreshold;
+    float scoreThreshold;
+    bool gasBad;
+    bool scoreBad;
+    bool spoiled;
+};
+
+// 判断规则类
+class DecisionRules {
+public:
+    DecisionRules();
+    DecisionRules(const DecisionThresholds& thresholds);
+
+    FruitTestDecision evaluateFruitTest(FruitType fruit, int gasDelta, float score) const;
+    bool checkEnvironmentSpoilage(int gasDelta, float score) const;
+
+    const DecisionThresholds& getThresholds() const;
+    void setThresholds(const DecisionThresholds& thresholds);
+
+    static DecisionThresholds defaults();
+
+private:
+    DecisionThresholds thresholds;
+};
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * DHT22 Async Implementation
+ */
+
+#include "dht22_async.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#include <wiring_private.h>
+
+uint8_t DHT22Async::pin = 0;
+volatile uint8_t DHT22Async::state = DHT22_IDLE;
+volatile uint8_t DHT22Async::edgeCount = 0;
+volatile unsigned long DHT22Async::lastEdge = 0;
+volatile uint8_t DHT22Async::frame[5];
+unsigned long DHT22Async::startTime = 0;
+bool DHT22Async::started = false;
+uint32_t DHT22Async::readings = 0;
+uint32_t DHT22Async::failures = 0;
+uint32_t DHT22Async::crcErrors = 0;
+
+// 初始化：数据线上拉空闲，注册EXTINT11回调，配置TC4
+void DHT22Async::begin(uint8_t dataPin) {
+    pin = dataPin;
+    pinMode(pin, INPUT_PULLUP);
+
+    // 借D5注册回调，然后把D5恢复成普通输入
+    attachInterrupt(DHT22_EIC_ALIAS_PIN, edgeISR, FALLING);
+    pinMode(DHT22_EIC_ALIAS_PIN, INPUT_PULLUP);
+
+    setupTimer();
+    state = DHT22_IDLE;
+}
+
+// TC4: 48MHz / 16 = 3MHz，计到起始信号时长后溢出一次
+void DHT22Async::setupTimer() {
+    GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID_TC4_TC5 | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_CLKEN;
+    while (GCLK->STATUS.bit.SYNCBUSY);
+
+    PM->APBCMASK.reg |= PM_APBCMASK_TC4;
+
+    TC4->COUNT16.CTRLA.reg = TC_CTRLA_SWRST;
+    while (TC4->COUNT16.CTRLA.bit.SWRST);
+
+    TC4->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 |
+                             TC_CTRLA_WAVEGEN_MFRQ |
+                             TC_CTRLA_PRESCALER_DIV16;
+    TC4->COUNT16.CC[0].reg = DHT22_START_US * 3;
+    while (TC4->COUNT16.STATUS.bit.SYNCBUSY);
+
+    TC4->COUNT16.INTENSET.reg = TC_INTENSET_OVF;
+    NVIC_EnableIRQ(TC4_IRQn);
+}
+
+// 开始一次转换：拉低数据线，TC4到时后释放
+bool DHT22Async::start() {
+    if (state == DHT22_START || state == DHT22_RECEIVING) {
+        // 上一帧没收完，算一次失败
+        if (millis() - startTime < DHT22_TIMEOUT_MS) return false;
+        failures++;
+    }
+
+    // 转换太频繁时DHT22不应答
+    if (started && millis() - startTime < DHT22_MIN_INTERVAL_MS) return false;
+
+    for (uint8_t i = 0; i < 5; i++) frame[i] = 0;
+    edgeCount = 0;
+    startTime = millis();
+    started = true;
+    state = DHT22_START;
+
+    pinMode(pin, OUTPUT);
+    digitalWrite(pin, LOW);
+
+    TC4->COUNT16.COUNT.reg = 0;
+    while (TC4->COUNT16.STATUS.bit.SYNCBUSY);
+    TC4->COUNT16.CTRLA.reg |= TC_CTRLA_ENABLE;
+    while (TC4->COUNT16.STATUS.bit.SYNCBUSY);
+
+    return true;
+}
+
+// 起始信号结束：释放数据线，把PA11接到EIC开始接收
+void DHT22Async::handleTimer() {
+    TC4->COUNT16.CTRLA.reg &= ~TC_CTRLA_ENABLE;
+    TC4->COUNT16.INTFLAG.reg = TC_INTFLAG_OVF;
+
+    if (state != DHT22_START) return;
+
+    pinMode(pin, INPUT_PULLUP);
+    pinPeripheral(pin, PIO_EXTINT);
+
+    uint8_t extint = g_APinDescription[DHT22_EIC_ALIAS_PIN].ulExtInt;
+    EIC->INTFLAG.reg = (1UL << extint);
+
+    lastEdge = micros();
+    state = DHT22_RECEIVING;
+}
+
+// 下降沿：两次下降沿的间隔 = 50us低电平 + 高电平（0或1）
+void DHT22Async::edgeISR() {
+    if (state != DHT22_RECEIVING) return;
+
+    unsigned long now = micros();
+    uint8_t n = edgeCount;
+
+    // 第0个是应答，第1个是第一位的起始，第n个结束第n-2位
+    if (n >= 2 && now - lastEdge > DHT22_BIT_THRESHOLD_US) {
+        uint8_t bit = n - 2;
+        frame[bit >> 3] |= (0x80 >> (bit & 7));
+    }
+
+    lastEdge = now;
+    edgeCount = n + 1;
+
+    if (edgeCount >= DHT22_EDGE_COUNT) {
+        state = DHT22_DONE;
+    }
+}
+
+// 取出已完成的一帧；超时或CRC错误计入失败
+bool DHT22Async::poll(DHT22Reading& reading) {
+    if (state == DHT22_START || state == DHT22_RECEIVING) {
+        if (millis() - startTime >= DHT22_TIMEOUT_MS) {
+            state = DHT22_IDLE;
+            failures++;
+        }
+        return false;
+    }
+
+    if (state != DHT22_DONE) return false;
+    state = DHT22_IDLE;
+
+    uint8_t sum = frame[0] + frame[1] + frame[2] + frame[3];
+    if (sum != frame[4]) {
+        crcErrors++;
+        failures++;
+        return false;
+    }
+
+    reading.humidityX10 = ((uint16_t)frame[0] << 8) | frame[1];
+
+    int16_t temp = ((int16_t)(frame[2] & 0x7F) << 8) | frame[3];
+    reading.temperatureX10 = (frame[2] & 0x80) ? -temp : temp;
+
+    reading.time = startTime;
+    readings++;
+    return true;
+}
+
+bool DHT22Async::isBusy() {
+    return state == DHT22_START || state == DHT22_RECEIVING;
+}
+
+uint32_t DHT22Async::getReadings() {
+    return readings;
+}
+
+uint32_t DHT22Async::getFailures() {
+    return failures;
+}
+
+uint32_t DHT22Async::getCrcErrors() {
+    return crcErrors;
+}
+
+void TC4_Handler() {
+    DHT22Async::handleTimer();
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * DHT22 Async - 非阻塞DHT22驱动
+ *
+ * start()拉低数据线，TC4定时1.1ms后在中断里释放并打开EIC下降沿中断，
+ * 之后每个下降沿用micros()量一次间隔（约78us=0，约120us=1）。
+ * 整帧40位在后台接收，不关中断；poll()取结果并做CRC校验。
+ *
+ * ⚠️ MKR板的D3(PA11)在variant里没有登记外部中断（EXTINT11被D5占用），
+ * 这里借D5注册EXTINT11的回调，再把PA11接到EIC上。D5不能再用作中断。
+ */
+
+#ifndef DHT22_ASYNC_H
+#define DHT22_ASYNC_H
+
+#include <Arduino.h>
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#define DHT22_EIC_ALIAS_PIN     5       // 与D3共用EXTINT11的引脚
+#define DHT22_START_US          1100    // 起始信号低电平时间
+#define DHT22_EDGE_COUNT        42      // 应答1个 + 第一位起始1个 + 40位
+#define DHT22_BIT_THRESHOLD_US  100     // 下降沿间隔大于此值为1
+#define DHT22_TIMEOUT_MS        20      // 整帧超时
+#define DHT22_MIN_INTERVAL_MS   2000    // 两次转换的最小间隔
+
+// 一次完整读数（整数，0.1单位）
+struct DHT22Reading {
+    int16_t temperatureX10;     // 温度 (0.1°C)
+    uint16_t humidityX10;       // 湿度 (0.1%)
+    unsigned long time;         // 转换开始时刻 (ms)
+};
+
+// 驱动状态
+enum DHT22State {
+    DHT22_IDLE = 0,
+    DHT22_START = 1,            // 正在输出起始信号
+    DHT22_RECEIVING = 2,        // 正在接收
+    DHT22_DONE = 3              // 收满一帧，等待poll()
+};
+
+// 非阻塞DHT22驱动类
+class DHT22Async {
+public:
+    static void begin(uint8_t pin);
+    static bool start();                        // 开始一次转换（忙或间隔不足时返回false）
+    static bool poll(DHT22Reading& reading);    // 有新的有效读数时返回true
+    static bool isBusy();
+
+    static uint32_t getReadings();
+    static uint32_t getFailures();
+    static uint32_t getCrcErrors();
+
+    static void handleTimer();                  // TC4中断调用
+
+private:
+    static uint8_t pin;
+    static volatile uint8_t state;
+    static volatile uint8_t edgeCount;
+    static volatile unsigned long lastEdge;
+    static volatile uint8_t frame[5];
+    static unsigned long startTime;
+    static bool started;
+
+    // 统计
+    static uint32_t readings;
+    static uint32_t failures;                   // 超时 + CRC错误
+    static uint32_t crcErrors;
+
+    static void setupTimer();
+    static void edgeISR();
+};
+
+#endif
+
+#endif
@@ -0,0 +1,303 @@
+/*
+ * DMA SPI Bus Implementation
+ */
+
+#include "dma_spi_bus.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+// 构造函数
+DMASPIBus::DMASPIBus(int8_t dc, int8_t cs) {
+    dcPin = dc;
+    csPin = cs;
+    spiSpeed = TFT_SPI_SPEED;
+    dmaChannel = -1;
+    activeBuffer = 0;
+    fillLevel = 0;
+    dmaActive = false;
+    releasePending = false;
+    txPending = false;
+    repeatByte = 0;
+    bytesSent = 0;
+}
+
+// 初始化总线
+bool DMASPIBus::begin(int32_t speed, int8_t dataMode) {
+    if (speed != GFX_NOT_DEFINED) {
+        spiSpeed = speed;
+    }
+
+    // 直接操作端口寄存器，比digitalWrite快得多
+    pinMode(dcPin, OUTPUT);
+    PortGroup* dcPort = &PORT->Group[g_APinDescription[dcPin].ulPort];
+    dcMask = 1ul << g_APinDescription[dcPin].ulPin;
+    dcPortSet = &dcPort->OUTSET.reg;
+    dcPortClr = &dcPort->OUTCLR.reg;
+    dcData();
+
+    if (csPin >= 0) {
+        pinMode(csPin, OUTPUT);
+        PortGroup* csPort = &PORT->Group[g_APinDescription[csPin].ulPort];
+        csMask = 1ul << g_APinDescription[csPin].ulPin;
+        csPortSet = &csPort->OUTSET.reg;
+        csPortClr = &csPort->OUTCLR.reg;
+        csRelease();
+    }
+
+    SPI.begin();
+
+    dmaChannel = DMAController::allocateChannel();
+    if (dmaChannel < 0) {
+        Serial.println("   ⚠️ No DMA channel, CPU transfer only");
+    }
+
+    return true;
+}
+
+// ==================== 事务控制 ====================
+void DMASPIBus::beginWrite() {
+    if (releasePending) {
+        // 上一次事务的尾块还在发送：等它结束，CS保持选中直接复用
+        waitDMA();
+        releasePending = false;
+        return;
+    }
+
+    SPI.beginTransaction(SPISettings(spiSpeed, MSBFIRST, SPI_MODE0));
+
+    // 只发不收：关闭接收，避免RX缓冲区残留数据影响其他SPI设备
+    TFT_SERCOM->SPI.CTRLB.bit.RXEN = 0;
+    while (TFT_SERCOM->SPI.SYNCBUSY.bit.CTRLB);
+
+    dcData();
+    csSelect();
+}
+
+void DMASPIBus::endWrite() {
+    flush();
+
+    if (dmaActive) {
+        // 非阻塞：让最后一块继续发送，由transferInFlight()负责收尾
+        releasePending = true;
+        return;
+    }
+
+    finishWrite();
+}
+
+// 结束事务：等待移位完成，释放CS
+void DMASPIBus::finishWrite() {
+    waitShiftOut();
+    csRelease();
+
+    TFT_SERCOM->SPI.CTRLB.bit.RXEN = 1;
+    while (TFT_SERCOM->SPI.SYNCBUSY.bit.CTRLB);
+
+    SPI.endTransaction();
+}
+
+// ==================== 非阻塞接口 ====================
+bool DMASPIBus::transferInFlight() {
+    if (dmaActive) {
+        if (DMAController::isBusy(dmaChannel)) {
+            return true;
+        }
+        dmaActive = false;
+    }
+
+    if (releasePending) {
+        releasePending = false;
+        finishWrite();
+    }
+
+    return false;
+}
+
+void DMASPIBus::waitTransfer() {
+    while (transferInFlight());
+}
+
+// ==================== 命令 ====================
+void DMASPIBus::writeCommand(uint8_t c) {
+    flush();
+    waitDMA();
+    waitShiftOut();
+
+    dcCommand();
+    sendCPU(&c, 1);
+    waitShiftOut();
+    dcData();
+}
+
+void DMASPIBus::writeCommand16(uint16_t c) {
+    uint8_t buf[2] = { (uint8_t)(c >> 8), (uint8_t)(c & 0xFF) };
+    writeCommandBytes(buf, 2);
+}
+
+void DMASPIBus::writeCommandBytes(uint8_t* data, uint32_t len) {
+    flush();
+    waitDMA();
+    waitShiftOut();
+
+    dcCommand();
+    sendCPU(data, len);
+    waitShiftOut();
+    dcData();
+}
+
+// ==================== 数据 ====================
+void DMASPIBus::write(uint8_t d) {
+    buffers[activeBuffer][fillLevel++] = d;
+    if (fillLevel == DMA_SPI_BUFFER_SIZE) {
+        flush();
+    }
+}
+
+void DMASPIBus::write16(uint16_t d) {
+    write(d >> 8);
+    write(d & 0xFF);
+}
+
+void DMASPIBus::writePixels(uint16_t* data, uint32_t len) {
+    while (len--) {
+        write16(*data++);
+    }
+}
+
+void DMASPIBus::writeBytes(uint8_t* data, uint32_t len) {
+    while (len--) {
+        write(*data++);
+    }
+}
+
+// 16位纯色填充
+void DMASPIBus::writeRepeat(uint16_t p, uint32_t len) {
+    uint8_t pattern[2] = { (uint8_t)(p >> 8), (uint8_t)(p & 0xFF) };
+    writePattern(pattern, 2, len);
+}
+
+// 任意长度的像素图案重复（18位驱动每像素3字节）
+void DMASPIBus::writePattern(uint8_t* data, uint8_t len, uint32_t repeat) {
+    if (len == 0 || repeat == 0) return;
+
+    flush();
+
+    if (dmaChannel < 0) {
+        while (repeat--) {
+            for (uint8_t i = 0; i < len; i++) write(data[i]);
+        }
+        return;
+    }
+
+    // 所有字节相同（黑/白/灰）：源地址不递增，一个描述符发完
+    bool uniform = true;
+    for (uint8_t i = 1; i < len; i++) {
+        if (data[i] != data[0]) { uniform = false; break; }
+    }
+
+    if (uniform) {
+        waitDMA();
+        repeatByte = data[0];
+        uint32_t remaining = (uint32_t)len * repeat;
+        while (remaining > 0) {
+            uint16_t chunk = (remaining > 0xFFFF) ? 0xFFFF : remaining;
+            waitDMA();
+            sendDMA(&repeatByte, chunk, false);
+            remaining -= chunk;
+        }
+        return;
+    }
+
+    // 用图案填满空闲缓冲区，再反复交给DMA发送
+    uint16_t perBuffer = DMA_SPI_BUFFER_SIZE / len;
+    uint16_t fillCount = (repeat < perBuffer) ? repeat : perBuffer;
+    uint8_t* buf = buffers[activeBuffer];
+    for (uint16_t i = 0; i < fillCount; i++) {
+        memcpy(buf + i * len, data, len);
+    }
+
+    while (repeat > 0) {
+        uint16_t chunk = (repeat < fillCount) ? repeat : fillCount;
+        waitDMA();
+        sendDMA(buf, chunk * len, true);
+        repeat -= chunk;
+    }
+
+    // 正在发送的缓冲区不能再写，切换到另一块
+    activeBuffer ^= 1;
+    fillLevel = 0;
+}
+
+// ==================== 统计 ====================
+uint32_t DMASPIBus::getBytesSent() {
+    return bytesSent;
+}
+
+void DMASPIBus::resetBytesSent() {
+    bytesSent = 0;
+}
+
+// ==================== 底层发送 ====================
+
+// 把当前缓冲区交出去：小块由CPU直接发，大块交给DMA
+void DMASPIBus::flush() {
+    if (fillLevel == 0) return;
+
+    uint8_t* buf = buffers[activeBuffer];
+    uint16_t len = fillLevel;
+    fillLevel = 0;
+
+    waitDMA();
+
+    if (len < DMA_SPI_MIN_DMA_BYTES || dmaChannel < 0) {
+        sendCPU(buf, len);
+        return;
+    }
+
+    sendDMA(buf, len, true);
+    activeBuffer ^= 1;  // CPU转去填充另一块
+}
+
+void DMASPIBus::sendDMA(const uint8_t* src, uint16_t len, bool srcIncrement) {
+    DmacDescriptor* desc = DMAController::descriptor(dmaChannel);
+
+    desc->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                       DMAC_BTCTRL_BEATSIZE_BYTE |
+                       DMAC_BTCTRL_BLOCKACT_NOACT |
+                       (srcIncrement ? DMAC_BTCTRL_SRCINC : 0);
+    desc->BTCNT.reg = len;
+    // 源地址递增时，SRCADDR填的是结束地址
+    desc->SRCADDR.reg = (uint32_t)src + (srcIncrement ? len : 0);
+    desc->DSTADDR.reg = (uint32_t)&TFT_SERCOM->SPI.DATA.reg;
+    desc->DESCADDR.reg = 0;
+
+    DMAController::start(dmaChannel, TFT_SERCOM_DMAC_TX, DMAC_CHCTRLB_TRIGACT_BEAT);
+
+    dmaActive = true;
+    txPending = true;
+    bytesSent += len;
+}
+
+void DMASPIBus::sendCPU(const uint8_t* src, uint16_t len) {
+    while (len--) {
+        while (!(TFT_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_DRE));
+        TFT_SERCOM->SPI.DATA.reg = *src++;
+        bytesSent++;
+    }
+    txPending = true;
+}
+
+void DMASPIBus::waitDMA() {
+    if (!dmaActive) return;
+    while (DMAController::isBusy(dmaChannel));
+    dmaActive = false;
+}
+
+// 等待最后一个字节移出（切换DC/CS前必须）
+void DMASPIBus::waitShiftOut() {
+    if (!txPending) return;
+    while (!(TFT_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_TXC));
+    txPending = false;
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * DMA SPI Bus - 硬件SPI + DMA显示总线
+ *
+ * 使用MKR板载SPI（SERCOM1：MOSI=8, SCK=9, MISO=10），
+ * 数据先写入双缓冲区，再由DMA发送，CPU可以继续填充下一块。
+ * 纯色填充直接用DMA重复发送同一块缓冲区。
+ */
+
+#ifndef DMA_SPI_BUS_H
+#define DMA_SPI_BUS_H
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#include <SPI.h>
+#include "samd_dma.h"
+
+// ==================== 总线参数 ====================
+#ifndef TFT_SPI_SPEED
+#define TFT_SPI_SPEED  12000000   // SAMD21 SPI最高12MHz
+#endif
+
+#define TFT_SERCOM             SERCOM1
+#define TFT_SERCOM_DMAC_TX     SERCOM1_DMAC_ID_TX
+
+#define DMA_SPI_BUFFER_SIZE    384  // 每块缓冲（3和2的公倍数，适合18/16位像素）
+#define DMA_SPI_MIN_DMA_BYTES  16   // 少于此字节数直接由CPU发送
+
+class DMASPIBus : public Arduino_DataBus {
+public:
+    DMASPIBus(int8_t dc, int8_t cs);
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED, int8_t dataMode = GFX_NOT_DEFINED);
+    void beginWrite();
+    void endWrite();
+    void writeCommand(uint8_t c);
+    void writeCommand16(uint16_t c);
+    void writeCommandBytes(uint8_t* data, uint32_t len);
+    void write(uint8_t d);
+    void write16(uint16_t d);
+    void writeRepeat(uint16_t p, uint32_t len);
+    void writePixels(uint16_t* data, uint32_t len);
+    void writeBytes(uint8_t* data, uint32_t len);
+    void writePattern(uint8_t* data, uint8_t len, uint32_t repeat);
+
+    // 非阻塞接口：endWrite()后最后一块可能仍在发送
+    bool transferInFlight();
+    void waitTransfer();
+
+    // 统计
+    uint32_t getBytesSent();
+    void resetBytesSent();
+
+private:
+    int8_t dcPin;
+    int8_t csPin;
+    int32_t spiSpeed;
+    int8_t dmaChannel;
+
+    volatile uint32_t* dcPortSet;
+    volatile uint32_t* dcPortClr;
+    uint32_t dcMask;
+    volatile uint32_t* csPortSet;
+    volatile uint32_t* csPortClr;
+    uint32_t csMask;
+
+    uint8_t buffers[2][DMA_SPI_BUFFER_SIZE];
+    uint8_t activeBuffer;
+    uint16_t fillLevel;
+
+    bool dmaActive;
+    bool releasePending;    // 传输结束后需要释放CS
+    bool txPending;         // SERCOM可能仍在移位
+    uint8_t repeatByte;     // 单字节重复填充的DMA源
+    uint32_t bytesSent;
+
+    void flush();
+    void sendDMA(const uint8_t* src, uint16_t len, bool srcIncrement);
+    void sendCPU(const uint8_t* src, uint16_t len);
+    void waitDMA();
+    void waitShiftOut();
+    void finishWrite();
+
+    inline void dcCommand() { *dcPortClr = dcMask; }
+    inline void dcData()    { *dcPortSet = dcMask; }
+    inline void csSelect()  { if (csPin >= 0) *csPortClr = csMask; }
+    inline void csRelease() { if (csPin >= 0) *csPortSet = csMask; }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,322 @@
+/*
+ * Flash Log Implementation
+ */
+
+#include "flash_log.h"
+
+#define RECORD_SEQ        0
+#define RECORD_BOOT       4
+#define RECORD_COUNT      6
+#define RECORD_STATE      7
+#define RECORD_REMAIN     8
+#define RECORD_OFFSET     9
+#define RECORD_MINUTE     10
+#define RECORD_SAMPLES    12
+#define RECORD_CRC        (FLASH_LOG_PAGE_SIZE - 2)
+
+static_assert(RECORD_SAMPLES + FLASH_LOG_RECORD_SAMPLES * FLASH_LOG_SAMPLE_SIZE <= RECORD_CRC,
+              "flash log record does not fit in a page");
+
+static uint32_t getUint32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void putUint32(uint8_t* p, uint32_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = (value >> 24) & 0xFF;
+}
+
+static uint16_t getUint16(const uint8_t* p) {
+    return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+static void putUint16(uint8_t* p, uint16_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+static void putSample(uint8_t* p, const BatchSample& sample) {
+    putUint16(p, (uint16_t)sample.temperatureX10);
+    putUint16(p + 2, sample.humidityX10);
+    putUint16(p + 4, sample.gasRaw);
+    putUint16(p + 6, (uint16_t)sample.gasDelta);
+    putUint16(p + 8, sample.scoreX10);
+}
+
+static void getSample(const uint8_t* p, uint16_t minute, BatchSample& sample) {
+    sample.minute = minute;
+    sample.temperatureX10 = (int16_t)getUint16(p);
+    sample.humidityX10 = getUint16(p + 2);
+    sample.gasRaw = getUint16(p + 4);
+    sample.gasDelta = (int16_t)getUint16(p + 6);
+    sample.scoreX10 = getUint16(p + 8);
+}
+
+// CRC-16/CCITT
+uint16_t flashCrc16(const uint8_t* data, int length) {
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// 这一页是序号seq的有效记录（没擦掉、没写坏）
+static bool validRecord(const uint8_t* record, uint32_t seq) {
+    return getUint32(record + RECORD_SEQ) == seq &&
+           record[RECORD_COUNT] <= FLASH_LOG_RECORD_SAMPLES &&
+           getUint16(record + RECORD_CRC) == flashCrc16(record, RECORD_CRC);
+}
+
+FlashLog::FlashLog(LogStorage& storage) : storage(storage) {
+    pages = 0;
+    boot = 0;
+    headSeq = 0;
+    tailSeq = 0;
+    tailOffset = 0;
+    pendingSamples = 0;
+    recordsWritten = 0;
+    rowErases = 0;
+    samplesOverwritten = 0;
+}
+
+void FlashLog::begin() {
+    pages = storage.pageCount() - storage.pageCount() % FLASH_LOG_PAGES_PER_ROW;
+
+    bool found = false;
+    uint32_t minSeq = 0;
+    uint32_t maxSeq = 0;
+    uint16_t maxBoot = 0;
+    bool haveMark = false;
+    uint32_t markSeq = 0;
+    uint32_t markTail = 0;
+    uint8_t markOffset = 0;
+
+    for (uint16_t p = 0; p < pages; p++) {
+        storage.read(p, page);
+        uint32_t seq = getUint32(page + RECORD_SEQ);
+        if (seq == 0xFFFFFFFF || seq % pages != p || !validRecord(page, seq)) continue;
+
+        if (!found || seq < minSeq) minSeq = seq;
+        if (!found || seq > maxSeq) maxSeq = seq;
+        uint16_t recordBoot = getUint16(page + RECORD_BOOT);
+        if (!found || recordBoot > maxBoot) maxBoot = recordBoot;
+        found = true;
+
+        if (page[RECORD_COUNT] == 0 && (!haveMark || seq > markSeq)) {
+            haveMark = true;
+            markSeq = seq;
+            markTail = getUint32(page + RECORD_SAMPLES);
+            markOffset = page[RECORD_OFFSET];
+        }
+    }
+
+    headSeq = found ? maxSeq + 1 : 0;
+    boot = found ? maxBoot + 1 : 1;
+    tailSeq = found ? minSeq : 0;
+    tailOffset = 0;
+    if (haveMark && markTail >= minSeq && markTail <= headSeq) {
+        tailSeq = markTail;
+        tailOffset = markOffset;
+    }
+
+    pendingSamples = 0;
+    for (uint32_t seq = tailSeq; seq < headSeq; seq++) {
+        if (!readRecord(seq) || page[RECORD_COUNT] == 0) continue;
+        int offset = (seq == tailSeq) ? tailOffset : 0;
+        if (page[RECORD_COUNT] > offset) pendingSamples += page[RECORD_COUNT] - offset;
+    }
+}
+
+bool FlashLog::readRecord(uint32_t seq) {
+    storage.read(seq % pages, page);
+    return validRecord(page, seq);
+}
+
+// 写page里准备好的记录：填序号和CRC，进入新的一行时先擦除（覆盖最旧的记录）
+void FlashLog::writeRecord() {
+    uint32_t seq = headSeq;
+    uint16_t p = seq % pages;
+
+    if (p % FLASH_LOG_PAGES_PER_ROW == 0) {
+        if (seq >= pages) {
+            uint32_t oldest = seq - pages;
+            uint8_t old[FLASH_LOG_PAGE_SIZE];
+            for (uint32_t s = oldest; s < oldest + FLASH_LOG_PAGES_PER_ROW; s++) {
+                if (s < tailSeq) continue;
+                storage.read(s % pages, old);
+                if (!validRecord(old, s) || old[RECORD_COUNT] == 0) continue;
+                int offset = (s == tailSeq) ? tailOffset : 0;
+                uint32_t lost = old[RECORD_COUNT] > offset ? old[RECORD_COUNT] - offset : 0;
+                samplesOverwritten += lost;
+                pendingSamples = pendingSamples > lost ? pendingSamples - lost : 0;
+            }
+            if (tailSeq < oldest + FLASH_LOG_PAGES_PER_ROW) {
+                tailSeq = oldest + FLASH_LOG_PAGES_PER_ROW;
+                tailOffset = 0;
+            }
+        }
+        storage.eraseRow(p);
+        rowErases++;
+    }
+
+    putUint32(page + RECORD_SEQ, seq);
+    putUint16(page + RECORD_CRC, flashCrc16(page, RECORD_CRC));
+    storage.write(p, page);
+    headSeq++;
+    recordsWritten++;
+}
+
+bool FlashLog::append(const BatchHeader& status, const BatchSample* samples, int count) {
+    if (pages == 0) return false;
+
+    int i = 0;
+    while (i < count) {
+        // 一条记录只放分钟计数连续的样本
+        int n = 1;
+        while (i + n < count && n < FLASH_LOG_RECORD_SAMPLES &&
+               (uint16_t)(samples[i + n].minute - samples[i + n - 1].minute) == 1) {
+            n++;
+        }
+
+        memset(page, 0xFF, sizeof(page));
+        putUint16(page + RECORD_BOOT, boot);
+        page[RECORD_COUNT] = n;
+        page[RECORD_STATE] = ((uint8_t)status.fruit & 0x0F) | ((uint8_t)status.stage << 4);
+        page[RECORD_REMAIN] = status.remainDays < 0 ? 255 : (status.remainDays > 254 ? 254 : status.remainDays);
+        page[RECORD_OFFSET] = 0;
+        putUint16(page + RECORD_MINUTE, samples[i].minute);
+        for (int k = 0; k < n; k++) {
+            putSample(page + RECORD_SAMPLES + k * FLASH_LOG_SAMPLE_SIZE, samples[i + k]);
+        }
+        writeRecord();
+        pendingSamples += n;
+        i += n;
+    }
+    return true;
+}
+
+int FlashLog::read(BatchHeader& status, uint16_t& recordBoot, BatchSample* samples, int maxSamples) {
+    int n = 0;
+    uint32_t seq = tailSeq;
+    uint8_t offset = tailOffset;
+
+    while (seq < headSeq && n < maxSamples) {
+        // 坏记录和已发送标记跳过
+        if (!readRecord(seq) || page[RECORD_COUNT] == 0) {
+            seq++;
+            offset = 0;
+            continue;
+        }
+
+        // 不同启动的分钟计数接不上，分开补发
+        uint16_t b = getUint16(page + RECORD_BOOT);
+        if (n > 0 && b != recordBoot) break;
+        recordBoot = b;
+
+        status.version = BATCH_VERSION;
+        status.fruit = (FruitType)(page[RECORD_STATE] & 0x0F);
+        status.stage = (FreshnessStage)(page[RECORD_STATE] >> 4);
+        status.remainDays = page[RECORD_REMAIN] == 255 ? -1 : page[RECORD_REMAIN];
+        status.spoil.hours = TREND_NO_PROJECTION;
+        status.spoil.lowHours = TREND_NO_PROJECTION;
+        status.spoil.highHours = TREND_NO_PROJECTION;
+
+        int count = page[RECORD_COUNT];
+        uint16_t firstMinute = getUint16(page + RECORD_MINUTE);
+        while (offset < count && n < maxSamples) {
+            getSample(page + RECORD_SAMPLES + offset * FLASH_LOG_SAMPLE_SIZE, firstMinute + offset, samples[n++]);
+            offset++;
+        }
+        if (offset >= count) {
+            seq++;
+            offset = 0;
+        }
+    }
+    return n;
+}
+
+// 和read()一样跳过坏记录和标记，往后数samples个样本
+void FlashLog::advance(uint32_t& seq, uint8_t& offset, int samples) {
+    while (samples > 0 && seq < headSeq) {
+        if (!readRecord(seq) || page[RECORD_COUNT] == 0) {
+            seq++;
+            offset = 0;
+            continue;
+        }
+        int left = page[RECORD_COUNT] - offset;
+        if (samples < left) {
+            offset += samples;
+            return;
+        }
+        samples -= left;
+        seq++;
+        offset = 0;
+    }
+}
+
+void FlashLog::consume(int samples) {
+    if (pages == 0 || samples <= 0) return;
+
+    advance(tailSeq, tailOffset, samples);
+    pendingSamples = pendingSamples > (uint32_t)samples ? pendingSamples - samples : 0;
+
+    // 日志满时标记要擦掉的那一行还有没发的样本：先不写标记，等那一行
+    // 发完再写（这之间重启只会重发几帧，不会丢样本）
+    uint16_t p = headSeq % pages;
+    if (p % FLASH_LOG_PAGES_PER_ROW == 0 && headSeq >= pages &&
+        tailSeq < headSeq - pages + FLASH_LOG_PAGES_PER_ROW) {
+        return;
+    }
+
+    // 已发送标记：重启后从这里继续
+    memset(page, 0xFF, sizeof(page));
+    putUint16(page + RECORD_BOOT, boot);
+    page[RECORD_COUNT] = 0;
+    page[RECORD_OFFSET] = tailOffset;
+    putUint32(page + RECORD_SAMPLES, tailSeq);
+    writeRecord();
+}
+
+bool FlashLog::hasPending() const {
+    return pendingSamples > 0;
+}
+
+uint32_t FlashLog::getPendingSamples() const {
+    return pendingSamples;
+}
+
+uint16_t FlashLog::getBoot() const {
+    return boot;
+}
+
+uint32_t FlashLog::getRecordsWritten() const {
+    return recordsWritten;
+}
+
+uint32_t FlashLog::getRowErases() const {
+    return rowErases;
+}
+
+uint32_t FlashLog::getSamplesOverwritten() const {
+    return samplesOverwritten;
+}
+
+void FlashLog::printStats() const {
+    Serial.print("Flash log: ");
+    Serial.print(pendingSamples);
+    Serial.print(" samples pending, boot ");
+    Serial.print(boot);
+    Serial.print(", ");
+    Serial.print(recordsWritten);
+    Serial.print(" records written, ");
+    Serial.print(rowErases);
+    Serial.print(" row erases, ");
+    Serial.print(samplesOverwritten);
+    Serial.println(" samples overwritten");
+}
@@ -0,0 +1,96 @@
+/*
+ * Flash Log - 断网时的样本日志
+ *
+ * 没入网、或者一帧重试用完还没发出去时，把样本写进flash；网络恢复后
+ * 从最旧的开始补发（端口3），送达后才从日志里移除，断电重启也不丢。
+ *
+ * 每条记录占一页（64字节），按序号顺序写：序号s的记录在第 s % 页数 页，
+ * 写到一行（4页）的第一页时先擦除整行。整个区域循环使用，每行的擦写
+ * 次数一样（磨损均衡）；写满时覆盖最旧的记录。
+ *
+ * 一条记录存一帧的样本（帧里的样本分钟计数连续，只存第一个），上传帧
+ * 通常是5个每分钟样本，正好一页；更长的帧拆成几条。补发时每送达一帧
+ * 写一页已发送标记，日志满时标记不覆盖还没发的样本（晚一点再写）。
+ *
+ * 记录格式：
+ *   [0-3]   序号（全部为1=空页）
+ *   [4-5]   启动编号（每次上电加1，样本的分钟计数只在同一次启动内可比）
+ *   [6]     样本数（0=已发送标记）
+ *   [7]     水果类型(低4位) | 阶段(高4位)
+ *   [8]     剩余天数（255=已过期）
+ *   [9]     标记：第一个未发送样本在记录里的位置
+ *   [10-11] 第一个样本的分钟计数，之后每个样本加1
+ *   [12-61] 最多5个样本，各10字节：温度×10、湿度×10、气体原始值、气体变化、
+ *           评分×10（uint16/int16）；标记：[12-15]第一个未发送记录的序号
+ *   [62-63] CRC16（[0-61]）
+ * 启动时扫描一遍，序号最大的是最新记录，最新的标记给出从哪里继续补发。
+ */
+
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+#include <Arduino.h>
+#include "uplink_batch.h"
+
+#define FLASH_LOG_PAGE_SIZE       64
+#define FLASH_LOG_PAGES_PER_ROW   4       // SAMD21按行擦除（256字节）
+#define FLASH_LOG_ROWS            64      // 16KB：256条记录，断网时最多存1280个样本
+#define FLASH_LOG_RECORD_SAMPLES  5
+#define FLASH_LOG_SAMPLE_SIZE     10      // 一个样本（不含分钟计数）
+
+// 存储接口：设备上是SAMD21的NVM，主机回放用模拟的flash
+class LogStorage {
+public:
+    virtual uint16_t pageCount() = 0;
+    virtual void read(uint16_t page, uint8_t* data) = 0;
+    virtual void write(uint16_t page, const uint8_t* data) = 0;   // 这一页必须已擦除
+    virtual void eraseRow(uint16_t firstPage) = 0;
+};
+
+// 记录末尾的CRC16-CCITT（会话存储也用）
+uint16_t flashCrc16(const uint8_t* data, int length);
+
+class FlashLog {
+public:
+    FlashLog(LogStorage& storage);
+
+    void begin();           // 扫描日志，找到最新记录和补发位置，启动编号加1
+
+    // 追加样本（状态取自header），返回false表示存储不可用
+    bool append(const BatchHeader& status, const BatchSample* samples, int count);
+
+    // 从最旧的未发送样本开始，读出同一次启动记录的样本（最多maxSamples个）
+    int read(BatchHeader& status, uint16_t& recordBoot, BatchSample* samples, int maxSamples);
+    void consume(int samples);      // 前samples个样本已送达，写已发送标记
+
+    bool hasPending() const;
+    uint32_t getPendingSamples() const;
+    uint16_t getBoot() const;
+
+    uint32_t getRecordsWritten() const;
+    uint32_t getRowErases() const;
+    uint32_t getSamplesOverwritten() const;
+    void printStats() const;
+
+private:
+    LogStorage& storage;
+    uint16_t pages;
+    uint16_t boot;
+
+    uint32_t headSeq;           // 下一条记录的序号
+    uint32_t tailSeq;           // 第一个未发送样本所在的记录
+    uint8_t tailOffset;         // 以及在记录里的位置
+    uint32_t pendingSamples;
+
+    uint32_t recordsWritten;
+    uint32_t rowErases;
+    uint32_t samplesOverwritten;
+
+    uint8_t page[FLASH_LOG_PAGE_SIZE];
+
+    bool readRecord(uint32_t seq);
+    void writeRecord();
+    void advance(uint32_t& seq, uint8_t& offset, int samples);
+};
+
+#endif
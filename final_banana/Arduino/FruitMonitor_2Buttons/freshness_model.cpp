@@ -4,96 +4,390 @@
 
 #include "freshness_model.h"
 
-// 构造函数
-FreshnessModel::FreshnessModel() {
+// 构造函数：所有水果同时开始计时
+FreshnessModel::FreshnessModel(Clock& clock) : clock(clock) {
     currentFruit = FRUIT_BANANA;
     profile = &FruitDatabase::getProfile(FRUIT_BANANA);
-    currentScore = 100.0;
-    startTime = millis();
+    profileFixed = &FruitDatabase::getProfileFixed(FRUIT_BANANA);
+    
+    unsigned long now = clock.now();
+    for (int f = 0; f < FRUIT_COUNT; f++) {
+        scores[f] = FruitDatabase::getProfile((FruitType)f).initialScore;
+        scoresCenti[f] = FruitDatabase::getProfileFixed((FruitType)f).initialScoreCenti;
+        shelfLife.reset((FruitType)f, now);
+    }
 }
 
-// 设置水果类型
+// 设置显示的水果类型：每种水果每次采样都在算，切换只是换个视图
 void FreshnessModel::setFruitType(FruitType type) {
     currentFruit = type;
     profile = &FruitDatabase::getProfile(type);
-    currentScore = profile->initialScore;
-    startTime = millis();  // 重置开始时间
+    profileFixed = &FruitDatabase::getProfileFixed(type);
+}
+
+// 放入新的水果：当前水果的寿命从头开始算
+void FreshnessModel::startNewFruit() {
+    shelfLife.reset(currentFruit, clock.now());
+    scores[currentFruit] = profile->initialScore;
+    scoresCenti[currentFruit] = profileFixed->initialScoreCenti;
+}
+
+// 换用自定义系数（主机调参工具用，只影响calculateScore*()，水果类型和计时不变）
+void FreshnessModel::setProfiles(const FruitProfile& newProfile, const FruitProfileFixed& newProfileFixed) {
+    profile = &newProfile;
+    profileFixed = &newProfileFixed;
+}
+
+// 获取当前水果类型
+FruitType FreshnessModel::getFruitType() {
+    return currentFruit;
 }
 
-// 更新读数并计算评分
+// 更新读数并计算全部水果的评分（浮点）
+// 时间衰减用Q10积分得到的等效存放时间（积分器本身是整数的）
 void FreshnessModel::updateReadings(float temperature, float humidity, int gasDelta) {
-    currentScore = calculateScore(temperature, humidity, gasDelta);
+    int16_t temperatureX10 = (int16_t)(temperature * 10 + (temperature >= 0 ? 0.5f : -0.5f));
+    uint16_t humidityX10 = (uint16_t)(humidity * 10 + 0.5f);
+    unsigned long now = clock.now();
+    
+    for (int f = 0; f < FRUIT_COUNT; f++) {
+        FruitType fruit = (FruitType)f;
+        const FruitProfile& p = FruitDatabase::getProfile(fruit);
+        
+        float condition = scoreWithProfile(p, temperature, humidity, gasDelta, 0);
+        shelfLife.update(fruit, temperatureX10, humidityX10, (int32_t)(condition * 100 + 0.5f), now);
+        
+        float ageHours = shelfLife.getEquivalentAgeSeconds(fruit) / 3600.0;
+        scores[f] = scoreWithProfile(p, temperature, humidity, gasDelta, ageHours);
+        scoresCenti[f] = (int32_t)(scores[f] * 100 + 0.5f);
+    }
+}
+
+// 0.0001分 -> 0.01分，限制范围 0-100
+static inline int32_t roundScore(int32_t score) {
+    if (score < 0) score = 0;
+    if (score > 1000000) score = 1000000;
+    return (score + 50) / 100;
+}
+
+// 时间衰减（0.0001分）：秒 × (0.01分/小时) × 100 / 3600，拆开算避免溢出
+static inline int32_t timePenalty(uint32_t ageSeconds, int32_t timeDecayCenti) {
+    uint32_t penalty = (ageSeconds / 36) * timeDecayCenti +
+                       (ageSeconds % 36) * timeDecayCenti / 36;
+    if (penalty > 1000000) penalty = 1000000;
+    return (int32_t)penalty;
+}
+
+// 一种水果的环境评分（0.0001分，未限幅），系数全是FruitTraits<F>的编译期常量，
+// 展开后只剩和常数的减法、乘法，结果和calculateScoreFixed()的前三项相同
+template <FruitType F>
+static inline int32_t conditionScoreFixed(int32_t temp2, int32_t humid2, int32_t gas) {
+    typedef FruitTraits<F> T;
+    int32_t tempDev2 = temp2 - T::tempSumX10;
+    if (tempDev2 < 0) tempDev2 = -tempDev2;
+    int32_t humidDev2 = humid2 - T::humiditySumX10;
+    if (humidDev2 < 0) humidDev2 = -humidDev2;
+    
+    return T::initialScoreE4 - tempDev2 * T::tempPenaltyE4
+                             - humidDev2 * T::humidPenaltyE4
+                             - gas * T::gasPenaltyE4;
+}
+
+// 每单位气体变化的扣分（0.0001分），评分面不含气体项
+static inline int32_t gasPenaltyE4(FruitType fruit) {
+    return (int32_t)FruitDatabase::getProfileFixed(fruit).gasDecayCenti * 100;
+}
+
+// 更新读数并计算全部水果的评分（定点）
+// 环境评分查评分面（或按水果展开成常数运算），再逐个积分存放时间、扣时间衰减
+void FreshnessModel::updateReadingsFixed(int16_t temperatureX10, uint16_t humidityX10, int gasDelta) {
+    unsigned long now = clock.now();
+    int32_t temp2 = 2 * (int32_t)temperatureX10;
+    int32_t humid2 = 2 * (int32_t)humidityX10;
+    int32_t gas = gasDelta > 0 ? gasDelta : 0;
+    
+    int32_t condition[FRUIT_COUNT];
+#if FRESHNESS_SCORE_SURFACE
+    SurfaceCell cell;
+    if (ScoreSurface::locate(temperatureX10, humidityX10, cell)) {
+        for (int f = 0; f < FRUIT_COUNT; f++) {
+            condition[f] = ScoreSurface::conditionScore((FruitType)f, cell) - gas * gasPenaltyE4((FruitType)f);
+        }
+    } else
+#endif
+    {
+#define FRUIT_CONDITION(F) condition[F] = conditionScoreFixed<F>(temp2, humid2, gas);
+        FRUIT_TABLE_FOR_EACH(FRUIT_CONDITION)
+#undef FRUIT_CONDITION
+    }
+    
+    for (int f = 0; f < FRUIT_COUNT; f++) {
+        FruitType fruit = (FruitType)f;
+        shelfLife.update(fruit, temperatureX10, humidityX10, roundScore(condition[f]), now);
+        
+        uint32_t ageSeconds = shelfLife.getEquivalentAgeSeconds(fruit);
+        int32_t timeDecayCenti = FruitDatabase::getProfileFixed(fruit).timeDecayCenti;
+        scoresCenti[f] = roundScore(condition[f] - timePenalty(ageSeconds, timeDecayCenti));
+        scores[f] = scoresCenti[f] / 100.0f;
+    }
 }
 
 // 计算新鲜度评分
-float FreshnessModel::calculateScore(float temperature, float humidity, int gasDelta) {
-    float score = profile->initialScore;
+float FreshnessModel::calculateScore(float temperature, float humidity, int gasDelta, float ageHours) {
+    return scoreWithProfile(*profile, temperature, humidity, gasDelta, ageHours);
+}
+
+float FreshnessModel::scoreWithProfile(const FruitProfile& p, float temperature, float humidity,
+                                       int gasDelta, float ageHours) {
+    float score = p.initialScore;
     
-    // 1. 温度影响
-    float optimalTemp = (profile->minTemp + profile->maxTemp) / 2.0;
-    float tempDeviation = abs(temperature - optimalTemp);
-    score -= tempDeviation * profile->tempDecayCoeff;
+    // 1. 温度影响（最佳点在配置表里预先算好）
+    float tempDeviation = abs(temperature - p.optimalTemp);
+    score -= tempDeviation * p.tempDecayCoeff;
     
     // 2. 湿度影响
-    float optimalHumidity = (profile->minHumidity + profile->maxHumidity) / 2.0;
-    float humidDeviation = abs(humidity - optimalHumidity);
-    score -= humidDeviation * profile->humidDecayCoeff;
+    float humidDeviation = abs(humidity - p.optimalHumidity);
+    score -= humidDeviation * p.humidDecayCoeff;
     
     // 3. 气体影响 (只考虑正值变化)
     if (gasDelta > 0) {
-        score -= gasDelta * profile->gasDecayCoeff;
+        score -= gasDelta * p.gasDecayCoeff;
     }
     
     // 4. 时间衰减
-    float ageHours = (millis() - startTime) / 3600000.0;
-    score -= ageHours * profile->timeDecayCoeff;
+    score -= ageHours * p.timeDecayCoeff;
     
     // 限制范围 0-100
     return max(0.0f, min(100.0f, score));
 }
 
+// 计算新鲜度评分（定点，返回0.01分）
+// 各项扣分先累加成0.0001分，最后四舍五入一次
+int32_t FreshnessModel::calculateScoreFixed(int16_t temperatureX10, uint16_t humidityX10,
+                                            int gasDelta, uint32_t ageSeconds) {
+    const FruitProfileFixed* p = profileFixed;
+    int32_t penalty = 0;
+    
+    // 1. 温度影响：2倍温度和(min+max)比较，单位0.05°C，免去除以2
+    int32_t tempDev2 = 2 * (int32_t)temperatureX10 - p->tempSumX10;
+    if (tempDev2 < 0) tempDev2 = -tempDev2;
+    penalty += tempDev2 * p->tempDecayCenti * 5;
+    
+    // 2. 湿度影响
+    int32_t humidDev2 = 2 * (int32_t)humidityX10 - p->humiditySumX10;
+    if (humidDev2 < 0) humidDev2 = -humidDev2;
+    penalty += humidDev2 * p->humidDecayCenti * 5;
+    
+    // 3. 气体影响 (只考虑正值变化)
+    if (gasDelta > 0) {
+        penalty += (int32_t)gasDelta * p->gasDecayCenti * 100;
+    }
+    
+    // 4. 时间衰减
+    penalty += timePenalty(ageSeconds, p->timeDecayCenti);
+    
+    return roundScore((int32_t)p->initialScoreCenti * 100 - penalty);
+}
+
+// 计算新鲜度评分（查评分面，返回0.01分）
+// 评分面按水果数据库生成，温湿度部分总是当前水果的内置系数；网格外按公式算
+int32_t FreshnessModel::calculateScoreSurface(int16_t temperatureX10, uint16_t humidityX10,
+                                              int gasDelta, uint32_t ageSeconds) {
+    SurfaceCell cell;
+    if (!ScoreSurface::locate(temperatureX10, humidityX10, cell)) {
+        return calculateScoreFixed(temperatureX10, humidityX10, gasDelta, ageSeconds);
+    }
+    
+    int32_t score = ScoreSurface::conditionScore(currentFruit, cell);
+    if (gasDelta > 0) {
+        score -= (int32_t)gasDelta * profileFixed->gasDecayCenti * 100;
+    }
+    score -= timePenalty(ageSeconds, profileFixed->timeDecayCenti);
+    return roundScore(score);
+}
+
 // 获取当前评分
 float FreshnessModel::getScore() {
-    return currentScore;
+    return scores[currentFruit];
+}
+
+// 获取当前评分（0.01分）
+int32_t FreshnessModel::getScoreCenti() {
+    return scoresCenti[currentFruit];
+}
+
+// 获取任意一种水果的评分（不用切换）
+float FreshnessModel::getScore(FruitType fruit) {
+    return scores[fruit];
+}
+
+int32_t FreshnessModel::getScoreCenti(FruitType fruit) {
+    return scoresCenti[fruit];
 }
 
-// 计算剩余天数
+// 计算剩余天数：剩下的寿命按当前条件能放多久
 int FreshnessModel::getRemainingDays() {
-    if (currentScore <= 0) return -1;
-    
-    // 基于当前评分和预期寿命的比例
-    float ratio = currentScore / 100.0;
-    int days = (int)(ratio * profile->expectedLifeDays);
+    if (scoresCenti[currentFruit] <= 0) return -1;
     
-    return days;
+    int daysX10 = shelfLife.getRemainingDaysX10(currentFruit);
+    return (daysX10 < 0) ? -1 : daysX10 / 10;
+}
+
+// 已用寿命（千分之一）
+uint16_t FreshnessModel::getLifeUsedPermille() {
+    return (uint16_t)(shelfLife.getUsed(currentFruit) / (SHELF_LIFE_FULL / 1000));
 }
 
 // 获取新鲜度阶段
 FreshnessStage FreshnessModel::getStage() {
-    if (currentScore >= 80.0) return STAGE_VERY_FRESH;
-    if (currentScore >= 60.0) return STAGE_GOOD;
-    if (currentScore >= 40.0) return STAGE_EAT_TODAY;
+    return stageForScore(scoresCenti[currentFruit]);
+}
+
+// 按0.01分的评分分档：浮点版本也用四舍五入后的评分，不然正好40.00分
+// 在浮点里可能算成39.99999，两种实现在分界上给出不同的阶段
+FreshnessStage FreshnessModel::stageForScore(int32_t scoreCenti) {
+    if (scoreCenti >= 8000) return STAGE_VERY_FRESH;
+    if (scoreCenti >= 6000) return STAGE_GOOD;
+    if (scoreCenti >= 4000) return STAGE_EAT_TODAY;
     return STAGE_SPOILED;
 }
 
+// 扣分四舍五入到0.1分：读数和范围都是0.1的倍数，扣分本来就在0.1分上，
+// 不取整的话浮点误差会让正好是整数的结果（比如7.2×5=36）被截断少1
+static inline float storagePenalty(float deviation, int perUnit) {
+    return roundf(deviation * perUnit * 10) / 10;
+}
+
 // 计算存储环境质量评分 (⭐ 创新功能)
 int FreshnessModel::calculateStorageScore(float temperature, float humidity) {
     int score = 100;
     
     // 温度偏离评分
     if (temperature < profile->minTemp) {
-        score -= (profile->minTemp - temperature) * 5;
+        score -= storagePenalty(profile->minTemp - temperature, 5);
     } else if (temperature > profile->maxTemp) {
-        score -= (temperature - profile->maxTemp) * 5;
+        score -= storagePenalty(temperature - profile->maxTemp, 5);
     }
     
     // 湿度偏离评分
     if (humidity < profile->minHumidity) {
-        score -= (profile->minHumidity - humidity) * 2;
+        score -= storagePenalty(profile->minHumidity - humidity, 2);
     } else if (humidity > profile->maxHumidity) {
-        score -= (humidity - profile->maxHumidity) * 2;
+        score -= storagePenalty(humidity - profile->maxHumidity, 2);
     }
     
     // 限制范围 0-100
     return max(0, min(100, score));
 }
+
+// 计算存储环境质量评分（定点）
+// 每一步在0.1分上算，再像浮点版本那样向零截断成整数分
+int FreshnessModel::calculateStorageScoreFixed(int16_t temperatureX10, uint16_t humidityX10) {
+    const FruitProfileFixed* p = profileFixed;
+    int32_t score = 100;
+    
+    // 温度偏离评分
+    if (temperatureX10 < p->minTempX10) {
+        score = (score * 10 - (p->minTempX10 - temperatureX10) * 5) / 10;
+    } else if (temperatureX10 > p->maxTempX10) {
+        score = (score * 10 - (temperatureX10 - p->maxTempX10) * 5) / 10;
+    }
+    
+    // 湿度偏离评分
+    if ((int32_t)humidityX10 < p->minHumidityX10) {
+        score = (score * 10 - (p->minHumidityX10 - (int32_t)humidityX10) * 2) / 10;
+    } else if ((int32_t)humidityX10 > p->maxHumidityX10) {
+        score = (score * 10 - ((int32_t)humidityX10 - p->maxHumidityX10) * 2) / 10;
+    }
+    
+    // 限制范围 0-100
+    return max(0, min(100, (int)score));
+}
+
+// 测一次评分计算的耗时（设备上用SysTick计CPU周期）
+static uint32_t cycleStart() {
+#if defined(ARDUINO_ARCH_SAMD)
+    return SysTick->VAL;
+#else
+    return micros();
+#endif
+}
+
+static uint32_t cycleElapsed(uint32_t start) {
+#if defined(ARDUINO_ARCH_SAMD)
+    // SysTick向下计数，每毫秒从LOAD重装一次
+    uint32_t now = SysTick->VAL;
+    uint32_t reload = SysTick->LOAD + 1;
+    return (start >= now) ? start - now : start + reload - now;
+#else
+    return micros() - start;
+#endif
+}
+
+// 打印浮点/定点/评分面几种评分的耗时（每种取多组输入的最小值）
+void FreshnessModel::benchmark() {
+    static const int16_t temps[] = { 45, 185, 228, 301 };
+    static const uint16_t hums[] = { 420, 655, 880, 960 };
+    static const int gases[] = { -12, 0, 25, 140 };
+    
+    uint32_t bestFloat = 0xFFFFFFFF;
+    uint32_t bestFixed = 0xFFFFFFFF;
+    uint32_t bestSurface = 0xFFFFFFFF;
+    uint32_t bestStorageFloat = 0xFFFFFFFF;
+    uint32_t bestStorageFixed = 0xFFFFFFFF;
+    volatile int32_t sink = 0;
+    
+    for (int i = 0; i < 4; i++) {
+        float t = temps[i] / 10.0f;
+        float h = hums[i] / 10.0f;
+        
+        uint32_t start = cycleStart();
+        sink = (int32_t)calculateScore(t, h, gases[i], 12.5f);
+        uint32_t cycles = cycleElapsed(start);
+        if (cycles < bestFloat) bestFloat = cycles;
+        
+        start = cycleStart();
+        sink = calculateScoreFixed(temps[i], hums[i], gases[i], 45000);
+        cycles = cycleElapsed(start);
+        if (cycles < bestFixed) bestFixed = cycles;
+        
+        start = cycleStart();
+        sink = calculateScoreSurface(temps[i], hums[i], gases[i], 45000);
+        cycles = cycleElapsed(start);
+        if (cycles < bestSurface) bestSurface = cycles;
+        
+        start = cycleStart();
+        sink = calculateStorageScore(t, h);
+        cycles = cycleElapsed(start);
+        if (cycles < bestStorageFloat) bestStorageFloat = cycles;
+        
+        start = cycleStart();
+        sink = calculateStorageScoreFixed(temps[i], hums[i]);
+        cycles = cycleElapsed(start);
+        if (cycles < bestStorageFixed) bestStorageFixed = cycles;
+    }
+    (void)sink;
+    
+#if defined(ARDUINO_ARCH_SAMD)
+    const char* unit = " cycles";
+#else
+    const char* unit = " us";
+#endif
+    
+    Serial.print("Model score  float: ");
+    Serial.print(bestFloat);
+    Serial.print(unit);
+    Serial.print(", fixed: ");
+    Serial.print(bestFixed);
+    Serial.print(unit);
+    Serial.print(", surface: ");
+    Serial.print(bestSurface);
+    Serial.println(unit);
+    
+    Serial.print("Model storage float: ");
+    Serial.print(bestStorageFloat);
+    Serial.print(unit);
+    Serial.print(", fixed: ");
+    Serial.print(bestStorageFixed);
+    Serial.println(unit);
+}
@@ -7,6 +7,22 @@
 
 #include <Arduino.h>
 #include "fruit_profiles.h"
+#include "clock_source.h"
+#include "shelf_life.h"
+#include "score_surface.h"
+
+// 评分计算方式：1=定点（整数，0.01分），0=浮点
+// SAMD21没有FPU，浮点运算全部是软件模拟
+#ifndef FRESHNESS_FIXED_POINT
+#define FRESHNESS_FIXED_POINT 1
+#endif
+
+// 定点模型的环境评分：1=查温湿度评分面（score_surface_table.h），0=按公式算
+// 两种结果逐位相同（网格外自动按公式算）。系数已是编译期常量，公式只有几次
+// 整数乘加，比4次读flash加插值还快，所以默认不查表；耗时见benchmark()
+#ifndef FRESHNESS_SCORE_SURFACE
+#define FRESHNESS_SCORE_SURFACE 0
+#endif
 
 // 新鲜度阶段
 enum FreshnessStage {
@@ -19,24 +35,48 @@ enum FreshnessStage {
 // 新鲜度模型类
 class FreshnessModel {
 public:
-    FreshnessModel();
+    FreshnessModel(Clock& clock = SystemClock::instance());
     
     void setFruitType(FruitType type);
+    FruitType getFruitType();
+    void startNewFruit();
+    void setProfiles(const FruitProfile& profile, const FruitProfileFixed& profileFixed);
     void updateReadings(float temperature, float humidity, int gasDelta);
+    void updateReadingsFixed(int16_t temperatureX10, uint16_t humidityX10, int gasDelta);
     
     float getScore();
+    int32_t getScoreCenti();
+    float getScore(FruitType fruit);
+    int32_t getScoreCenti(FruitType fruit);
     int getRemainingDays();
+    uint16_t getLifeUsedPermille();
     FreshnessStage getStage();
+    static FreshnessStage stageForScore(int32_t scoreCenti);
     int calculateStorageScore(float temperature, float humidity);
+    int calculateStorageScoreFixed(int16_t temperatureX10, uint16_t humidityX10);
+    
+    // 给定存放时间的纯计算（两种实现对比用）
+    float calculateScore(float temperature, float humidity, int gasDelta, float ageHours);
+    int32_t calculateScoreFixed(int16_t temperatureX10, uint16_t humidityX10,
+                                int gasDelta, uint32_t ageSeconds);
+    int32_t calculateScoreSurface(int16_t temperatureX10, uint16_t humidityX10,
+                                  int gasDelta, uint32_t ageSeconds);
+    
+    void benchmark();
     
 private:
+    Clock& clock;
     FruitType currentFruit;
     const FruitProfile* profile;
+    const FruitProfileFixed* profileFixed;
     
-    float currentScore;
-    unsigned long startTime;
+    // 每次采样算出的全部水果的评分
+    float scores[FRUIT_COUNT];
+    int32_t scoresCenti[FRUIT_COUNT];
+    ShelfLifeIntegrator shelfLife;      // 存放时间按Q10积分，不再用墙上时间
     
-    float calculateScore(float temperature, float humidity, int gasDelta);
+    static float scoreWithProfile(const FruitProfile& profile, float temperature, float humidity,
+                                  int gasDelta, float ageHours);
 };
 
 #endif
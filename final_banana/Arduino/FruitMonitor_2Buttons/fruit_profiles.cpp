@@ -3,89 +3,108 @@
  */
 
 #include "fruit_profiles.h"
+#include "heap_guard.h"
 
-// 水果配置数据库 (基于科学文献)
-const FruitProfile FruitDatabase::profiles[4] = {
-    // 香蕉 (Banana) - Kader (2002)
-    {
-        .name = "Banana",
-        .emoji = "🍌",
-        .minTemp = 18.0,
-        .maxTemp = 22.0,
-        .minHumidity = 60.0,
-        .maxHumidity = 70.0,
-        .gasThreshold = 50.0,
-        .tempDecayCoeff = 3.0,
-        .humidDecayCoeff = 2.0,
-        .gasDecayCoeff = 0.15,
-        .timeDecayCoeff = 0.6,    // 每小时0.6分
-        .initialScore = 100.0,
-        .expectedLifeDays = 7
-    },
-    
-    // 橘子 (Orange) - Kader (2002)
-    {
-        .name = "Orange",
-        .emoji = "🍊",
-        .minTemp = 4.0,
-        .maxTemp = 10.0,
-        .minHumidity = 85.0,
-        .maxHumidity = 90.0,
-        .gasThreshold = 80.0,
-        .tempDecayCoeff = 2.5,
-        .humidDecayCoeff = 1.5,
-        .gasDecayCoeff = 0.08,
-        .timeDecayCoeff = 0.3,    // 每小时0.3分
-        .initialScore = 100.0,
-        .expectedLifeDays = 14
-    },
-    
-    // 苹果 (Apple) - Kader (2002)
-    {
-        .name = "Apple",
-        .emoji = "🍎",
-        .minTemp = 0.0,
-        .maxTemp = 4.0,
-        .minHumidity = 90.0,
-        .maxHumidity = 95.0,
-        .gasThreshold = 60.0,
-        .tempDecayCoeff = 2.0,
-        .humidDecayCoeff = 1.5,
-        .gasDecayCoeff = 0.10,
-        .timeDecayCoeff = 0.2,    // 每小时0.2分
-        .initialScore = 100.0,
-        .expectedLifeDays = 30
-    },
-    
-    // 葡萄 (Grape) - Kader (2002)
-    {
-        .name = "Grape",
-        .emoji = "🍇",
-        .minTemp = 0.0,
-        .maxTemp = 2.0,
-        .minHumidity = 90.0,
-        .maxHumidity = 95.0,
-        .gasThreshold = 70.0,
-        .tempDecayCoeff = 2.5,
-        .humidDecayCoeff = 2.0,
-        .gasDecayCoeff = 0.12,
-        .timeDecayCoeff = 0.8,    // 每小时0.8分
-        .initialScore = 100.0,
-        .expectedLifeDays = 10
-    }
+static constexpr int16_t roundX10(float v) { return (int16_t)(v * 10 + (v >= 0 ? 0.5f : -0.5f)); }
+static constexpr int16_t roundX100(float v) { return (int16_t)(v * 100 + (v >= 0 ? 0.5f : -0.5f)); }
+
+// 编译期检查每种水果的参数（CSV改错了直接编译失败）
+template <FruitType F>
+struct FruitProfileCheck {
+    typedef FruitTraits<F> T;
+
+    // 存储区间有意义，且在DHT22量程内
+    static_assert(T::minTemp < T::maxTemp, "minTemp must be below maxTemp");
+    static_assert(T::minHumidity < T::maxHumidity, "minHumidity must be below maxHumidity");
+    static_assert(T::minTemp >= -40 && T::maxTemp <= 80, "temperature range outside DHT22 range");
+    static_assert(T::minHumidity >= 0 && T::maxHumidity <= 100, "humidity range outside 0-100%");
+
+    // 系数非负、初始评分不超过满分、寿命在一年以内
+    static_assert(T::tempDecayCoeff >= 0 && T::humidDecayCoeff >= 0 &&
+                  T::gasDecayCoeff >= 0 && T::timeDecayCoeff >= 0, "decay coefficients must be non-negative");
+    static_assert(T::initialScore > 0 && T::initialScore <= 100, "initialScore must be in (0, 100]");
+    static_assert(T::expectedLifeDays >= 1 && T::expectedLifeDays <= 365, "expectedLifeDays must be 1-365");
+
+    // 定点值就是浮点值四舍五入
+    static_assert(T::minTempX10 == roundX10(T::minTemp) && T::maxTempX10 == roundX10(T::maxTemp) &&
+                  T::minHumidityX10 == roundX10(T::minHumidity) &&
+                  T::maxHumidityX10 == roundX10(T::maxHumidity), "fixed-point range does not match");
+    static_assert(T::tempDecayCenti == roundX100(T::tempDecayCoeff) &&
+                  T::humidDecayCenti == roundX100(T::humidDecayCoeff) &&
+                  T::gasDecayCenti == roundX100(T::gasDecayCoeff) &&
+                  T::timeDecayCenti == roundX100(T::timeDecayCoeff) &&
+                  T::initialScoreCenti == roundX100(T::initialScore), "fixed-point coefficient does not match");
+
+    // 派生常数和原始值一致
+    static_assert(T::optimalTemp == (T::minTemp + T::maxTemp) / 2 &&
+                  T::optimalHumidity == (T::minHumidity + T::maxHumidity) / 2, "optimal point does not match");
+    static_assert(T::tempSumX10 == T::minTempX10 + T::maxTempX10 &&
+                  T::humiditySumX10 == T::minHumidityX10 + T::maxHumidityX10, "range sum does not match");
+    static_assert(T::initialScoreE4 == (int32_t)T::initialScoreCenti * 100 &&
+                  T::tempPenaltyE4 == (int32_t)T::tempDecayCenti * 5 &&
+                  T::humidPenaltyE4 == (int32_t)T::humidDecayCenti * 5 &&
+                  T::gasPenaltyE4 == (int32_t)T::gasDecayCenti * 100, "penalty constant does not match");
+
+    // 定点评分的int32不会溢出：温湿度偏差最大约4000（0.05单位），气体变化最大1023
+    static_assert(T::tempDecayCenti <= 1000 && T::humidDecayCenti <= 1000 &&
+                  T::gasDecayCenti <= 1000 && T::timeDecayCenti <= 1000, "decay coefficient too large for fixed point");
 };
 
+#define FRUIT_PROFILE_CHECK(F) template struct FruitProfileCheck<F>;
+FRUIT_TABLE_FOR_EACH(FRUIT_PROFILE_CHECK)
+#undef FRUIT_PROFILE_CHECK
+
+// 水果配置数据库 (基于科学文献，数值见 tools/fruit_profiles.csv)
+#define FRUIT_PROFILE_ENTRY(F) \
+    { FruitTraits<F>::name, FruitTraits<F>::emoji, \
+      FruitTraits<F>::minTemp, FruitTraits<F>::maxTemp, \
+      FruitTraits<F>::minHumidity, FruitTraits<F>::maxHumidity, \
+      FruitTraits<F>::gasThreshold, \
+      FruitTraits<F>::tempDecayCoeff, FruitTraits<F>::humidDecayCoeff, \
+      FruitTraits<F>::gasDecayCoeff, FruitTraits<F>::timeDecayCoeff, \
+      FruitTraits<F>::initialScore, FruitTraits<F>::expectedLifeDays, \
+      FruitTraits<F>::optimalTemp, FruitTraits<F>::optimalHumidity },
+
+const FruitProfile FruitDatabase::profiles[FRUIT_COUNT] = {
+    FRUIT_TABLE_FOR_EACH(FRUIT_PROFILE_ENTRY)
+};
+#undef FRUIT_PROFILE_ENTRY
+
+// 定点系数（与上表相同的数值，温湿度×10，系数×100）
+#define FRUIT_PROFILE_FIXED_ENTRY(F) \
+    { FruitTraits<F>::minTempX10, FruitTraits<F>::maxTempX10, \
+      FruitTraits<F>::minHumidityX10, FruitTraits<F>::maxHumidityX10, \
+      FruitTraits<F>::tempDecayCenti, FruitTraits<F>::humidDecayCenti, \
+      FruitTraits<F>::gasDecayCenti, FruitTraits<F>::timeDecayCenti, \
+      FruitTraits<F>::initialScoreCenti, FruitTraits<F>::expectedLifeDays, \
+      FruitTraits<F>::tempSumX10, FruitTraits<F>::humiditySumX10 },
+
+const FruitProfileFixed FruitDatabase::profilesFixed[FRUIT_COUNT] = {
+    FRUIT_TABLE_FOR_EACH(FRUIT_PROFILE_FIXED_ENTRY)
+};
+#undef FRUIT_PROFILE_FIXED_ENTRY
+
+// 越界的类型按香蕉处理（枚举值可能来自按键计数或回放日志）
+static inline FruitType checkedType(FruitType type) {
+    return ((unsigned)type < FRUIT_COUNT) ? type : FRUIT_BANANA;
+}
+
 // 获取水果配置
 const FruitProfile& FruitDatabase::getProfile(FruitType type) {
-    return profiles[type];
+    return profiles[checkedType(type)];
+}
+
+// 获取定点水果配置
+const FruitProfileFixed& FruitDatabase::getProfileFixed(FruitType type) {
+    return profilesFixed[checkedType(type)];
 }
 
 // 获取水果名称
-String FruitDatabase::getTypeName(FruitType type) {
-    return String(profiles[type].name);
+const char* FruitDatabase::getTypeName(FruitType type) {
+    return profiles[checkedType(type)].name;
 }
 
 // 获取水果表情
-String FruitDatabase::getEmoji(FruitType type) {
-    return String(profiles[type].emoji);
+const char* FruitDatabase::getEmoji(FruitType type) {
+    return profiles[checkedType(type)].emoji;
 }
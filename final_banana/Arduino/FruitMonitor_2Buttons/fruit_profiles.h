@@ -1,20 +1,16 @@
 /*
  * Fruit Profiles - 水果参数配置
  * 基于科学文献的水果存储标准
+ *
+ * 参数写在 tools/fruit_profiles.csv，由 tools/gen_fruit_profiles.py 生成
+ * fruit_profiles_table.h 的编译期常量，这里的运行时表由它展开。
  */
 
 #ifndef FRUIT_PROFILES_H
 #define FRUIT_PROFILES_H
 
 #include <Arduino.h>
-
-// 水果类型枚举
-enum FruitType {
-    FRUIT_BANANA = 0,   // 香蕉
-    FRUIT_ORANGE = 1,   // 橘子
-    FRUIT_APPLE = 2,    // 苹果
-    FRUIT_GRAPE = 3     // 葡萄
-};
+#include "fruit_profiles_table.h"    // FruitType、FRUIT_COUNT、FruitTraits<F>（由CSV生成）
 
 // 水果配置参数结构
 struct FruitProfile {
@@ -39,17 +35,43 @@ struct FruitProfile {
     // 初始评分和预期寿命
     float initialScore;         // 初始评分
     int expectedLifeDays;       // 预期寿命 (天)
+    
+    // 预先算好的最佳点
+    float optimalTemp;          // (minTemp + maxTemp) / 2
+    float optimalHumidity;      // (minHumidity + maxHumidity) / 2
+};
+
+// 定点版本的系数（整数，和FruitProfile一一对应，由FRESHNESS_FIXED_POINT模型使用）
+struct FruitProfileFixed {
+    int16_t minTempX10;         // 最低温度 (0.1°C)
+    int16_t maxTempX10;         // 最高温度 (0.1°C)
+    int16_t minHumidityX10;     // 最低湿度 (0.1%)
+    int16_t maxHumidityX10;     // 最高湿度 (0.1%)
+    
+    int16_t tempDecayCenti;     // 温度衰减系数 ×100
+    int16_t humidDecayCenti;    // 湿度衰减系数 ×100
+    int16_t gasDecayCenti;      // 气体衰减系数 ×100
+    int16_t timeDecayCenti;     // 时间衰减系数 ×100 (分/小时)
+    
+    int16_t initialScoreCenti;  // 初始评分 ×100
+    int16_t expectedLifeDays;   // 预期寿命 (天)
+    
+    // 预先算好的温湿度和（和2倍读数比较，免去除以2）
+    int16_t tempSumX10;         // minTempX10 + maxTempX10
+    int16_t humiditySumX10;     // minHumidityX10 + maxHumidityX10
 };
 
 // 水果数据库类
 class FruitDatabase {
 public:
     static const FruitProfile& getProfile(FruitType type);
-    static String getTypeName(FruitType type);
-    static String getEmoji(FruitType type);
+    static const FruitProfileFixed& getProfileFixed(FruitType type);
+    static const char* getTypeName(FruitType type);   // 常量字符串，不占堆
+    static const char* getEmoji(FruitType type);
     
 private:
-    static const FruitProfile profiles[4];
+    static const FruitProfile profiles[FRUIT_COUNT];
+    static const FruitProfileFixed profilesFixed[FRUIT_COUNT];
 };
 
 #endif
@@ -0,0 +1,183 @@
+/*
+ * Fruit Profile Table - 水果参数常量表
+ * 由 tools/gen_fruit_profiles.py 根据 tools/fruit_profiles.csv 生成，请勿手动修改
+ */
+
+#ifndef FRUIT_PROFILES_TABLE_H
+#define FRUIT_PROFILES_TABLE_H
+
+#include <stdint.h>
+
+// 水果类型枚举
+enum FruitType {
+    FRUIT_BANANA = 0,     // Banana
+    FRUIT_ORANGE = 1,     // Orange
+    FRUIT_APPLE = 2,      // Apple
+    FRUIT_GRAPE = 3       // Grape
+};
+
+#define FRUIT_COUNT 4
+
+// 按枚举顺序对每种水果展开一次 X(type)
+#define FRUIT_TABLE_FOR_EACH(X) \
+    X(FRUIT_BANANA) \
+    X(FRUIT_ORANGE) \
+    X(FRUIT_APPLE) \
+    X(FRUIT_GRAPE)
+
+// 每种水果的编译期常量（只按值使用，不要取地址或绑定到引用）
+template <FruitType F> struct FruitTraits;
+
+template <> struct FruitTraits<FRUIT_BANANA> {
+    // 原始参数
+    static constexpr const char* name = "Banana";
+    static constexpr const char* emoji = "🍌";
+    static constexpr float minTemp = 18.0f;         // °C
+    static constexpr float maxTemp = 22.0f;         // °C
+    static constexpr float minHumidity = 60.0f;     // %
+    static constexpr float maxHumidity = 70.0f;     // %
+    static constexpr float gasThreshold = 50.0f;
+    static constexpr float tempDecayCoeff = 3.0f;   // 分/°C
+    static constexpr float humidDecayCoeff = 2.0f;  // 分/%
+    static constexpr float gasDecayCoeff = 0.15f;   // 分/单位气体变化
+    static constexpr float timeDecayCoeff = 0.6f;   // 分/小时
+    static constexpr float initialScore = 100.0f;
+    static constexpr int expectedLifeDays = 7;      // 天
+
+    // 定点参数（四舍五入）
+    static constexpr int16_t minTempX10 = 180;           // 0.1°C
+    static constexpr int16_t maxTempX10 = 220;           // 0.1°C
+    static constexpr int16_t minHumidityX10 = 600;       // 0.1%
+    static constexpr int16_t maxHumidityX10 = 700;       // 0.1%
+    static constexpr int16_t tempDecayCenti = 300;       // ×100
+    static constexpr int16_t humidDecayCenti = 200;      // ×100
+    static constexpr int16_t gasDecayCenti = 15;         // ×100
+    static constexpr int16_t timeDecayCenti = 60;        // ×100
+    static constexpr int16_t initialScoreCenti = 10000;  // ×100
+
+    // 派生常数
+    static constexpr float optimalTemp = 20.0f;         // (min+max)/2
+    static constexpr float optimalHumidity = 65.0f;     // (min+max)/2
+    static constexpr int16_t tempSumX10 = 400;          // min+max (0.1°C)
+    static constexpr int16_t humiditySumX10 = 1300;     // min+max (0.1%)
+    static constexpr int32_t initialScoreE4 = 1000000;  // 初始评分 (0.0001分)
+    static constexpr int32_t tempPenaltyE4 = 1500;      // 每0.05°C偏差扣分 (0.0001分)
+    static constexpr int32_t humidPenaltyE4 = 1000;     // 每0.05%偏差扣分 (0.0001分)
+    static constexpr int32_t gasPenaltyE4 = 1500;       // 每单位气体变化扣分 (0.0001分)
+};
+
+template <> struct FruitTraits<FRUIT_ORANGE> {
+    // 原始参数
+    static constexpr const char* name = "Orange";
+    static constexpr const char* emoji = "🍊";
+    static constexpr float minTemp = 4.0f;          // °C
+    static constexpr float maxTemp = 10.0f;         // °C
+    static constexpr float minHumidity = 85.0f;     // %
+    static constexpr float maxHumidity = 90.0f;     // %
+    static constexpr float gasThreshold = 80.0f;
+    static constexpr float tempDecayCoeff = 2.5f;   // 分/°C
+    static constexpr float humidDecayCoeff = 1.5f;  // 分/%
+    static constexpr float gasDecayCoeff = 0.08f;   // 分/单位气体变化
+    static constexpr float timeDecayCoeff = 0.3f;   // 分/小时
+    static constexpr float initialScore = 100.0f;
+    static constexpr int expectedLifeDays = 14;     // 天
+
+    // 定点参数（四舍五入）
+    static constexpr int16_t minTempX10 = 40;            // 0.1°C
+    static constexpr int16_t maxTempX10 = 100;           // 0.1°C
+    static constexpr int16_t minHumidityX10 = 850;       // 0.1%
+    static constexpr int16_t maxHumidityX10 = 900;       // 0.1%
+    static constexpr int16_t tempDecayCenti = 250;       // ×100
+    static constexpr int16_t humidDecayCenti = 150;      // ×100
+    static constexpr int16_t gasDecayCenti = 8;          // ×100
+    static constexpr int16_t timeDecayCenti = 30;        // ×100
+    static constexpr int16_t initialScoreCenti = 10000;  // ×100
+
+    // 派生常数
+    static constexpr float optimalTemp = 7.0f;          // (min+max)/2
+    static constexpr float optimalHumidity = 87.5f;     // (min+max)/2
+    static constexpr int16_t tempSumX10 = 140;          // min+max (0.1°C)
+    static constexpr int16_t humiditySumX10 = 1750;     // min+max (0.1%)
+    static constexpr int32_t initialScoreE4 = 1000000;  // 初始评分 (0.0001分)
+    static constexpr int32_t tempPenaltyE4 = 1250;      // 每0.05°C偏差扣分 (0.0001分)
+    static constexpr int32_t humidPenaltyE4 = 750;      // 每0.05%偏差扣分 (0.0001分)
+    static constexpr int32_t gasPenaltyE4 = 800;        // 每单位气体变化扣分 (0.0001分)
+};
+
+template <> struct FruitTraits<FRUIT_APPLE> {
+    // 原始参数
+    static constexpr const char* name = "Apple";
+    static constexpr const char* emoji = "🍎";
+    static constexpr float minTemp = 0.0f;          // °C
+    static constexpr float maxTemp = 4.0f;          // °C
+    static constexpr float minHumidity = 90.0f;     // %
+    static constexpr float maxHumidity = 95.0f;     // %
+    static constexpr float gasThreshold = 60.0f;
+    static constexpr float tempDecayCoeff = 2.0f;   // 分/°C
+    static constexpr float humidDecayCoeff = 1.5f;  // 分/%
+    static constexpr float gasDecayCoeff = 0.10f;   // 分/单位气体变化
+    static constexpr float timeDecayCoeff = 0.2f;   // 分/小时
+    static constexpr float initialScore = 100.0f;
+    static constexpr int expectedLifeDays = 30;     // 天
+
+    // 定点参数（四舍五入）
+    static constexpr int16_t minTempX10 = 0;             // 0.1°C
+    static constexpr int16_t maxTempX10 = 40;            // 0.1°C
+    static constexpr int16_t minHumidityX10 = 900;       // 0.1%
+    static constexpr int16_t maxHumidityX10 = 950;       // 0.1%
+    static constexpr int16_t tempDecayCenti = 200;       // ×100
+    static constexpr int16_t humidDecayCenti = 150;      // ×100
+    static constexpr int16_t gasDecayCenti = 10;         // ×100
+    static constexpr int16_t timeDecayCenti = 20;        // ×100
+    static constexpr int16_t initialScoreCenti = 10000;  // ×100
+
+    // 派生常数
+    static constexpr float optimalTemp = 2.0f;          // (min+max)/2
+    static constexpr float optimalHumidity = 92.5f;     // (min+max)/2
+    static constexpr int16_t tempSumX10 = 40;           // min+max (0.1°C)
+    static constexpr int16_t humiditySumX10 = 1850;     // min+max (0.1%)
+    static constexpr int32_t initialScoreE4 = 1000000;  // 初始评分 (0.0001分)
+    static constexpr int32_t tempPenaltyE4 = 1000;      // 每0.05°C偏差扣分 (0.0001分)
+    static constexpr int32_t humidPenaltyE4 = 750;      // 每0.05%偏差扣分 (0.0001分)
+    static constexpr int32_t gasPenaltyE4 = 1000;       // 每单位气体变化扣分 (0.0001分)
+};
+
+template <> struct FruitTraits<FRUIT_GRAPE> {
+    // 原始参数
+    static constexpr const char* name = "Grape";
+    static constexpr const char* emoji = "🍇";
+    static constexpr float minTemp = 0.0f;          // °C
+    static constexpr float maxTemp = 2.0f;          // °C
+    static constexpr float minHumidity = 90.0f;     // %
+    static constexpr float maxHumidity = 95.0f;     // %
+    static constexpr float gasThreshold = 70.0f;
+    static constexpr float tempDecayCoeff = 2.5f;   // 分/°C
+    static constexpr float humidDecayCoeff = 2.0f;  // 分/%
+    static constexpr float gasDecayCoeff = 0.12f;   // 分/单位气体变化
+    static constexpr float timeDecayCoeff = 0.8f;   // 分/小时
+    static constexpr float initialScore = 100.0f;
+    static constexpr int expectedLifeDays = 10;     // 天
+
+    // 定点参数（四舍五入）
+    static constexpr int16_t minTempX10 = 0;             // 0.1°C
+    static constexpr int16_t maxTempX10 = 20;            // 0.1°C
+    static constexpr int16_t minHumidityX10 = 900;       // 0.1%
+    static constexpr int16_t maxHumidityX10 = 950;       // 0.1%
+    static constexpr int16_t tempDecayCenti = 250;       // ×100
+    static constexpr int16_t humidDecayCenti = 200;      // ×100
+    static constexpr int16_t gasDecayCenti = 12;         // ×100
+    static constexpr int16_t timeDecayCenti = 80;        // ×100
+    static constexpr int16_t initialScoreCenti = 10000;  // ×100
+
+    // 派生常数
+    static constexpr float optimalTemp = 1.0f;          // (min+max)/2
+    static constexpr float optimalHumidity = 92.5f;     // (min+max)/2
+    static constexpr int16_t tempSumX10 = 20;           // min+max (0.1°C)
+    static constexpr int16_t humiditySumX10 = 1850;     // min+max (0.1%)
+    static constexpr int32_t initialScoreE4 = 1000000;  // 初始评分 (0.0001分)
+    static constexpr int32_t tempPenaltyE4 = 1250;      // 每0.05°C偏差扣分 (0.0001分)
+    static constexpr int32_t humidPenaltyE4 = 1000;     // 每0.05%偏差扣分 (0.0001分)
+    static constexpr int32_t gasPenaltyE4 = 1200;       // 每单位气体变化扣分 (0.0001分)
+};
+
+#endif
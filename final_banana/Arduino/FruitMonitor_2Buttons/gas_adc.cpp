@@ -0,0 +1,149 @@
+/*
+ * Gas ADC Implementation
+ */
+
+#include "gas_adc.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#include <wiring_private.h>
+#include "samd_dma.h"
+
+volatile uint16_t GasADC::ring[GAS_ADC_RING_SIZE];
+int8_t GasADC::dmaChannel = -1;
+unsigned long GasADC::startTime = 0;
+bool GasADC::ringFull = false;
+
+// 初始化（失败时返回false，调用者退回analogRead）
+bool GasADC::begin(uint8_t pin) {
+    dmaChannel = DMAController::allocateChannel();
+    if (dmaChannel < 0) return false;
+
+    setupADC(pin);
+    setupDMA();
+    setupEventSystem();
+    setupTimer();
+
+    startTime = millis();
+    ringFull = false;
+    return true;
+}
+
+// ADC：12位累加平均，事件触发开始转换
+// 参考电压和增益保持Arduino默认（VDDANA/2，增益1/2），结果和analogRead()同一量程
+void GasADC::setupADC(uint8_t pin) {
+    pinPeripheral(pin, PIO_ANALOG);
+
+    ADC->CTRLA.bit.ENABLE = 0;
+    while (ADC->STATUS.bit.SYNCBUSY);
+
+    ADC->REFCTRL.reg = ADC_REFCTRL_REFSEL_INTVCC1;
+    ADC->INPUTCTRL.reg = ADC_INPUTCTRL_MUXPOS(g_APinDescription[pin].ulADCChannelNumber) |
+                         ADC_INPUTCTRL_MUXNEG_GND |
+                         ADC_INPUTCTRL_GAIN_DIV2;
+    while (ADC->STATUS.bit.SYNCBUSY);
+
+    // 累加需要16位结果模式；16次累加右移4位 = 12位平均
+    ADC->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_16 | ADC_AVGCTRL_ADJRES(4);
+    ADC->SAMPCTRL.reg = ADC_SAMPCTRL_SAMPLEN(5);     // MQ-135分压电阻较大，加长采样时间
+    ADC->CTRLB.reg = ADC_CTRLB_PRESCALER_DIV256 | ADC_CTRLB_RESSEL_16BIT;
+    while (ADC->STATUS.bit.SYNCBUSY);
+
+    ADC->EVCTRL.reg = ADC_EVCTRL_STARTEI;
+    ADC->CTRLA.bit.ENABLE = 1;
+    while (ADC->STATUS.bit.SYNCBUSY);
+}
+
+// DMA：每个RESRDY搬一个半字，描述符首尾相接成环
+void GasADC::setupDMA() {
+    DmacDescriptor* desc = DMAController::descriptor(dmaChannel);
+
+    desc->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                       DMAC_BTCTRL_BEATSIZE_HWORD |
+                       DMAC_BTCTRL_DSTINC |
+                       DMAC_BTCTRL_BLOCKACT_NOACT;
+    desc->BTCNT.reg = GAS_ADC_RING_SIZE;
+    desc->SRCADDR.reg = (uint32_t)&ADC->RESULT.reg;
+    // 目的地址递增时，DSTADDR填的是结束地址
+    desc->DSTADDR.reg = (uint32_t)ring + sizeof(ring);
+    desc->DESCADDR.reg = (uint32_t)desc;
+
+    DMAController::start(dmaChannel, ADC_DMAC_ID_RESRDY, DMAC_CHCTRLB_TRIGACT_BEAT);
+}
+
+// EVSYS通道0：TC3溢出 -> ADC START
+void GasADC::setupEventSystem() {
+    PM->APBCMASK.reg |= PM_APBCMASK_EVSYS;
+
+    // 用户的通道号要+1
+    EVSYS->USER.reg = EVSYS_USER_CHANNEL(1) | EVSYS_USER_USER(EVSYS_ID_USER_ADC_START);
+    EVSYS->CHANNEL.reg = EVSYS_CHANNEL_CHANNEL(0) |
+                         EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_TC3_OVF) |
+                         EVSYS_CHANNEL_PATH_ASYNCHRONOUS |
+                         EVSYS_CHANNEL_EDGSEL_NO_EVT_OUTPUT;
+}
+
+// TC3: 48MHz / 1024 = 46875Hz，计到GAS_ADC_RATE_HZ溢出并输出事件
+void GasADC::setupTimer() {
+    GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID_TCC2_TC3 | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_CLKEN;
+    while (GCLK->STATUS.bit.SYNCBUSY);
+
+    PM->APBCMASK.reg |= PM_APBCMASK_TC3;
+
+    TC3->COUNT16.CTRLA.reg = TC_CTRLA_SWRST;
+    while (TC3->COUNT16.CTRLA.bit.SWRST);
+
+    TC3->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 |
+                             TC_CTRLA_WAVEGEN_MFRQ |
+                             TC_CTRLA_PRESCALER_DIV1024;
+    TC3->COUNT16.CC[0].reg = 46875 / GAS_ADC_RATE_HZ - 1;
+    TC3->COUNT16.EVCTRL.reg = TC_EVCTRL_OVFEO;
+    while (TC3->COUNT16.STATUS.bit.SYNCBUSY);
+
+    TC3->COUNT16.CTRLA.reg |= TC_CTRLA_ENABLE;
+    while (TC3->COUNT16.STATUS.bit.SYNCBUSY);
+}
+
+bool GasADC::isReady() {
+    return filledSamples() >= GAS_ADC_RING_SIZE;
+}
+
+// 启动后已写入的样本数（写满一圈后恒为GAS_ADC_RING_SIZE）
+// 写满后记下来，不再用millis()换算：运行时间乘以频率会溢出
+uint16_t GasADC::filledSamples() {
+    if (dmaChannel < 0) return 0;
+    if (ringFull) return GAS_ADC_RING_SIZE;
+
+    unsigned long elapsed = millis() - startTime;
+    if (elapsed >= GAS_ADC_RING_SIZE * 1000UL / GAS_ADC_RATE_HZ) {
+        ringFull = true;
+        return GAS_ADC_RING_SIZE;
+    }
+    return elapsed * GAS_ADC_RATE_HZ / 1000;
+}
+
+// 归约环形缓冲（刚启动时只归约已写入的部分）
+// DMA同时在写，半字写入是原子的，最多混入一个新样本
+bool GasADC::read(GasStats& stats) {
+    uint16_t count = filledSamples();
+    if (count == 0) return false;
+
+    uint32_t sum = 0;
+    uint16_t lo = 0xFFFF;
+    uint16_t hi = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t v = ring[i];
+        sum += v;
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+
+    // 12位 -> 10位（四舍五入）
+    stats.mean = (sum + count * 2) / (count * 4);
+    stats.min = lo >> 2;
+    stats.max = hi >> 2;
+    return true;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Gas ADC - MQ-135过采样采集
+ *
+ * TC3按固定频率溢出，经EVSYS触发ADC开始转换；
+ * ADC每次触发硬件累加16次取平均（AVGCTRL），得到12位结果，
+ * RESRDY触发DMA写入环形缓冲（描述符指向自己，循环写）。
+ * 每次转换CPU都不参与，读取时把整个缓冲归约成均值/最小/最大。
+ */
+
+#ifndef GAS_ADC_H
+#define GAS_ADC_H
+
+#include <Arduino.h>
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#define GAS_ADC_RATE_HZ     128     // 触发频率（每次16倍过采样）
+#define GAS_ADC_RING_SIZE   256     // 256 / 128Hz = 2秒，正好一个采样周期
+
+// 一个窗口的统计（10位单位，和analogRead()一致，阈值不用改）
+struct GasStats {
+    int mean;
+    int min;
+    int max;
+};
+
+// 过采样气体采集类
+class GasADC {
+public:
+    static bool begin(uint8_t pin);
+    static bool isReady();              // 环形缓冲已写满一圈
+    static bool read(GasStats& stats);  // 归约最近一个窗口
+
+private:
+    static volatile uint16_t ring[GAS_ADC_RING_SIZE];
+    static int8_t dmaChannel;
+    static unsigned long startTime;
+    static bool ringFull;               // 写满过一圈（之后一直是满的）
+
+    static uint16_t filledSamples();
+    static void setupADC(uint8_t pin);
+    static void setupTimer();
+    static void setupEventSystem();
+    static void setupDMA();
+};
+
+#endif
+
+#endif
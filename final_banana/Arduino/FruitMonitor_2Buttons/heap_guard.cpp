@@ -0,0 +1,77 @@
+/*
+ * Heap Guard Implementation
+ */
+
+#include <errno.h>
+#include "heap_guard.h"
+
+#define HEAP_GUARD_STACK_MARGIN  1024   // 堆顶和栈之间至少留的字节数
+
+static bool sealed = false;
+static uint32_t heapSize = 0;
+static uint32_t sealedHeapSize = 0;
+static uint32_t lateGrowths = 0;
+
+#if FIRMWARE_NO_HEAP && defined(ARDUINO_ARCH_SAMD)
+
+// 链接脚本里.bss之后的第一个地址，也就是堆的起点
+extern "C" char end;
+
+// 替换newlib(nosys)的_sbrk：malloc要更多内存时调用
+extern "C" void* _sbrk(ptrdiff_t increment) {
+    static char* heapTop = &end;
+    char stackMarker;
+
+    if (heapTop + increment > &stackMarker - HEAP_GUARD_STACK_MARGIN) {
+        errno = ENOMEM;
+        return (void*)-1;
+    }
+
+    char* previous = heapTop;
+    heapTop += increment;
+    heapSize += increment;
+    if (sealed && increment > 0) lateGrowths++;
+    return previous;
+}
+
+#endif
+
+void HeapGuard::seal() {
+    sealed = true;
+    sealedHeapSize = heapSize;
+}
+
+bool HeapGuard::isSealed() {
+    return sealed;
+}
+
+uint32_t HeapGuard::getHeapSize() {
+    return heapSize;
+}
+
+uint32_t HeapGuard::getGrowthAfterSeal() {
+    return sealed ? heapSize - sealedHeapSize : 0;
+}
+
+uint32_t HeapGuard::getLateGrowths() {
+    return lateGrowths;
+}
+
+void HeapGuard::printStats() {
+#if !(FIRMWARE_NO_HEAP && defined(ARDUINO_ARCH_SAMD))
+    Serial.println("Heap: not tracked");
+    return;
+#endif
+    Serial.print("Heap: ");
+    Serial.print(heapSize);
+    Serial.print(" bytes");
+    if (!sealed) {
+        Serial.println(" (not sealed)");
+        return;
+    }
+    Serial.print(", grew ");
+    Serial.print(getGrowthAfterSeal());
+    Serial.print(" bytes in ");
+    Serial.print(lateGrowths);
+    Serial.println(lateGrowths == 0 ? " calls after startup ✅" : " calls after startup ⚠️");
+}
@@ -0,0 +1,36 @@
+/*
+ * Heap Guard - 无堆模式检查
+ *
+ * 设备要连续跑几周，32KB内存上反复分配释放会把堆切碎。
+ * FIRMWARE_NO_HEAP=1时：
+ *   1. 本项目源文件在所有#include之后包含本文件，之后再写String/malloc直接编译失败
+ *   2. 替换newlib的_sbrk，启动完成后seal()，之后堆再增长就记下来（'t'命令打印）
+ * 库（MKRWAN的AT命令解析用String）仍可以复用已释放的块；
+ * 只有堆真正变大才算违规，不拒绝分配，避免把LoRa弄坏。
+ */
+
+#ifndef HEAP_GUARD_H
+#define HEAP_GUARD_H
+
+#include <Arduino.h>
+
+#ifndef FIRMWARE_NO_HEAP
+#define FIRMWARE_NO_HEAP 1
+#endif
+
+class HeapGuard {
+public:
+    static void seal();                     // 启动完成：之后堆不应再增长
+    static bool isSealed();
+    static uint32_t getHeapSize();          // 当前堆大小（字节）
+    static uint32_t getGrowthAfterSeal();   // seal()之后堆增长的字节数
+    static uint32_t getLateGrowths();       // seal()之后堆增长的次数
+    static void printStats();
+};
+
+#endif
+
+// 不受头文件保护：每个包含它的源文件都在这之后禁用堆分配
+#if FIRMWARE_NO_HEAP
+#pragma GCC poison String malloc calloc realloc strdup
+#endif
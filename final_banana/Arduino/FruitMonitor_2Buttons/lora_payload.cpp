@@ -0,0 +1,47 @@
+/*
+ * LoRa Payload Implementation
+ */
+
+#include "lora_payload.h"
+
+// 把一个快照编码成上传数据，返回字节数
+uint8_t LoRaPayload::pack(const Snapshot& snapshot, uint8_t* payload) {
+    const SensorData& data = snapshot.data;
+    
+    payload[0] = (uint8_t)snapshot.fruit;
+    
+    int16_t temp = (int16_t)(data.temperature * 100);
+    payload[1] = (temp >> 8) & 0xFF;
+    payload[2] = temp & 0xFF;
+    
+    uint16_t humid = (uint16_t)(data.humidity * 100);
+    payload[3] = (humid >> 8) & 0xFF;
+    payload[4] = humid & 0xFF;
+    
+    payload[5] = (data.gasRaw >> 8) & 0xFF;
+    payload[6] = data.gasRaw & 0xFF;
+    
+    int16_t delta = (int16_t)data.gasDelta;
+    payload[7] = (delta >> 8) & 0xFF;
+    payload[8] = delta & 0xFF;
+    
+    payload[9] = (uint8_t)snapshot.score;
+    
+    int remainDays = snapshot.remainDays;
+    payload[10] = (uint8_t)(remainDays < 0 ? 255 : remainDays);
+    
+    payload[11] = (uint8_t)snapshot.stage;
+    
+    unsigned long ageHours = snapshot.timestamp / 3600000;
+    payload[12] = (uint8_t)(ageHours > 255 ? 255 : ageHours);
+    
+    const SpoilProjection& spoil = snapshot.spoil;
+    payload[13] = (spoil.hours >> 8) & 0xFF;
+    payload[14] = spoil.hours & 0xFF;
+    payload[15] = (spoil.lowHours >> 8) & 0xFF;
+    payload[16] = spoil.lowHours & 0xFF;
+    payload[17] = (spoil.highHours >> 8) & 0xFF;
+    payload[18] = spoil.highHours & 0xFF;
+    
+    return LORA_PAYLOAD_SIZE;
+}
@@ -0,0 +1,33 @@
+/*
+ * LoRa Payload - 上传数据编码
+ *
+ * 19字节格式（大端）：
+ *   [0]     水果类型
+ *   [1-2]   温度 ×100 (int16)
+ *   [3-4]   湿度 ×100 (uint16)
+ *   [5-6]   气体原始值
+ *   [7-8]   气体变化量 (int16)
+ *   [9]     评分
+ *   [10]    剩余天数（255=已过期）
+ *   [11]    新鲜度阶段
+ *   [12]    运行小时数（最大255）
+ *   [13-14] 预计多久变坏（小时，0xFFFF=评分没有下降）
+ *   [15-16] 区间下限（小时）
+ *   [17-18] 区间上限（小时）
+ */
+
+#ifndef LORA_PAYLOAD_H
+#define LORA_PAYLOAD_H
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+#define LORA_PAYLOAD_SIZE  19
+
+// 上传数据编码类
+class LoRaPayload {
+public:
+    static uint8_t pack(const Snapshot& snapshot, uint8_t* payload);
+};
+
+#endif
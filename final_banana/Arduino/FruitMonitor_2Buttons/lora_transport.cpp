@@ -0,0 +1,99 @@
+/*
+ * LoRa Transport Implementation
+ */
+
+#include "lora_transport.h"
+
+LoRaTransport::LoRaTransport(Stream& stream) : stream(stream) {
+    state = STATE_IDLE;
+    currentPort = -1;
+    data = NULL;
+    size = 0;
+    confirmed = false;
+    lineLength = 0;
+}
+
+bool LoRaTransport::start(uint8_t port, const uint8_t* frame, uint8_t frameSize, bool confirmFrame) {
+    if (state != STATE_IDLE) return false;
+
+    // 丢掉上一次留下的回应
+    while (stream.available()) stream.read();
+    lineLength = 0;
+
+    data = frame;
+    size = frameSize;
+    confirmed = confirmFrame;
+
+    if (port != currentPort) {
+        stream.print("AT+PORT=");
+        stream.print(port);
+        stream.print(LORA_AT_NL);
+        currentPort = port;
+        state = STATE_PORT;
+    } else {
+        sendPayload();
+    }
+    return true;
+}
+
+void LoRaTransport::sendPayload() {
+    stream.print(confirmed ? "AT+CTX " : "AT+UTX ");
+    stream.print(size);
+    stream.print(LORA_AT_NL);
+    stream.write(data, size);
+    state = STATE_SEND;
+}
+
+// 读到一整行返回true（不阻塞，没读完的字符留到下次）
+bool LoRaTransport::readLine() {
+    while (stream.available()) {
+        char c = (char)stream.read();
+        if (c == '\r' || c == '\n') {
+            if (lineLength == 0) continue;
+            line[lineLength] = '\0';
+            lineLength = 0;
+            return true;
+        }
+        if (lineLength < LORA_LINE_SIZE - 1) line[lineLength++] = c;
+    }
+    return false;
+}
+
+TransportStatus LoRaTransport::poll() {
+    if (state == STATE_IDLE) return TRANSPORT_FAILED;
+
+    while (readLine()) {
+        if (strncmp(line, "+ERR", 4) == 0 || strcmp(line, "+NOACK") == 0) {
+            // 端口可能没设上，下次重新设置
+            if (state == STATE_PORT) currentPort = -1;
+            state = STATE_IDLE;
+            return TRANSPORT_FAILED;
+        }
+
+        if (strcmp(line, "+OK") == 0) {
+            if (state == STATE_PORT) {
+                sendPayload();
+            } else if (state == STATE_SEND) {
+                if (!confirmed) {
+                    state = STATE_IDLE;
+                    return TRANSPORT_DONE;
+                }
+                state = STATE_ACK;
+            }
+        } else if (strcmp(line, "+ACK") == 0 && state == STATE_ACK) {
+            state = STATE_IDLE;
+            return TRANSPORT_DONE;
+        }
+    }
+    return TRANSPORT_BUSY;
+}
+
+void LoRaTransport::abort() {
+    if (state == STATE_PORT) currentPort = -1;
+    state = STATE_IDLE;
+    lineLength = 0;
+}
+
+void LoRaTransport::resetPort() {
+    currentPort = -1;
+}
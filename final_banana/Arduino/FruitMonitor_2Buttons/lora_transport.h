@@ -0,0 +1,59 @@
+/*
+ * LoRa Transport - Murata模块的非阻塞发送
+ *
+ * MKRWAN的endPacket()写完AT命令后一直等模块回应（确认帧要等到接收
+ * 窗口结束），整个loop()停几秒。这里直接往模块串口写同样的AT命令
+ * （AT+PORT、AT+UTX/AT+CTX），之后每次poll()只读已经到达的字符，
+ * 按行解析回应：
+ *   +OK      命令被接受（非确认帧到这里就算发出）
+ *   +ACK     确认帧收到ACK
+ *   +NOACK   确认帧没收到ACK
+ *   +ERR...  模块报错（忙、占空比限制、载荷太长……）
+ * 其他行（事件通知等）忽略。
+ *
+ * 发送期间不要再调用modem的其他方法，它们会读走这里等的回应。
+ */
+
+#ifndef LORA_TRANSPORT_H
+#define LORA_TRANSPORT_H
+
+#include <Arduino.h>
+#include "uplink_queue.h"
+
+#define LORA_LINE_SIZE  32
+#define LORA_AT_NL      "\r"    // 命令结尾：和MKRWAN的LORA_NL一样只有CR，二进制载荷紧跟在它后面
+
+class LoRaTransport : public UplinkTransport {
+public:
+    LoRaTransport(Stream& stream);
+
+    bool start(uint8_t port, const uint8_t* data, uint8_t size, bool confirmed);
+    TransportStatus poll();
+    void abort();
+    void resetPort();           // 用过modem的其他方法（入网）之后，下一帧重新设置端口
+
+private:
+    enum State {
+        STATE_IDLE,
+        STATE_PORT,             // 等AT+PORT的+OK
+        STATE_SEND,             // 等AT+UTX/AT+CTX的+OK
+        STATE_ACK               // 确认帧：等+ACK/+NOACK
+    };
+
+    Stream& stream;
+    State state;
+    int currentPort;            // 模块当前的端口，-1=未知
+
+    // 端口设好之后再发的帧
+    const uint8_t* data;
+    uint8_t size;
+    bool confirmed;
+
+    char line[LORA_LINE_SIZE];
+    uint8_t lineLength;
+
+    void sendPayload();
+    bool readLine();
+};
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * Monitor Config - 时间参数
+ *
+ * 固件和主机回放工具共用，回放时的上传/刷新节奏和设备上一致。
+ */
+
+#ifndef MONITOR_CONFIG_H
+#define MONITOR_CONFIG_H
+
+const unsigned long UPLOAD_INTERVAL = 300000;           // 5分钟
+const unsigned long DISPLAY_UPDATE_INTERVAL = 2000;     // 2秒（采样周期）
+const unsigned long BATCH_SAMPLE_INTERVAL = 60000;      // 1分钟（上传帧里的样本间隔）
+const unsigned long REPORT_MAX_SILENCE = 3600000;       // 1小时（没变化时的心跳间隔）
+const unsigned long REPORT_MIN_PRIORITY_GAP = 60000;    // 报警优先上传离上次发送至少1分钟
+
+// 调度任务
+const unsigned long BUTTON_POLL_INTERVAL = 10;          // 按钮扫描
+const unsigned long RENDER_INTERVAL = 50;               // 渲染检查
+const unsigned long CONSOLE_INTERVAL = 100;             // 串口命令
+const unsigned long UPLINK_POLL_INTERVAL = 50;          // 查询LoRa模块的回应
+const unsigned long BACKFILL_INTERVAL = 60000;          // 网络恢复后每分钟补发一帧
+const unsigned long SESSION_CHECK_INTERVAL = 60000;     // 保存帧计数、检查会话
+
+// LoRaWAN会话
+const unsigned long SESSION_VERIFY_TIMEOUT = 600000;    // 恢复的会话10分钟内没有ACK就重新入网
+const unsigned long SESSION_ACK_TIMEOUT = 7200000;      // 网络不通且2小时没有ACK就重新入网
+const unsigned long SESSION_REJOIN_MIN = 300000;        // 入网失败后等5分钟再试，之后每次翻倍
+const unsigned long SESSION_REJOIN_MAX = 3600000;       // 最多等1小时
+const unsigned long SESSION_JOIN_TIMEOUT = 10000;       // 运行中入网最多阻塞10秒（接收窗口在6秒内）
+
+#endif
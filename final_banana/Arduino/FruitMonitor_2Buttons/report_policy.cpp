@@ -0,0 +1,147 @@
+/*
+ * Report Policy Implementation
+ */
+
+#include "report_policy.h"
+#include "monitor_config.h"
+
+ReportPolicy::ReportPolicy() : ReportPolicy(defaults(), REPORT_MAX_SILENCE) {
+}
+
+ReportPolicy::ReportPolicy(const ReportDeadband& deadband, unsigned long maxSilence)
+    : deadband(deadband), maxSilence(maxSilence) {
+    latestTemp = 0;
+    latestHumidity = 0;
+    latestGas = 0;
+    latestStage = STAGE_VERY_FRESH;
+    latestFruit = FRUIT_BANANA;
+    latestAlarm = false;
+    haveLatest = false;
+
+    reportedTemp = 0;
+    reportedHumidity = 0;
+    reportedGas = 0;
+    reportedStage = STAGE_VERY_FRESH;
+    reportedFruit = FRUIT_BANANA;
+    reportedAlarm = false;
+    haveReported = false;
+    lastSentTime = 0;
+
+    changed = false;
+    priorityPending = false;
+
+    for (int i = 0; i < REPORT_REASON_COUNT; i++) sentCounts[i] = 0;
+    suppressedCount = 0;
+}
+
+// 默认死区（上面的常量）
+ReportDeadband ReportPolicy::defaults() {
+    ReportDeadband d;
+    d.temperatureX10 = REPORT_TEMP_DEADBAND_X10;
+    d.humidityX10 = REPORT_HUMIDITY_DEADBAND_X10;
+    d.gasDelta = REPORT_GAS_DEADBAND;
+    return d;
+}
+
+static inline int32_t absDiff(int32_t a, int32_t b) {
+    return a > b ? a - b : b - a;
+}
+
+bool ReportPolicy::observe(const Snapshot& snapshot, bool alarm, unsigned long now) {
+    // 传感器读取失败的快照不参与比较
+    if (!snapshot.data.valid) return false;
+
+    bool alarmRising = alarm && haveLatest && !latestAlarm;
+
+    latestTemp = snapshot.data.temperatureX10;
+    latestHumidity = snapshot.data.humidityX10;
+    latestGas = (int16_t)snapshot.data.gasDelta;
+    latestStage = snapshot.stage;
+    latestFruit = snapshot.fruit;
+    latestAlarm = alarm;
+    haveLatest = true;
+
+    if (haveReported && !changed) {
+        changed = absDiff(latestTemp, reportedTemp) >= deadband.temperatureX10 ||
+                  absDiff(latestHumidity, reportedHumidity) >= deadband.humidityX10 ||
+                  absDiff(latestGas, reportedGas) >= deadband.gasDelta ||
+                  latestStage != reportedStage ||
+                  latestFruit != reportedFruit ||
+                  latestAlarm != reportedAlarm;
+    }
+
+    // 报警刚出现：离上次发送太近就等下一个周期（按变化上报），避免报警抖动时连发
+    if (!alarmRising || priorityPending) return false;
+    if (haveReported && now - lastSentTime < REPORT_MIN_PRIORITY_GAP) return false;
+    priorityPending = true;
+    return true;
+}
+
+ReportReason ReportPolicy::decide(unsigned long now) const {
+    if (!haveLatest) return REPORT_NONE;
+    if (priorityPending) return REPORT_ALARM;
+    if (!haveReported) return REPORT_FIRST;
+    if (changed) return REPORT_CHANGE;
+    if (now - lastSentTime >= maxSilence) return REPORT_HEARTBEAT;
+    return REPORT_NONE;
+}
+
+void ReportPolicy::sent(ReportReason reason, unsigned long now) {
+    reportedTemp = latestTemp;
+    reportedHumidity = latestHumidity;
+    reportedGas = latestGas;
+    reportedStage = latestStage;
+    reportedFruit = latestFruit;
+    reportedAlarm = latestAlarm;
+    haveReported = true;
+    lastSentTime = now;
+
+    changed = false;
+    priorityPending = false;
+
+    if (reason >= 0 && reason < REPORT_REASON_COUNT) sentCounts[reason]++;
+}
+
+void ReportPolicy::suppressed() {
+    suppressedCount++;
+}
+
+uint32_t ReportPolicy::getSent() const {
+    uint32_t total = 0;
+    for (int i = 0; i < REPORT_REASON_COUNT; i++) total += sentCounts[i];
+    return total;
+}
+
+uint32_t ReportPolicy::getSent(ReportReason reason) const {
+    if (reason < 0 || reason >= REPORT_REASON_COUNT) return 0;
+    return sentCounts[reason];
+}
+
+uint32_t ReportPolicy::getSuppressed() const {
+    return suppressedCount;
+}
+
+const char* ReportPolicy::reasonName(ReportReason reason) {
+    switch (reason) {
+        case REPORT_FIRST:     return "first";
+        case REPORT_CHANGE:    return "change";
+        case REPORT_HEARTBEAT: return "heartbeat";
+        case REPORT_ALARM:     return "alarm";
+        default:               return "none";
+    }
+}
+
+void ReportPolicy::printStats() const {
+    Serial.print("Uplinks: ");
+    Serial.print(getSent());
+    Serial.print(" sent (");
+    for (int i = REPORT_FIRST; i < REPORT_REASON_COUNT; i++) {
+        if (i > REPORT_FIRST) Serial.print(", ");
+        Serial.print(reasonName((ReportReason)i));
+        Serial.print(" ");
+        Serial.print(sentCounts[i]);
+    }
+    Serial.print("), ");
+    Serial.print(suppressedCount);
+    Serial.println(" suppressed");
+}
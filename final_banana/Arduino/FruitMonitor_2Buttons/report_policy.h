@@ -0,0 +1,92 @@
+/*
+ * Report Policy - 变化才上传
+ *
+ * 上传任务每5分钟问一次要不要发：和上一次发出去时的数值比，温度、湿度、
+ * 气体变化都没超出死区，阶段、水果、环境报警也没变，就不发（这段时间的
+ * 样本丢掉）。最长静默时间到了发一次心跳。环境报警刚出现时立即优先上传，
+ * 不等下一个周期。
+ *
+ * 每个快照都比较一次，超出死区后一直记着，直到真正发出去（中途回到
+ * 死区内的短时波动也会上报）。
+ */
+
+#ifndef REPORT_POLICY_H
+#define REPORT_POLICY_H
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+// 死区（超出或等于才算变化）
+const int16_t REPORT_TEMP_DEADBAND_X10 = 3;         // ±0.3°C
+const uint16_t REPORT_HUMIDITY_DEADBAND_X10 = 20;   // ±2%RH
+const int16_t REPORT_GAS_DEADBAND = 5;              // ±5 ADC（气体变化量）
+
+// 上传原因
+enum ReportReason {
+    REPORT_NONE = 0,        // 没变化，不发
+    REPORT_FIRST,           // 启动后第一次
+    REPORT_CHANGE,          // 超出死区或状态变化
+    REPORT_HEARTBEAT,       // 静默太久
+    REPORT_ALARM,           // 环境报警（优先）
+    REPORT_REASON_COUNT
+};
+
+// 一组死区（主机工具可以替换）
+struct ReportDeadband {
+    int16_t temperatureX10;
+    uint16_t humidityX10;
+    int16_t gasDelta;
+};
+
+class ReportPolicy {
+public:
+    ReportPolicy();
+    ReportPolicy(const ReportDeadband& deadband, unsigned long maxSilence);
+
+    // 每个快照调用一次；返回true表示报警刚出现，应该立即优先上传
+    bool observe(const Snapshot& snapshot, bool alarm, unsigned long now);
+
+    // 到了上传周期：要不要发、为什么发
+    ReportReason decide(unsigned long now) const;
+    void sent(ReportReason reason, unsigned long now);  // 发送成功，以最新的数值作为新的参考
+    void suppressed();                                   // 这一周期没发
+
+    uint32_t getSent() const;
+    uint32_t getSent(ReportReason reason) const;
+    uint32_t getSuppressed() const;
+    void printStats() const;
+
+    static const char* reasonName(ReportReason reason);
+    static ReportDeadband defaults();
+
+private:
+    ReportDeadband deadband;
+    unsigned long maxSilence;
+
+    // 最新一次有效快照
+    int16_t latestTemp;
+    uint16_t latestHumidity;
+    int16_t latestGas;
+    FreshnessStage latestStage;
+    FruitType latestFruit;
+    bool latestAlarm;
+    bool haveLatest;
+
+    // 上一次发出去时的数值
+    int16_t reportedTemp;
+    uint16_t reportedHumidity;
+    int16_t reportedGas;
+    FreshnessStage reportedStage;
+    FruitType reportedFruit;
+    bool reportedAlarm;
+    bool haveReported;
+    unsigned long lastSentTime;
+
+    bool changed;           // 上次发送后有快照超出了死区
+    bool priorityPending;   // 报警的优先上传还没发出去
+
+    uint32_t sentCounts[REPORT_REASON_COUNT];
+    uint32_t suppressedCount;
+};
+
+#endif
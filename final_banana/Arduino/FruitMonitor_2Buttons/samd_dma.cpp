@@ -0,0 +1,100 @@
+/*
+ * SAMD21 DMA Controller Implementation
+ */
+
+#include "samd_dma.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+// 描述符表和回写表必须16字节对齐
+__attribute__((__aligned__(16))) static DmacDescriptor dmaDescriptors[DMA_MAX_CHANNELS];
+__attribute__((__aligned__(16))) static DmacDescriptor dmaWriteback[DMA_MAX_CHANNELS];
+
+bool DMAController::initialized = false;
+uint8_t DMAController::channelsUsed = 0;
+
+// 初始化DMAC（只执行一次）
+void DMAController::begin() {
+    if (initialized) return;
+
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+
+    DMAC->CTRL.reg &= ~DMAC_CTRL_DMAENABLE;
+    DMAC->CTRL.reg = DMAC_CTRL_SWRST;
+    while (DMAC->CTRL.reg & DMAC_CTRL_SWRST);
+
+    memset(dmaDescriptors, 0, sizeof(dmaDescriptors));
+    memset(dmaWriteback, 0, sizeof(dmaWriteback));
+
+    DMAC->BASEADDR.reg = (uint32_t)dmaDescriptors;
+    DMAC->WRBADDR.reg = (uint32_t)dmaWriteback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF);
+
+    initialized = true;
+}
+
+// 分配一个DMA通道，失败返回-1
+int8_t DMAController::allocateChannel() {
+    begin();
+    if (channelsUsed >= DMA_MAX_CHANNELS) return -1;
+
+    uint8_t channel = channelsUsed++;
+
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    DMAC->CHCTRLA.reg &= ~DMAC_CHCTRLA_ENABLE;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_SWRST);
+    interrupts();
+
+    return channel;
+}
+
+DmacDescriptor* DMAController::descriptor(uint8_t channel) {
+    return &dmaDescriptors[channel];
+}
+
+DmacDescriptor* DMAController::writeback(uint8_t channel) {
+    return &dmaWriteback[channel];
+}
+
+// 启动通道（描述符需事先填好）
+void DMAController::start(uint8_t channel, uint8_t triggerSource, uint32_t triggerAction) {
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_MASK;
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) |
+                        DMAC_CHCTRLB_TRIGSRC(triggerSource) |
+                        triggerAction;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    interrupts();
+}
+
+// 通道是否仍在传输
+bool DMAController::isBusy(uint8_t channel) {
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    bool busy = (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_ENABLE) &&
+                !(DMAC->CHINTFLAG.reg & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR));
+    interrupts();
+    return busy;
+}
+
+void DMAController::clearFlags(uint8_t channel) {
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_MASK;
+    interrupts();
+}
+
+void DMAController::abort(uint8_t channel) {
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    DMAC->CHCTRLA.reg &= ~DMAC_CHCTRLA_ENABLE;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_ENABLE);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_MASK;
+    interrupts();
+}
+
+#endif
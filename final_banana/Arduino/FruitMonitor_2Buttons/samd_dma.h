@@ -0,0 +1,40 @@
+/*
+ * SAMD21 DMA Controller - DMAC共享管理
+ *
+ * DMAC的描述符表全局只有一份，显示总线和其他外设
+ * 通过这里分配通道，避免互相覆盖。
+ */
+
+#ifndef SAMD_DMA_H
+#define SAMD_DMA_H
+
+#include <Arduino.h>
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+// 本工程最多使用的DMA通道数（SAMD21共12个）
+#define DMA_MAX_CHANNELS  4
+
+class DMAController {
+public:
+    static void begin();
+    static int8_t allocateChannel();
+
+    // 通道描述符（第一个描述符位于基址表中）
+    static DmacDescriptor* descriptor(uint8_t channel);
+    static DmacDescriptor* writeback(uint8_t channel);
+
+    // 配置触发源并启动通道
+    static void start(uint8_t channel, uint8_t triggerSource, uint32_t triggerAction);
+    static bool isBusy(uint8_t channel);
+    static void clearFlags(uint8_t channel);
+    static void abort(uint8_t channel);
+
+private:
+    static bool initialized;
+    static uint8_t channelsUsed;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * SAMD21 NVM Storage Implementation
+ */
+
+#include "samd_nvm.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#define NVM_ROW_SIZE  (FLASH_LOG_PAGE_SIZE * FLASH_LOG_PAGES_PER_ROW)
+
+__attribute__((__aligned__(NVM_ROW_SIZE)))
+static const uint8_t logArea[FLASH_LOG_ROWS * NVM_ROW_SIZE] = { 0 };
+
+__attribute__((__aligned__(NVM_ROW_SIZE)))
+static const uint8_t sessionArea[SESSION_STORE_ROWS * NVM_ROW_SIZE] = { 0 };
+
+SamdNvmStorage::SamdNvmStorage(NvmArea area) {
+    if (area == NVM_AREA_SESSION) {
+        base = sessionArea;
+        pages = SESSION_STORE_ROWS * FLASH_LOG_PAGES_PER_ROW;
+    } else {
+        base = logArea;
+        pages = FLASH_LOG_ROWS * FLASH_LOG_PAGES_PER_ROW;
+    }
+}
+
+// 通过volatile指针读，编译器不会把数组当成全0常量
+const volatile uint8_t* SamdNvmStorage::pageAddress(uint16_t page) const {
+    return (const volatile uint8_t*)base + (uint32_t)page * FLASH_LOG_PAGE_SIZE;
+}
+
+static inline void waitReady() {
+    while (!NVMCTRL->INTFLAG.bit.READY);
+}
+
+uint16_t SamdNvmStorage::pageCount() {
+    return pages;
+}
+
+void SamdNvmStorage::read(uint16_t page, uint8_t* data) {
+    const volatile uint8_t* src = pageAddress(page);
+    for (int i = 0; i < FLASH_LOG_PAGE_SIZE; i++) data[i] = src[i];
+}
+
+// 手动写模式：清页缓冲，按32位字填满，再写页
+void SamdNvmStorage::write(uint16_t page, const uint8_t* data) {
+    volatile uint32_t* dst = (volatile uint32_t*)pageAddress(page);
+
+    NVMCTRL->CTRLB.bit.MANW = 1;
+    NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_PBC;
+    waitReady();
+
+    for (int i = 0; i < FLASH_LOG_PAGE_SIZE / 4; i++) {
+        const uint8_t* p = data + i * 4;
+        dst[i] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_WP;
+    waitReady();
+}
+
+void SamdNvmStorage::eraseRow(uint16_t firstPage) {
+    // ADDR是16位字地址
+    NVMCTRL->ADDR.reg = (uint32_t)pageAddress(firstPage) / 2;
+    NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_ER;
+    waitReady();
+}
+
+#endif
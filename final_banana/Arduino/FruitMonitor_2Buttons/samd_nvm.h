@@ -0,0 +1,42 @@
+/*
+ * SAMD21 NVM Storage - 程序flash里的存储区
+ *
+ * 每个存储区是一个按行（256字节）对齐的常量数组，放在程序flash里，链接器
+ * 不会把别的代码放进去。用NVMCTRL按行擦除、按页写入；擦除一行约6ms，
+ * 写一页约3ms，期间CPU等待flash（只在断网写日志、补发后写标记和保存
+ * LoRaWAN会话时发生）。重新上传程序会把存储区清零（日志和会话都清空）。
+ */
+
+#ifndef SAMD_NVM_H
+#define SAMD_NVM_H
+
+#include <Arduino.h>
+#include "flash_log.h"
+#include "session_store.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+enum NvmArea {
+    NVM_AREA_LOG = 0,       // 断网日志（FLASH_LOG_ROWS行）
+    NVM_AREA_SESSION        // LoRaWAN会话（SESSION_STORE_ROWS行）
+};
+
+class SamdNvmStorage : public LogStorage {
+public:
+    SamdNvmStorage(NvmArea area);
+
+    uint16_t pageCount();
+    void read(uint16_t page, uint8_t* data);
+    void write(uint16_t page, const uint8_t* data);
+    void eraseRow(uint16_t firstPage);
+
+private:
+    const uint8_t* base;
+    uint16_t pages;
+
+    const volatile uint8_t* pageAddress(uint16_t page) const;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * Task Scheduler Implementation
+ */
+
+#include "scheduler.h"
+
+// 构造函数
+TaskScheduler::TaskScheduler(Clock& clock) : clock(clock) {
+    taskCount = 0;
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        events[i].active = false;
+    }
+    resetStats();
+}
+
+// 添加周期任务，返回任务编号（失败返回-1）
+int TaskScheduler::addTask(const char* name, TaskFunction function,
+                           unsigned long interval, unsigned long startDelay) {
+    if (taskCount >= SCHED_MAX_TASKS) return -1;
+
+    SchedulerTask& task = tasks[taskCount];
+    task.name = name;
+    task.function = function;
+    task.interval = interval;
+    task.nextRun = clock.now() + startDelay;
+    task.enabled = true;
+    task.worstLatency = 0;
+    task.worstRuntime = 0;
+    task.runCount = 0;
+
+    return taskCount++;
+}
+
+void TaskScheduler::setEnabled(int taskId, bool enabled) {
+    if (taskId < 0 || taskId >= taskCount) return;
+
+    if (enabled && !tasks[taskId].enabled) {
+        tasks[taskId].nextRun = clock.now() + tasks[taskId].interval;
+    }
+    tasks[taskId].enabled = enabled;
+}
+
+// 让任务在下一轮立即执行
+void TaskScheduler::triggerNow(int taskId) {
+    if (taskId < 0 || taskId >= taskCount) return;
+    tasks[taskId].nextRun = clock.now();
+}
+
+// 投递一次性延时事件
+bool TaskScheduler::postDelayed(TaskFunction function, unsigned long delayMs) {
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        if (!events[i].active) {
+            events[i].function = function;
+            events[i].dueTime = clock.now() + delayMs;
+            events[i].active = true;
+            return true;
+        }
+    }
+
+    Serial.println("⚠️ Scheduler event queue full");
+    return false;
+}
+
+// 取消尚未执行的事件
+void TaskScheduler::cancel(TaskFunction function) {
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        if (events[i].active && events[i].function == function) {
+            events[i].active = false;
+        }
+    }
+}
+
+bool TaskScheduler::isPending(TaskFunction function) {
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        if (events[i].active && events[i].function == function) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 执行一轮：先处理到期事件，再处理到期任务
+void TaskScheduler::run() {
+    runEvents(clock.now());
+
+    for (int i = 0; i < taskCount; i++) {
+        SchedulerTask& task = tasks[i];
+        unsigned long now = clock.now();
+
+        if (!task.enabled || (long)(now - task.nextRun) < 0) {
+            continue;
+        }
+
+        unsigned long latency = now - task.nextRun;
+        if (latency > task.worstLatency) task.worstLatency = latency;
+
+        // 按计划时刻推进，落后太多时不补跑
+        task.nextRun += task.interval;
+        if ((long)(now - task.nextRun) >= 0) {
+            task.nextRun = now + task.interval;
+        }
+
+        unsigned long start = micros();
+        task.function();
+        unsigned long runtime = micros() - start;
+
+        if (runtime > task.worstRuntime) task.worstRuntime = runtime;
+        task.runCount++;
+
+        // 每个任务之后都检查事件，缩短事件延迟
+        runEvents(clock.now());
+    }
+}
+
+// 最早到期的任务或事件（都没有时返回一小时后）
+unsigned long TaskScheduler::nextDue() {
+    unsigned long now = clock.now();
+    unsigned long due = now + 3600000UL;
+
+    for (int i = 0; i < taskCount; i++) {
+        if (tasks[i].enabled && (long)(tasks[i].nextRun - due) < 0) {
+            due = tasks[i].nextRun;
+        }
+    }
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        if (events[i].active && (long)(events[i].dueTime - due) < 0) {
+            due = events[i].dueTime;
+        }
+    }
+
+    return due;
+}
+
+void TaskScheduler::runEvents(unsigned long now) {
+    for (int i = 0; i < SCHED_MAX_EVENTS; i++) {
+        DeferredEvent& event = events[i];
+        if (!event.active || (long)(now - event.dueTime) < 0) {
+            continue;
+        }
+
+        // 先释放槽位，事件回调里可以再投递新事件
+        event.active = false;
+
+        unsigned long latency = now - event.dueTime;
+        if (latency > eventWorstLatency) eventWorstLatency = latency;
+
+        unsigned long start = micros();
+        event.function();
+        unsigned long runtime = micros() - start;
+
+        if (runtime > eventWorstRuntime) eventWorstRuntime = runtime;
+        eventCount++;
+    }
+}
+
+// 打印每个任务的最坏延迟和运行时间
+void TaskScheduler::printStats() {
+    Serial.println("\n┌─────────────────────────────────────────────┐");
+    Serial.println("│ ⏱ Scheduler stats                           │");
+    Serial.println("├─────────────────────────────────────────────┤");
+    Serial.println("│ task       runs   worst lat   worst run     │");
+
+    char line[64];
+    for (int i = 0; i < taskCount; i++) {
+        snprintf(line, sizeof(line), "│ %-9s %6lu %8lu ms %9lu us",
+                 tasks[i].name, (unsigned long)tasks[i].runCount,
+                 tasks[i].worstLatency, tasks[i].worstRuntime);
+        Serial.println(line);
+    }
+    snprintf(line, sizeof(line), "│ %-9s %6lu %8lu ms %9lu us",
+             "events", (unsigned long)eventCount,
+             eventWorstLatency, eventWorstRuntime);
+    Serial.println(line);
+
+    Serial.println("└─────────────────────────────────────────────┘\n");
+}
+
+void TaskScheduler::resetStats() {
+    for (int i = 0; i < taskCount; i++) {
+        tasks[i].worstLatency = 0;
+        tasks[i].worstRuntime = 0;
+        tasks[i].runCount = 0;
+    }
+    eventWorstLatency = 0;
+    eventWorstRuntime = 0;
+    eventCount = 0;
+}
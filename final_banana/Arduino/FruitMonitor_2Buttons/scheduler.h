@@ -0,0 +1,76 @@
+/*
+ * Task Scheduler - 协作式任务调度器
+ *
+ * 周期任务 + 延时事件，loop()里只调用run()，任何任务都不应阻塞。
+ * 每个任务记录最坏调度延迟（计划时刻到实际执行）和最长运行时间。
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include "clock_source.h"
+
+#define SCHED_MAX_TASKS   12      // 固件用8个，留几个余量；满了addTask()返回-1
+#define SCHED_MAX_EVENTS  8
+
+typedef void (*TaskFunction)();
+
+// 周期任务
+struct SchedulerTask {
+    const char* name;
+    TaskFunction function;
+    unsigned long interval;     // 周期 (ms)
+    unsigned long nextRun;      // 下次计划执行时刻 (ms)
+    bool enabled;
+
+    // 统计
+    unsigned long worstLatency; // 最坏调度延迟 (ms)
+    unsigned long worstRuntime; // 最长运行时间 (us)
+    uint32_t runCount;
+};
+
+// 延时事件（一次性）
+struct DeferredEvent {
+    TaskFunction function;
+    unsigned long dueTime;
+    bool active;
+};
+
+// 调度器类
+class TaskScheduler {
+public:
+    TaskScheduler(Clock& clock = SystemClock::instance());
+
+    int addTask(const char* name, TaskFunction function,
+                unsigned long interval, unsigned long startDelay = 0);
+    void setEnabled(int taskId, bool enabled);
+    void triggerNow(int taskId);
+
+    bool postDelayed(TaskFunction function, unsigned long delayMs);
+    void cancel(TaskFunction function);
+    bool isPending(TaskFunction function);
+
+    void run();
+
+    void printStats();
+    void resetStats();
+
+    // 最早到期的任务或事件的时刻（回放时直接跳到这里）
+    unsigned long nextDue();
+
+private:
+    Clock& clock;
+    SchedulerTask tasks[SCHED_MAX_TASKS];
+    DeferredEvent events[SCHED_MAX_EVENTS];
+    int taskCount;
+
+    // 延时事件的统计
+    unsigned long eventWorstLatency;
+    unsigned long eventWorstRuntime;
+    uint32_t eventCount;
+
+    void runEvents(unsigned long now);
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Score Surface Implementation
+ */
+
+#include "score_surface.h"
+#include "score_surface_table.h"
+
+static_assert(SURFACE_FRUIT_COUNT == FRUIT_COUNT, "score_surface_table.h is out of date");
+
+// locate()按这组步长取倒数，conditionScore()按这个单位换算
+static_assert(SURFACE_TEMP_STEP_X10 == 10 && SURFACE_HUMIDITY_STEP_X10 == 25 && SURFACE_UNIT_E4 == 50,
+              "score_surface.cpp assumes a 1°C x 2.5% grid in 0.005-point units");
+
+bool ScoreSurface::locate(int16_t temperatureX10, uint16_t humidityX10, SurfaceCell& cell) {
+    int32_t t = (int32_t)temperatureX10 - SURFACE_TEMP_MIN_X10;
+    int32_t h = humidityX10;
+    if (t < 0 || t > (SURFACE_TEMP_NODES - 1) * SURFACE_TEMP_STEP_X10) return false;
+    if (h > (SURFACE_HUMIDITY_NODES - 1) * SURFACE_HUMIDITY_STEP_X10) return false;
+
+    // 乘倒数代替除以10、除以25（M0没有除法指令），在网格范围内结果准确
+    int32_t i = (t * 6554) >> 16;
+    int32_t j = (h * 2622) >> 16;
+    if (i > SURFACE_TEMP_NODES - 2) i = SURFACE_TEMP_NODES - 2;
+    if (j > SURFACE_HUMIDITY_NODES - 2) j = SURFACE_HUMIDITY_NODES - 2;
+
+    int32_t fx = t - i * SURFACE_TEMP_STEP_X10;
+    int32_t fy = h - j * SURFACE_HUMIDITY_STEP_X10;
+
+    cell.offset = (uint16_t)(i * SURFACE_HUMIDITY_NODES + j);
+    cell.weights[0] = (int16_t)((SURFACE_TEMP_STEP_X10 - fx) * (SURFACE_HUMIDITY_STEP_X10 - fy));
+    cell.weights[1] = (int16_t)((SURFACE_TEMP_STEP_X10 - fx) * fy);
+    cell.weights[2] = (int16_t)(fx * (SURFACE_HUMIDITY_STEP_X10 - fy));
+    cell.weights[3] = (int16_t)(fx * fy);
+    return true;
+}
+
+int32_t ScoreSurface::conditionScore(FruitType fruit, const SurfaceCell& cell) {
+    const int16_t* node = &SCORE_SURFACES[fruit][cell.offset];
+
+    int32_t sum = cell.weights[0] * (int16_t)pgm_read_word(node)
+                + cell.weights[1] * (int16_t)pgm_read_word(node + 1)
+                + cell.weights[2] * (int16_t)pgm_read_word(node + SURFACE_HUMIDITY_NODES)
+                + cell.weights[3] * (int16_t)pgm_read_word(node + SURFACE_HUMIDITY_NODES + 1);
+
+    // 负分最终都限幅成0，不必换算（截到int16下限的格子插值也不是线性的）
+    if (sum < 0) return sum;
+
+    // sum的单位是 SURFACE_UNIT_E4/250 = 0.0001分/5，且一定是5的倍数：
+    // 乘5在2^32下的逆元就是精确除以5
+    return (int32_t)((uint32_t)sum * 0xCCCCCCCDu);
+}
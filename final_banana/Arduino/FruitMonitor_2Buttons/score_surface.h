@@ -0,0 +1,31 @@
+/*
+ * Score Surface - 温湿度评分面查表
+ *
+ * 每种水果的环境评分（初始分 - 温度扣分 - 湿度扣分）预先算在
+ * 温度×湿度网格上（score_surface_table.h，放在flash里）。每条采样
+ * 定位一次格子，之后每种水果只要4次读表、4次乘法，没有除法。
+ * 网格内结果和定点公式逐位相同；网格外locate()返回false，由调用方用公式算。
+ */
+
+#ifndef SCORE_SURFACE_H
+#define SCORE_SURFACE_H
+
+#include <Arduino.h>
+#include "fruit_profiles.h"
+
+// 一个读数所在的格子
+struct SurfaceCell {
+    uint16_t offset;            // 格子左下节点（低温、低湿）的下标
+    int16_t weights[4];         // 低温低湿、低温高湿、高温低湿、高温高湿的权重，和为250
+};
+
+class ScoreSurface {
+public:
+    // 定位读数所在的格子（超出网格返回false）
+    static bool locate(int16_t temperatureX10, uint16_t humidityX10, SurfaceCell& cell);
+
+    // 环境评分（0.0001分，未限幅；负分只保证仍是负数）
+    static int32_t conditionScore(FruitType fruit, const SurfaceCell& cell);
+};
+
+#endif
@@ -0,0 +1,1007 @@
+/*
+ * Score Surface Table - 温湿度评分面
+ * 由 tools/gen_score_surfaces.py 根据 tools/fruit_profiles.csv 生成，请勿手动修改
+ */
+
+#ifndef SCORE_SURFACE_TABLE_H
+#define SCORE_SURFACE_TABLE_H
+
+#include <Arduino.h>
+
+#define SURFACE_FRUIT_COUNT         4
+#define SURFACE_TEMP_MIN_X10        -100  // 网格起点 (0.1°C)
+#define SURFACE_TEMP_STEP_X10       10    // 温度步长 (0.1°C)
+#define SURFACE_TEMP_NODES          61
+#define SURFACE_HUMIDITY_STEP_X10   25    // 湿度步长 (0.1%)，从0%开始
+#define SURFACE_HUMIDITY_NODES      41
+#define SURFACE_UNIT_E4             50    // 节点值单位 (0.0001分)
+
+// 每种水果一张网格，按温度行、湿度列存放（5002字节/种）
+static const int16_t SCORE_SURFACES[SURFACE_FRUIT_COUNT][SURFACE_TEMP_NODES * SURFACE_HUMIDITY_NODES] PROGMEM = {
+    {   // Banana
+        // -10°C
+        -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000,
+        -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 1000,
+        0, -1000, -2000, -3000, -4000, -5000, -6000, -7000, -8000, -9000, -10000, -11000, -12000,
+        // -9°C
+        -23400, -22400, -21400, -20400, -19400, -18400, -17400, -16400, -15400, -14400, -13400, -12400, -11400, -10400,
+        -9400, -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600, 2600, 1600,
+        600, -400, -1400, -2400, -3400, -4400, -5400, -6400, -7400, -8400, -9400, -10400, -11400,
+        // -8°C
+        -22800, -21800, -20800, -19800, -18800, -17800, -16800, -15800, -14800, -13800, -12800, -11800, -10800, -9800,
+        -8800, -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200, 3200, 2200,
+        1200, 200, -800, -1800, -2800, -3800, -4800, -5800, -6800, -7800, -8800, -9800, -10800,
+        // -7°C
+        -22200, -21200, -20200, -19200, -18200, -17200, -16200, -15200, -14200, -13200, -12200, -11200, -10200, -9200,
+        -8200, -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800, 3800, 2800,
+        1800, 800, -200, -1200, -2200, -3200, -4200, -5200, -6200, -7200, -8200, -9200, -10200,
+        // -6°C
+        -21600, -20600, -19600, -18600, -17600, -16600, -15600, -14600, -13600, -12600, -11600, -10600, -9600, -8600,
+        -7600, -6600, -5600, -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400, 4400, 3400,
+        2400, 1400, 400, -600, -1600, -2600, -3600, -4600, -5600, -6600, -7600, -8600, -9600,
+        // -5°C
+        -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000,
+        -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 4000,
+        3000, 2000, 1000, 0, -1000, -2000, -3000, -4000, -5000, -6000, -7000, -8000, -9000,
+        // -4°C
+        -20400, -19400, -18400, -17400, -16400, -15400, -14400, -13400, -12400, -11400, -10400, -9400, -8400, -7400,
+        -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600, 2600, 3600, 4600, 5600, 4600,
+        3600, 2600, 1600, 600, -400, -1400, -2400, -3400, -4400, -5400, -6400, -7400, -8400,
+        // -3°C
+        -19800, -18800, -17800, -16800, -15800, -14800, -13800, -12800, -11800, -10800, -9800, -8800, -7800, -6800,
+        -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200, 3200, 4200, 5200, 6200, 5200,
+        4200, 3200, 2200, 1200, 200, -800, -1800, -2800, -3800, -4800, -5800, -6800, -7800,
+        // -2°C
+        -19200, -18200, -17200, -16200, -15200, -14200, -13200, -12200, -11200, -10200, -9200, -8200, -7200, -6200,
+        -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800, 3800, 4800, 5800, 6800, 5800,
+        4800, 3800, 2800, 1800, 800, -200, -1200, -2200, -3200, -4200, -5200, -6200, -7200,
+        // -1°C
+        -18600, -17600, -16600, -15600, -14600, -13600, -12600, -11600, -10600, -9600, -8600, -7600, -6600, -5600,
+        -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400, 4400, 5400, 6400, 7400, 6400,
+        5400, 4400, 3400, 2400, 1400, 400, -600, -1600, -2600, -3600, -4600, -5600, -6600,
+        // 0°C
+        -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000,
+        -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 7000,
+        6000, 5000, 4000, 3000, 2000, 1000, 0, -1000, -2000, -3000, -4000, -5000, -6000,
+        // 1°C
+        -17400, -16400, -15400, -14400, -13400, -12400, -11400, -10400, -9400, -8400, -7400, -6400, -5400, -4400,
+        -3400, -2400, -1400, -400, 600, 1600, 2600, 3600, 4600, 5600, 6600, 7600, 8600, 7600,
+        6600, 5600, 4600, 3600, 2600, 1600, 600, -400, -1400, -2400, -3400, -4400, -5400,
+        // 2°C
+        -16800, -15800, -14800, -13800, -12800, -11800, -10800, -9800, -8800, -7800, -6800, -5800, -4800, -3800,
+        -2800, -1800, -800, 200, 1200, 2200, 3200, 4200, 5200, 6200, 7200, 8200, 9200, 8200,
+        7200, 6200, 5200, 4200, 3200, 2200, 1200, 200, -800, -1800, -2800, -3800, -4800,
+        // 3°C
+        -16200, -15200, -14200, -13200, -12200, -11200, -10200, -9200, -8200, -7200, -6200, -5200, -4200, -3200,
+        -2200, -1200, -200, 800, 1800, 2800, 3800, 4800, 5800, 6800, 7800, 8800, 9800, 8800,
+        7800, 6800, 5800, 4800, 3800, 2800, 1800, 800, -200, -1200, -2200, -3200, -4200,
+        // 4°C
+        -15600, -14600, -13600, -12600, -11600, -10600, -9600, -8600, -7600, -6600, -5600, -4600, -3600, -2600,
+        -1600, -600, 400, 1400, 2400, 3400, 4400, 5400, 6400, 7400, 8400, 9400, 10400, 9400,
+        8400, 7400, 6400, 5400, 4400, 3400, 2400, 1400, 400, -600, -1600, -2600, -3600,
+        // 5°C
+        -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000,
+        -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 10000,
+        9000, 8000, 7000, 6000, 5000, 4000, 3000, 2000, 1000, 0, -1000, -2000, -3000,
+        // 6°C
+        -14400, -13400, -12400, -11400, -10400, -9400, -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400,
+        -400, 600, 1600, 2600, 3600, 4600, 5600, 6600, 7600, 8600, 9600, 10600, 11600, 10600,
+        9600, 8600, 7600, 6600, 5600, 4600, 3600, 2600, 1600, 600, -400, -1400, -2400,
+        // 7°C
+        -13800, -12800, -11800, -10800, -9800, -8800, -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800,
+        200, 1200, 2200, 3200, 4200, 5200, 6200, 7200, 8200, 9200, 10200, 11200, 12200, 11200,
+        10200, 9200, 8200, 7200, 6200, 5200, 4200, 3200, 2200, 1200, 200, -800, -1800,
+        // 8°C
+        -13200, -12200, -11200, -10200, -9200, -8200, -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200,
+        800, 1800, 2800, 3800, 4800, 5800, 6800, 7800, 8800, 9800, 10800, 11800, 12800, 11800,
+        10800, 9800, 8800, 7800, 6800, 5800, 4800, 3800, 2800, 1800, 800, -200, -1200,
+        // 9°C
+        -12600, -11600, -10600, -9600, -8600, -7600, -6600, -5600, -4600, -3600, -2600, -1600, -600, 400,
+        1400, 2400, 3400, 4400, 5400, 6400, 7400, 8400, 9400, 10400, 11400, 12400, 13400, 12400,
+        11400, 10400, 9400, 8400, 7400, 6400, 5400, 4400, 3400, 2400, 1400, 400, -600,
+        // 10°C
+        -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000,
+        2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 13000,
+        12000, 11000, 10000, 9000, 8000, 7000, 6000, 5000, 4000, 3000, 2000, 1000, 0,
+        // 11°C
+        -11400, -10400, -9400, -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600,
+        2600, 3600, 4600, 5600, 6600, 7600, 8600, 9600, 10600, 11600, 12600, 13600, 14600, 13600,
+        12600, 11600, 10600, 9600, 8600, 7600, 6600, 5600, 4600, 3600, 2600, 1600, 600,
+        // 12°C
+        -10800, -9800, -8800, -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200,
+        3200, 4200, 5200, 6200, 7200, 8200, 9200, 10200, 11200, 12200, 13200, 14200, 15200, 14200,
+        13200, 12200, 11200, 10200, 9200, 8200, 7200, 6200, 5200, 4200, 3200, 2200, 1200,
+        // 13°C
+        -10200, -9200, -8200, -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800,
+        3800, 4800, 5800, 6800, 7800, 8800, 9800, 10800, 11800, 12800, 13800, 14800, 15800, 14800,
+        13800, 12800, 11800, 10800, 9800, 8800, 7800, 6800, 5800, 4800, 3800, 2800, 1800,
+        // 14°C
+        -9600, -8600, -7600, -6600, -5600, -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400,
+        4400, 5400, 6400, 7400, 8400, 9400, 10400, 11400, 12400, 13400, 14400, 15400, 16400, 15400,
+        14400, 13400, 12400, 11400, 10400, 9400, 8400, 7400, 6400, 5400, 4400, 3400, 2400,
+        // 15°C
+        -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000,
+        5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 16000,
+        15000, 14000, 13000, 12000, 11000, 10000, 9000, 8000, 7000, 6000, 5000, 4000, 3000,
+        // 16°C
+        -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600, 2600, 3600, 4600,
+        5600, 6600, 7600, 8600, 9600, 10600, 11600, 12600, 13600, 14600, 15600, 16600, 17600, 16600,
+        15600, 14600, 13600, 12600, 11600, 10600, 9600, 8600, 7600, 6600, 5600, 4600, 3600,
+        // 17°C
+        -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200, 3200, 4200, 5200,
+        6200, 7200, 8200, 9200, 10200, 11200, 12200, 13200, 14200, 15200, 16200, 17200, 18200, 17200,
+        16200, 15200, 14200, 13200, 12200, 11200, 10200, 9200, 8200, 7200, 6200, 5200, 4200,
+        // 18°C
+        -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800, 3800, 4800, 5800,
+        6800, 7800, 8800, 9800, 10800, 11800, 12800, 13800, 14800, 15800, 16800, 17800, 18800, 17800,
+        16800, 15800, 14800, 13800, 12800, 11800, 10800, 9800, 8800, 7800, 6800, 5800, 4800,
+        // 19°C
+        -6600, -5600, -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400, 4400, 5400, 6400,
+        7400, 8400, 9400, 10400, 11400, 12400, 13400, 14400, 15400, 16400, 17400, 18400, 19400, 18400,
+        17400, 16400, 15400, 14400, 13400, 12400, 11400, 10400, 9400, 8400, 7400, 6400, 5400,
+        // 20°C
+        -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000,
+        8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 18000, 19000, 20000, 19000,
+        18000, 17000, 16000, 15000, 14000, 13000, 12000, 11000, 10000, 9000, 8000, 7000, 6000,
+        // 21°C
+        -6600, -5600, -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400, 4400, 5400, 6400,
+        7400, 8400, 9400, 10400, 11400, 12400, 13400, 14400, 15400, 16400, 17400, 18400, 19400, 18400,
+        17400, 16400, 15400, 14400, 13400, 12400, 11400, 10400, 9400, 8400, 7400, 6400, 5400,
+        // 22°C
+        -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800, 3800, 4800, 5800,
+        6800, 7800, 8800, 9800, 10800, 11800, 12800, 13800, 14800, 15800, 16800, 17800, 18800, 17800,
+        16800, 15800, 14800, 13800, 12800, 11800, 10800, 9800, 8800, 7800, 6800, 5800, 4800,
+        // 23°C
+        -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200, 3200, 4200, 5200,
+        6200, 7200, 8200, 9200, 10200, 11200, 12200, 13200, 14200, 15200, 16200, 17200, 18200, 17200,
+        16200, 15200, 14200, 13200, 12200, 11200, 10200, 9200, 8200, 7200, 6200, 5200, 4200,
+        // 24°C
+        -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600, 2600, 3600, 4600,
+        5600, 6600, 7600, 8600, 9600, 10600, 11600, 12600, 13600, 14600, 15600, 16600, 17600, 16600,
+        15600, 14600, 13600, 12600, 11600, 10600, 9600, 8600, 7600, 6600, 5600, 4600, 3600,
+        // 25°C
+        -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000,
+        5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 16000,
+        15000, 14000, 13000, 12000, 11000, 10000, 9000, 8000, 7000, 6000, 5000, 4000, 3000,
+        // 26°C
+        -9600, -8600, -7600, -6600, -5600, -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400,
+        4400, 5400, 6400, 7400, 8400, 9400, 10400, 11400, 12400, 13400, 14400, 15400, 16400, 15400,
+        14400, 13400, 12400, 11400, 10400, 9400, 8400, 7400, 6400, 5400, 4400, 3400, 2400,
+        // 27°C
+        -10200, -9200, -8200, -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800,
+        3800, 4800, 5800, 6800, 7800, 8800, 9800, 10800, 11800, 12800, 13800, 14800, 15800, 14800,
+        13800, 12800, 11800, 10800, 9800, 8800, 7800, 6800, 5800, 4800, 3800, 2800, 1800,
+        // 28°C
+        -10800, -9800, -8800, -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200,
+        3200, 4200, 5200, 6200, 7200, 8200, 9200, 10200, 11200, 12200, 13200, 14200, 15200, 14200,
+        13200, 12200, 11200, 10200, 9200, 8200, 7200, 6200, 5200, 4200, 3200, 2200, 1200,
+        // 29°C
+        -11400, -10400, -9400, -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600,
+        2600, 3600, 4600, 5600, 6600, 7600, 8600, 9600, 10600, 11600, 12600, 13600, 14600, 13600,
+        12600, 11600, 10600, 9600, 8600, 7600, 6600, 5600, 4600, 3600, 2600, 1600, 600,
+        // 30°C
+        -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000,
+        2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 13000,
+        12000, 11000, 10000, 9000, 8000, 7000, 6000, 5000, 4000, 3000, 2000, 1000, 0,
+        // 31°C
+        -12600, -11600, -10600, -9600, -8600, -7600, -6600, -5600, -4600, -3600, -2600, -1600, -600, 400,
+        1400, 2400, 3400, 4400, 5400, 6400, 7400, 8400, 9400, 10400, 11400, 12400, 13400, 12400,
+        11400, 10400, 9400, 8400, 7400, 6400, 5400, 4400, 3400, 2400, 1400, 400, -600,
+        // 32°C
+        -13200, -12200, -11200, -10200, -9200, -8200, -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200,
+        800, 1800, 2800, 3800, 4800, 5800, 6800, 7800, 8800, 9800, 10800, 11800, 12800, 11800,
+        10800, 9800, 8800, 7800, 6800, 5800, 4800, 3800, 2800, 1800, 800, -200, -1200,
+        // 33°C
+        -13800, -12800, -11800, -10800, -9800, -8800, -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800,
+        200, 1200, 2200, 3200, 4200, 5200, 6200, 7200, 8200, 9200, 10200, 11200, 12200, 11200,
+        10200, 9200, 8200, 7200, 6200, 5200, 4200, 3200, 2200, 1200, 200, -800, -1800,
+        // 34°C
+        -14400, -13400, -12400, -11400, -10400, -9400, -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400,
+        -400, 600, 1600, 2600, 3600, 4600, 5600, 6600, 7600, 8600, 9600, 10600, 11600, 10600,
+        9600, 8600, 7600, 6600, 5600, 4600, 3600, 2600, 1600, 600, -400, -1400, -2400,
+        // 35°C
+        -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000,
+        -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 10000,
+        9000, 8000, 7000, 6000, 5000, 4000, 3000, 2000, 1000, 0, -1000, -2000, -3000,
+        // 36°C
+        -15600, -14600, -13600, -12600, -11600, -10600, -9600, -8600, -7600, -6600, -5600, -4600, -3600, -2600,
+        -1600, -600, 400, 1400, 2400, 3400, 4400, 5400, 6400, 7400, 8400, 9400, 10400, 9400,
+        8400, 7400, 6400, 5400, 4400, 3400, 2400, 1400, 400, -600, -1600, -2600, -3600,
+        // 37°C
+        -16200, -15200, -14200, -13200, -12200, -11200, -10200, -9200, -8200, -7200, -6200, -5200, -4200, -3200,
+        -2200, -1200, -200, 800, 1800, 2800, 3800, 4800, 5800, 6800, 7800, 8800, 9800, 8800,
+        7800, 6800, 5800, 4800, 3800, 2800, 1800, 800, -200, -1200, -2200, -3200, -4200,
+        // 38°C
+        -16800, -15800, -14800, -13800, -12800, -11800, -10800, -9800, -8800, -7800, -6800, -5800, -4800, -3800,
+        -2800, -1800, -800, 200, 1200, 2200, 3200, 4200, 5200, 6200, 7200, 8200, 9200, 8200,
+        7200, 6200, 5200, 4200, 3200, 2200, 1200, 200, -800, -1800, -2800, -3800, -4800,
+        // 39°C
+        -17400, -16400, -15400, -14400, -13400, -12400, -11400, -10400, -9400, -8400, -7400, -6400, -5400, -4400,
+        -3400, -2400, -1400, -400, 600, 1600, 2600, 3600, 4600, 5600, 6600, 7600, 8600, 7600,
+        6600, 5600, 4600, 3600, 2600, 1600, 600, -400, -1400, -2400, -3400, -4400, -5400,
+        // 40°C
+        -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000,
+        -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 7000,
+        6000, 5000, 4000, 3000, 2000, 1000, 0, -1000, -2000, -3000, -4000, -5000, -6000,
+        // 41°C
+        -18600, -17600, -16600, -15600, -14600, -13600, -12600, -11600, -10600, -9600, -8600, -7600, -6600, -5600,
+        -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400, 4400, 5400, 6400, 7400, 6400,
+        5400, 4400, 3400, 2400, 1400, 400, -600, -1600, -2600, -3600, -4600, -5600, -6600,
+        // 42°C
+        -19200, -18200, -17200, -16200, -15200, -14200, -13200, -12200, -11200, -10200, -9200, -8200, -7200, -6200,
+        -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800, 3800, 4800, 5800, 6800, 5800,
+        4800, 3800, 2800, 1800, 800, -200, -1200, -2200, -3200, -4200, -5200, -6200, -7200,
+        // 43°C
+        -19800, -18800, -17800, -16800, -15800, -14800, -13800, -12800, -11800, -10800, -9800, -8800, -7800, -6800,
+        -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200, 3200, 4200, 5200, 6200, 5200,
+        4200, 3200, 2200, 1200, 200, -800, -1800, -2800, -3800, -4800, -5800, -6800, -7800,
+        // 44°C
+        -20400, -19400, -18400, -17400, -16400, -15400, -14400, -13400, -12400, -11400, -10400, -9400, -8400, -7400,
+        -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600, 2600, 3600, 4600, 5600, 4600,
+        3600, 2600, 1600, 600, -400, -1400, -2400, -3400, -4400, -5400, -6400, -7400, -8400,
+        // 45°C
+        -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000,
+        -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 4000,
+        3000, 2000, 1000, 0, -1000, -2000, -3000, -4000, -5000, -6000, -7000, -8000, -9000,
+        // 46°C
+        -21600, -20600, -19600, -18600, -17600, -16600, -15600, -14600, -13600, -12600, -11600, -10600, -9600, -8600,
+        -7600, -6600, -5600, -4600, -3600, -2600, -1600, -600, 400, 1400, 2400, 3400, 4400, 3400,
+        2400, 1400, 400, -600, -1600, -2600, -3600, -4600, -5600, -6600, -7600, -8600, -9600,
+        // 47°C
+        -22200, -21200, -20200, -19200, -18200, -17200, -16200, -15200, -14200, -13200, -12200, -11200, -10200, -9200,
+        -8200, -7200, -6200, -5200, -4200, -3200, -2200, -1200, -200, 800, 1800, 2800, 3800, 2800,
+        1800, 800, -200, -1200, -2200, -3200, -4200, -5200, -6200, -7200, -8200, -9200, -10200,
+        // 48°C
+        -22800, -21800, -20800, -19800, -18800, -17800, -16800, -15800, -14800, -13800, -12800, -11800, -10800, -9800,
+        -8800, -7800, -6800, -5800, -4800, -3800, -2800, -1800, -800, 200, 1200, 2200, 3200, 2200,
+        1200, 200, -800, -1800, -2800, -3800, -4800, -5800, -6800, -7800, -8800, -9800, -10800,
+        // 49°C
+        -23400, -22400, -21400, -20400, -19400, -18400, -17400, -16400, -15400, -14400, -13400, -12400, -11400, -10400,
+        -9400, -8400, -7400, -6400, -5400, -4400, -3400, -2400, -1400, -400, 600, 1600, 2600, 1600,
+        600, -400, -1400, -2400, -3400, -4400, -5400, -6400, -7400, -8400, -9400, -10400, -11400,
+        // 50°C
+        -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000,
+        -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 1000,
+        0, -1000, -2000, -3000, -4000, -5000, -6000, -7000, -8000, -9000, -10000, -11000, -12000,
+    },
+    {   // Orange
+        // -10°C
+        -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000,
+        -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500,
+        6250, 7000, 7750, 8500, 9250, 10000, 10750, 11500, 10750, 10000, 9250, 8500, 7750,
+        // -9°C
+        -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500,
+        -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000,
+        6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000, 11250, 10500, 9750, 9000, 8250,
+        // -8°C
+        -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000,
+        -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500,
+        7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500, 11750, 11000, 10250, 9500, 8750,
+        // -7°C
+        -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500,
+        -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000,
+        7750, 8500, 9250, 10000, 10750, 11500, 12250, 13000, 12250, 11500, 10750, 10000, 9250,
+        // -6°C
+        -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000,
+        -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500,
+        8250, 9000, 9750, 10500, 11250, 12000, 12750, 13500, 12750, 12000, 11250, 10500, 9750,
+        // -5°C
+        -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500,
+        -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000,
+        8750, 9500, 10250, 11000, 11750, 12500, 13250, 14000, 13250, 12500, 11750, 11000, 10250,
+        // -4°C
+        -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000,
+        -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500,
+        9250, 10000, 10750, 11500, 12250, 13000, 13750, 14500, 13750, 13000, 12250, 11500, 10750,
+        // -3°C
+        -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500,
+        -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000,
+        9750, 10500, 11250, 12000, 12750, 13500, 14250, 15000, 14250, 13500, 12750, 12000, 11250,
+        // -2°C
+        -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000,
+        -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500,
+        10250, 11000, 11750, 12500, 13250, 14000, 14750, 15500, 14750, 14000, 13250, 12500, 11750,
+        // -1°C
+        -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500,
+        250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000,
+        10750, 11500, 12250, 13000, 13750, 14500, 15250, 16000, 15250, 14500, 13750, 13000, 12250,
+        // 0°C
+        -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0,
+        750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500,
+        11250, 12000, 12750, 13500, 14250, 15000, 15750, 16500, 15750, 15000, 14250, 13500, 12750,
+        // 1°C
+        -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500,
+        1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000,
+        11750, 12500, 13250, 14000, 14750, 15500, 16250, 17000, 16250, 15500, 14750, 14000, 13250,
+        // 2°C
+        -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000,
+        1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000, 10750, 11500,
+        12250, 13000, 13750, 14500, 15250, 16000, 16750, 17500, 16750, 16000, 15250, 14500, 13750,
+        // 3°C
+        -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500,
+        2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000,
+        12750, 13500, 14250, 15000, 15750, 16500, 17250, 18000, 17250, 16500, 15750, 15000, 14250,
+        // 4°C
+        -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000,
+        2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500,
+        13250, 14000, 14750, 15500, 16250, 17000, 17750, 18500, 17750, 17000, 16250, 15500, 14750,
+        // 5°C
+        -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500,
+        3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000, 10750, 11500, 12250, 13000,
+        13750, 14500, 15250, 16000, 16750, 17500, 18250, 19000, 18250, 17500, 16750, 16000, 15250,
+        // 6°C
+        -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000,
+        3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000, 12750, 13500,
+        14250, 15000, 15750, 16500, 17250, 18000, 18750, 19500, 18750, 18000, 17250, 16500, 15750,
+        // 7°C
+        -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 2750, 3500,
+        4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500, 13250, 14000,
+        14750, 15500, 16250, 17000, 17750, 18500, 19250, 20000, 19250, 18500, 17750, 17000, 16250,
+        // 8°C
+        -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000,
+        3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000, 12750, 13500,
+        14250, 15000, 15750, 16500, 17250, 18000, 18750, 19500, 18750, 18000, 17250, 16500, 15750,
+        // 9°C
+        -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500,
+        3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000, 10750, 11500, 12250, 13000,
+        13750, 14500, 15250, 16000, 16750, 17500, 18250, 19000, 18250, 17500, 16750, 16000, 15250,
+        // 10°C
+        -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000,
+        2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500,
+        13250, 14000, 14750, 15500, 16250, 17000, 17750, 18500, 17750, 17000, 16250, 15500, 14750,
+        // 11°C
+        -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500,
+        2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000,
+        12750, 13500, 14250, 15000, 15750, 16500, 17250, 18000, 17250, 16500, 15750, 15000, 14250,
+        // 12°C
+        -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000,
+        1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000, 10750, 11500,
+        12250, 13000, 13750, 14500, 15250, 16000, 16750, 17500, 16750, 16000, 15250, 14500, 13750,
+        // 13°C
+        -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500,
+        1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000,
+        11750, 12500, 13250, 14000, 14750, 15500, 16250, 17000, 16250, 15500, 14750, 14000, 13250,
+        // 14°C
+        -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0,
+        750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500,
+        11250, 12000, 12750, 13500, 14250, 15000, 15750, 16500, 15750, 15000, 14250, 13500, 12750,
+        // 15°C
+        -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500,
+        250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000,
+        10750, 11500, 12250, 13000, 13750, 14500, 15250, 16000, 15250, 14500, 13750, 13000, 12250,
+        // 16°C
+        -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000,
+        -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500,
+        10250, 11000, 11750, 12500, 13250, 14000, 14750, 15500, 14750, 14000, 13250, 12500, 11750,
+        // 17°C
+        -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500,
+        -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000,
+        9750, 10500, 11250, 12000, 12750, 13500, 14250, 15000, 14250, 13500, 12750, 12000, 11250,
+        // 18°C
+        -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000,
+        -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500,
+        9250, 10000, 10750, 11500, 12250, 13000, 13750, 14500, 13750, 13000, 12250, 11500, 10750,
+        // 19°C
+        -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500,
+        -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000,
+        8750, 9500, 10250, 11000, 11750, 12500, 13250, 14000, 13250, 12500, 11750, 11000, 10250,
+        // 20°C
+        -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000,
+        -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500,
+        8250, 9000, 9750, 10500, 11250, 12000, 12750, 13500, 12750, 12000, 11250, 10500, 9750,
+        // 21°C
+        -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500,
+        -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000,
+        7750, 8500, 9250, 10000, 10750, 11500, 12250, 13000, 12250, 11500, 10750, 10000, 9250,
+        // 22°C
+        -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000,
+        -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500,
+        7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500, 11750, 11000, 10250, 9500, 8750,
+        // 23°C
+        -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500,
+        -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000,
+        6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000, 11250, 10500, 9750, 9000, 8250,
+        // 24°C
+        -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000,
+        -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500,
+        6250, 7000, 7750, 8500, 9250, 10000, 10750, 11500, 10750, 10000, 9250, 8500, 7750,
+        // 25°C
+        -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500,
+        -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 4250, 5000,
+        5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000, 10250, 9500, 8750, 8000, 7250,
+        // 26°C
+        -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000,
+        -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 3750, 4500,
+        5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500, 9750, 9000, 8250, 7500, 6750,
+        // 27°C
+        -16250, -15500, -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500,
+        -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 3250, 4000,
+        4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000, 9250, 8500, 7750, 7000, 6250,
+        // 28°C
+        -16750, -16000, -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000,
+        -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 2750, 3500,
+        4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 8750, 8000, 7250, 6500, 5750,
+        // 29°C
+        -17250, -16500, -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500,
+        -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000,
+        3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 8250, 7500, 6750, 6000, 5250,
+        // 30°C
+        -17750, -17000, -16250, -15500, -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000,
+        -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500,
+        3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 7750, 7000, 6250, 5500, 4750,
+        // 31°C
+        -18250, -17500, -16750, -16000, -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500,
+        -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000,
+        2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 7250, 6500, 5750, 5000, 4250,
+        // 32°C
+        -18750, -18000, -17250, -16500, -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000,
+        -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500,
+        2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 6750, 6000, 5250, 4500, 3750,
+        // 33°C
+        -19250, -18500, -17750, -17000, -16250, -15500, -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500,
+        -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000,
+        1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 6250, 5500, 4750, 4000, 3250,
+        // 34°C
+        -19750, -19000, -18250, -17500, -16750, -16000, -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000,
+        -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500,
+        1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 5750, 5000, 4250, 3500, 2750,
+        // 35°C
+        -20250, -19500, -18750, -18000, -17250, -16500, -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500,
+        -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0,
+        750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 5250, 4500, 3750, 3000, 2250,
+        // 36°C
+        -20750, -20000, -19250, -18500, -17750, -17000, -16250, -15500, -14750, -14000, -13250, -12500, -11750, -11000,
+        -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500,
+        250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 4750, 4000, 3250, 2500, 1750,
+        // 37°C
+        -21250, -20500, -19750, -19000, -18250, -17500, -16750, -16000, -15250, -14500, -13750, -13000, -12250, -11500,
+        -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000,
+        -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 4250, 3500, 2750, 2000, 1250,
+        // 38°C
+        -21750, -21000, -20250, -19500, -18750, -18000, -17250, -16500, -15750, -15000, -14250, -13500, -12750, -12000,
+        -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500,
+        -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 3750, 3000, 2250, 1500, 750,
+        // 39°C
+        -22250, -21500, -20750, -20000, -19250, -18500, -17750, -17000, -16250, -15500, -14750, -14000, -13250, -12500,
+        -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000,
+        -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 3250, 2500, 1750, 1000, 250,
+        // 40°C
+        -22750, -22000, -21250, -20500, -19750, -19000, -18250, -17500, -16750, -16000, -15250, -14500, -13750, -13000,
+        -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500,
+        -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 2750, 2000, 1250, 500, -250,
+        // 41°C
+        -23250, -22500, -21750, -21000, -20250, -19500, -18750, -18000, -17250, -16500, -15750, -15000, -14250, -13500,
+        -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000,
+        -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 2250, 1500, 750, 0, -750,
+        // 42°C
+        -23750, -23000, -22250, -21500, -20750, -20000, -19250, -18500, -17750, -17000, -16250, -15500, -14750, -14000,
+        -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500,
+        -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 1750, 1000, 250, -500, -1250,
+        // 43°C
+        -24250, -23500, -22750, -22000, -21250, -20500, -19750, -19000, -18250, -17500, -16750, -16000, -15250, -14500,
+        -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000,
+        -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 1250, 500, -250, -1000, -1750,
+        // 44°C
+        -24750, -24000, -23250, -22500, -21750, -21000, -20250, -19500, -18750, -18000, -17250, -16500, -15750, -15000,
+        -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500,
+        -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 750, 0, -750, -1500, -2250,
+        // 45°C
+        -25250, -24500, -23750, -23000, -22250, -21500, -20750, -20000, -19250, -18500, -17750, -17000, -16250, -15500,
+        -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000,
+        -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 250, -500, -1250, -2000, -2750,
+        // 46°C
+        -25750, -25000, -24250, -23500, -22750, -22000, -21250, -20500, -19750, -19000, -18250, -17500, -16750, -16000,
+        -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500,
+        -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, -250, -1000, -1750, -2500, -3250,
+        // 47°C
+        -26250, -25500, -24750, -24000, -23250, -22500, -21750, -21000, -20250, -19500, -18750, -18000, -17250, -16500,
+        -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000,
+        -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, -750, -1500, -2250, -3000, -3750,
+        // 48°C
+        -26750, -26000, -25250, -24500, -23750, -23000, -22250, -21500, -20750, -20000, -19250, -18500, -17750, -17000,
+        -16250, -15500, -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500,
+        -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, -1250, -2000, -2750, -3500, -4250,
+        // 49°C
+        -27250, -26500, -25750, -25000, -24250, -23500, -22750, -22000, -21250, -20500, -19750, -19000, -18250, -17500,
+        -16750, -16000, -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000,
+        -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -1750, -2500, -3250, -4000, -4750,
+        // 50°C
+        -27750, -27000, -26250, -25500, -24750, -24000, -23250, -22500, -21750, -21000, -20250, -19500, -18750, -18000,
+        -17250, -16500, -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500,
+        -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -2250, -3000, -3750, -4500, -5250,
+    },
+    {   // Apple
+        // -10°C
+        -12550, -11800, -11050, -10300, -9550, -8800, -8050, -7300, -6550, -5800, -5050, -4300, -3550, -2800,
+        -2050, -1300, -550, 200, 950, 1700, 2450, 3200, 3950, 4700, 5450, 6200, 6950, 7700,
+        8450, 9200, 9950, 10700, 11450, 12200, 12950, 13700, 14450, 15200, 14450, 13700, 12950,
+        // -9°C
+        -12150, -11400, -10650, -9900, -9150, -8400, -7650, -6900, -6150, -5400, -4650, -3900, -3150, -2400,
+        -1650, -900, -150, 600, 1350, 2100, 2850, 3600, 4350, 5100, 5850, 6600, 7350, 8100,
+        8850, 9600, 10350, 11100, 11850, 12600, 13350, 14100, 14850, 15600, 14850, 14100, 13350,
+        // -8°C
+        -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000,
+        -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500,
+        9250, 10000, 10750, 11500, 12250, 13000, 13750, 14500, 15250, 16000, 15250, 14500, 13750,
+        // -7°C
+        -11350, -10600, -9850, -9100, -8350, -7600, -6850, -6100, -5350, -4600, -3850, -3100, -2350, -1600,
+        -850, -100, 650, 1400, 2150, 2900, 3650, 4400, 5150, 5900, 6650, 7400, 8150, 8900,
+        9650, 10400, 11150, 11900, 12650, 13400, 14150, 14900, 15650, 16400, 15650, 14900, 14150,
+        // -6°C
+        -10950, -10200, -9450, -8700, -7950, -7200, -6450, -5700, -4950, -4200, -3450, -2700, -1950, -1200,
+        -450, 300, 1050, 1800, 2550, 3300, 4050, 4800, 5550, 6300, 7050, 7800, 8550, 9300,
+        10050, 10800, 11550, 12300, 13050, 13800, 14550, 15300, 16050, 16800, 16050, 15300, 14550,
+        // -5°C
+        -10550, -9800, -9050, -8300, -7550, -6800, -6050, -5300, -4550, -3800, -3050, -2300, -1550, -800,
+        -50, 700, 1450, 2200, 2950, 3700, 4450, 5200, 5950, 6700, 7450, 8200, 8950, 9700,
+        10450, 11200, 11950, 12700, 13450, 14200, 14950, 15700, 16450, 17200, 16450, 15700, 14950,
+        // -4°C
+        -10150, -9400, -8650, -7900, -7150, -6400, -5650, -4900, -4150, -3400, -2650, -1900, -1150, -400,
+        350, 1100, 1850, 2600, 3350, 4100, 4850, 5600, 6350, 7100, 7850, 8600, 9350, 10100,
+        10850, 11600, 12350, 13100, 13850, 14600, 15350, 16100, 16850, 17600, 16850, 16100, 15350,
+        // -3°C
+        -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0,
+        750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500,
+        11250, 12000, 12750, 13500, 14250, 15000, 15750, 16500, 17250, 18000, 17250, 16500, 15750,
+        // -2°C
+        -9350, -8600, -7850, -7100, -6350, -5600, -4850, -4100, -3350, -2600, -1850, -1100, -350, 400,
+        1150, 1900, 2650, 3400, 4150, 4900, 5650, 6400, 7150, 7900, 8650, 9400, 10150, 10900,
+        11650, 12400, 13150, 13900, 14650, 15400, 16150, 16900, 17650, 18400, 17650, 16900, 16150,
+        // -1°C
+        -8950, -8200, -7450, -6700, -5950, -5200, -4450, -3700, -2950, -2200, -1450, -700, 50, 800,
+        1550, 2300, 3050, 3800, 4550, 5300, 6050, 6800, 7550, 8300, 9050, 9800, 10550, 11300,
+        12050, 12800, 13550, 14300, 15050, 15800, 16550, 17300, 18050, 18800, 18050, 17300, 16550,
+        // 0°C
+        -8550, -7800, -7050, -6300, -5550, -4800, -4050, -3300, -2550, -1800, -1050, -300, 450, 1200,
+        1950, 2700, 3450, 4200, 4950, 5700, 6450, 7200, 7950, 8700, 9450, 10200, 10950, 11700,
+        12450, 13200, 13950, 14700, 15450, 16200, 16950, 17700, 18450, 19200, 18450, 17700, 16950,
+        // 1°C
+        -8150, -7400, -6650, -5900, -5150, -4400, -3650, -2900, -2150, -1400, -650, 100, 850, 1600,
+        2350, 3100, 3850, 4600, 5350, 6100, 6850, 7600, 8350, 9100, 9850, 10600, 11350, 12100,
+        12850, 13600, 14350, 15100, 15850, 16600, 17350, 18100, 18850, 19600, 18850, 18100, 17350,
+        // 2°C
+        -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000,
+        2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500,
+        13250, 14000, 14750, 15500, 16250, 17000, 17750, 18500, 19250, 20000, 19250, 18500, 17750,
+        // 3°C
+        -8150, -7400, -6650, -5900, -5150, -4400, -3650, -2900, -2150, -1400, -650, 100, 850, 1600,
+        2350, 3100, 3850, 4600, 5350, 6100, 6850, 7600, 8350, 9100, 9850, 10600, 11350, 12100,
+        12850, 13600, 14350, 15100, 15850, 16600, 17350, 18100, 18850, 19600, 18850, 18100, 17350,
+        // 4°C
+        -8550, -7800, -7050, -6300, -5550, -4800, -4050, -3300, -2550, -1800, -1050, -300, 450, 1200,
+        1950, 2700, 3450, 4200, 4950, 5700, 6450, 7200, 7950, 8700, 9450, 10200, 10950, 11700,
+        12450, 13200, 13950, 14700, 15450, 16200, 16950, 17700, 18450, 19200, 18450, 17700, 16950,
+        // 5°C
+        -8950, -8200, -7450, -6700, -5950, -5200, -4450, -3700, -2950, -2200, -1450, -700, 50, 800,
+        1550, 2300, 3050, 3800, 4550, 5300, 6050, 6800, 7550, 8300, 9050, 9800, 10550, 11300,
+        12050, 12800, 13550, 14300, 15050, 15800, 16550, 17300, 18050, 18800, 18050, 17300, 16550,
+        // 6°C
+        -9350, -8600, -7850, -7100, -6350, -5600, -4850, -4100, -3350, -2600, -1850, -1100, -350, 400,
+        1150, 1900, 2650, 3400, 4150, 4900, 5650, 6400, 7150, 7900, 8650, 9400, 10150, 10900,
+        11650, 12400, 13150, 13900, 14650, 15400, 16150, 16900, 17650, 18400, 17650, 16900, 16150,
+        // 7°C
+        -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500, -750, 0,
+        750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500,
+        11250, 12000, 12750, 13500, 14250, 15000, 15750, 16500, 17250, 18000, 17250, 16500, 15750,
+        // 8°C
+        -10150, -9400, -8650, -7900, -7150, -6400, -5650, -4900, -4150, -3400, -2650, -1900, -1150, -400,
+        350, 1100, 1850, 2600, 3350, 4100, 4850, 5600, 6350, 7100, 7850, 8600, 9350, 10100,
+        10850, 11600, 12350, 13100, 13850, 14600, 15350, 16100, 16850, 17600, 16850, 16100, 15350,
+        // 9°C
+        -10550, -9800, -9050, -8300, -7550, -6800, -6050, -5300, -4550, -3800, -3050, -2300, -1550, -800,
+        -50, 700, 1450, 2200, 2950, 3700, 4450, 5200, 5950, 6700, 7450, 8200, 8950, 9700,
+        10450, 11200, 11950, 12700, 13450, 14200, 14950, 15700, 16450, 17200, 16450, 15700, 14950,
+        // 10°C
+        -10950, -10200, -9450, -8700, -7950, -7200, -6450, -5700, -4950, -4200, -3450, -2700, -1950, -1200,
+        -450, 300, 1050, 1800, 2550, 3300, 4050, 4800, 5550, 6300, 7050, 7800, 8550, 9300,
+        10050, 10800, 11550, 12300, 13050, 13800, 14550, 15300, 16050, 16800, 16050, 15300, 14550,
+        // 11°C
+        -11350, -10600, -9850, -9100, -8350, -7600, -6850, -6100, -5350, -4600, -3850, -3100, -2350, -1600,
+        -850, -100, 650, 1400, 2150, 2900, 3650, 4400, 5150, 5900, 6650, 7400, 8150, 8900,
+        9650, 10400, 11150, 11900, 12650, 13400, 14150, 14900, 15650, 16400, 15650, 14900, 14150,
+        // 12°C
+        -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000,
+        -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500,
+        9250, 10000, 10750, 11500, 12250, 13000, 13750, 14500, 15250, 16000, 15250, 14500, 13750,
+        // 13°C
+        -12150, -11400, -10650, -9900, -9150, -8400, -7650, -6900, -6150, -5400, -4650, -3900, -3150, -2400,
+        -1650, -900, -150, 600, 1350, 2100, 2850, 3600, 4350, 5100, 5850, 6600, 7350, 8100,
+        8850, 9600, 10350, 11100, 11850, 12600, 13350, 14100, 14850, 15600, 14850, 14100, 13350,
+        // 14°C
+        -12550, -11800, -11050, -10300, -9550, -8800, -8050, -7300, -6550, -5800, -5050, -4300, -3550, -2800,
+        -2050, -1300, -550, 200, 950, 1700, 2450, 3200, 3950, 4700, 5450, 6200, 6950, 7700,
+        8450, 9200, 9950, 10700, 11450, 12200, 12950, 13700, 14450, 15200, 14450, 13700, 12950,
+        // 15°C
+        -12950, -12200, -11450, -10700, -9950, -9200, -8450, -7700, -6950, -6200, -5450, -4700, -3950, -3200,
+        -2450, -1700, -950, -200, 550, 1300, 2050, 2800, 3550, 4300, 5050, 5800, 6550, 7300,
+        8050, 8800, 9550, 10300, 11050, 11800, 12550, 13300, 14050, 14800, 14050, 13300, 12550,
+        // 16°C
+        -13350, -12600, -11850, -11100, -10350, -9600, -8850, -8100, -7350, -6600, -5850, -5100, -4350, -3600,
+        -2850, -2100, -1350, -600, 150, 900, 1650, 2400, 3150, 3900, 4650, 5400, 6150, 6900,
+        7650, 8400, 9150, 9900, 10650, 11400, 12150, 12900, 13650, 14400, 13650, 12900, 12150,
+        // 17°C
+        -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000,
+        -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500,
+        7250, 8000, 8750, 9500, 10250, 11000, 11750, 12500, 13250, 14000, 13250, 12500, 11750,
+        // 18°C
+        -14150, -13400, -12650, -11900, -11150, -10400, -9650, -8900, -8150, -7400, -6650, -5900, -5150, -4400,
+        -3650, -2900, -2150, -1400, -650, 100, 850, 1600, 2350, 3100, 3850, 4600, 5350, 6100,
+        6850, 7600, 8350, 9100, 9850, 10600, 11350, 12100, 12850, 13600, 12850, 12100, 11350,
+        // 19°C
+        -14550, -13800, -13050, -12300, -11550, -10800, -10050, -9300, -8550, -7800, -7050, -6300, -5550, -4800,
+        -4050, -3300, -2550, -1800, -1050, -300, 450, 1200, 1950, 2700, 3450, 4200, 4950, 5700,
+        6450, 7200, 7950, 8700, 9450, 10200, 10950, 11700, 12450, 13200, 12450, 11700, 10950,
+        // 20°C
+        -14950, -14200, -13450, -12700, -11950, -11200, -10450, -9700, -8950, -8200, -7450, -6700, -5950, -5200,
+        -4450, -3700, -2950, -2200, -1450, -700, 50, 800, 1550, 2300, 3050, 3800, 4550, 5300,
+        6050, 6800, 7550, 8300, 9050, 9800, 10550, 11300, 12050, 12800, 12050, 11300, 10550,
+        // 21°C
+        -15350, -14600, -13850, -13100, -12350, -11600, -10850, -10100, -9350, -8600, -7850, -7100, -6350, -5600,
+        -4850, -4100, -3350, -2600, -1850, -1100, -350, 400, 1150, 1900, 2650, 3400, 4150, 4900,
+        5650, 6400, 7150, 7900, 8650, 9400, 10150, 10900, 11650, 12400, 11650, 10900, 10150,
+        // 22°C
+        -15750, -15000, -14250, -13500, -12750, -12000, -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000,
+        -5250, -4500, -3750, -3000, -2250, -1500, -750, 0, 750, 1500, 2250, 3000, 3750, 4500,
+        5250, 6000, 6750, 7500, 8250, 9000, 9750, 10500, 11250, 12000, 11250, 10500, 9750,
+        // 23°C
+        -16150, -15400, -14650, -13900, -13150, -12400, -11650, -10900, -10150, -9400, -8650, -7900, -7150, -6400,
+        -5650, -4900, -4150, -3400, -2650, -1900, -1150, -400, 350, 1100, 1850, 2600, 3350, 4100,
+        4850, 5600, 6350, 7100, 7850, 8600, 9350, 10100, 10850, 11600, 10850, 10100, 9350,
+        // 24°C
+        -16550, -15800, -15050, -14300, -13550, -12800, -12050, -11300, -10550, -9800, -9050, -8300, -7550, -6800,
+        -6050, -5300, -4550, -3800, -3050, -2300, -1550, -800, -50, 700, 1450, 2200, 2950, 3700,
+        4450, 5200, 5950, 6700, 7450, 8200, 8950, 9700, 10450, 11200, 10450, 9700, 8950,
+        // 25°C
+        -16950, -16200, -15450, -14700, -13950, -13200, -12450, -11700, -10950, -10200, -9450, -8700, -7950, -7200,
+        -6450, -5700, -4950, -4200, -3450, -2700, -1950, -1200, -450, 300, 1050, 1800, 2550, 3300,
+        4050, 4800, 5550, 6300, 7050, 7800, 8550, 9300, 10050, 10800, 10050, 9300, 8550,
+        // 26°C
+        -17350, -16600, -15850, -15100, -14350, -13600, -12850, -12100, -11350, -10600, -9850, -9100, -8350, -7600,
+        -6850, -6100, -5350, -4600, -3850, -3100, -2350, -1600, -850, -100, 650, 1400, 2150, 2900,
+        3650, 4400, 5150, 5900, 6650, 7400, 8150, 8900, 9650, 10400, 9650, 8900, 8150,
+        // 27°C
+        -17750, -17000, -16250, -15500, -14750, -14000, -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000,
+        -7250, -6500, -5750, -5000, -4250, -3500, -2750, -2000, -1250, -500, 250, 1000, 1750, 2500,
+        3250, 4000, 4750, 5500, 6250, 7000, 7750, 8500, 9250, 10000, 9250, 8500, 7750,
+        // 28°C
+        -18150, -17400, -16650, -15900, -15150, -14400, -13650, -12900, -12150, -11400, -10650, -9900, -9150, -8400,
+        -7650, -6900, -6150, -5400, -4650, -3900, -3150, -2400, -1650, -900, -150, 600, 1350, 2100,
+        2850, 3600, 4350, 5100, 5850, 6600, 7350, 8100, 8850, 9600, 8850, 8100, 7350,
+        // 29°C
+        -18550, -17800, -17050, -16300, -15550, -14800, -14050, -13300, -12550, -11800, -11050, -10300, -9550, -8800,
+        -8050, -7300, -6550, -5800, -5050, -4300, -3550, -2800, -2050, -1300, -550, 200, 950, 1700,
+        2450, 3200, 3950, 4700, 5450, 6200, 6950, 7700, 8450, 9200, 8450, 7700, 6950,
+        // 30°C
+        -18950, -18200, -17450, -16700, -15950, -15200, -14450, -13700, -12950, -12200, -11450, -10700, -9950, -9200,
+        -8450, -7700, -6950, -6200, -5450, -4700, -3950, -3200, -2450, -1700, -950, -200, 550, 1300,
+        2050, 2800, 3550, 4300, 5050, 5800, 6550, 7300, 8050, 8800, 8050, 7300, 6550,
+        // 31°C
+        -19350, -18600, -17850, -17100, -16350, -15600, -14850, -14100, -13350, -12600, -11850, -11100, -10350, -9600,
+        -8850, -8100, -7350, -6600, -5850, -5100, -4350, -3600, -2850, -2100, -1350, -600, 150, 900,
+        1650, 2400, 3150, 3900, 4650, 5400, 6150, 6900, 7650, 8400, 7650, 6900, 6150,
+        // 32°C
+        -19750, -19000, -18250, -17500, -16750, -16000, -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000,
+        -9250, -8500, -7750, -7000, -6250, -5500, -4750, -4000, -3250, -2500, -1750, -1000, -250, 500,
+        1250, 2000, 2750, 3500, 4250, 5000, 5750, 6500, 7250, 8000, 7250, 6500, 5750,
+        // 33°C
+        -20150, -19400, -18650, -17900, -17150, -16400, -15650, -14900, -14150, -13400, -12650, -11900, -11150, -10400,
+        -9650, -8900, -8150, -7400, -6650, -5900, -5150, -4400, -3650, -2900, -2150, -1400, -650, 100,
+        850, 1600, 2350, 3100, 3850, 4600, 5350, 6100, 6850, 7600, 6850, 6100, 5350,
+        // 34°C
+        -20550, -19800, -19050, -18300, -17550, -16800, -16050, -15300, -14550, -13800, -13050, -12300, -11550, -10800,
+        -10050, -9300, -8550, -7800, -7050, -6300, -5550, -4800, -4050, -3300, -2550, -1800, -1050, -300,
+        450, 1200, 1950, 2700, 3450, 4200, 4950, 5700, 6450, 7200, 6450, 5700, 4950,
+        // 35°C
+        -20950, -20200, -19450, -18700, -17950, -17200, -16450, -15700, -14950, -14200, -13450, -12700, -11950, -11200,
+        -10450, -9700, -8950, -8200, -7450, -6700, -5950, -5200, -4450, -3700, -2950, -2200, -1450, -700,
+        50, 800, 1550, 2300, 3050, 3800, 4550, 5300, 6050, 6800, 6050, 5300, 4550,
+        // 36°C
+        -21350, -20600, -19850, -19100, -18350, -17600, -16850, -16100, -15350, -14600, -13850, -13100, -12350, -11600,
+        -10850, -10100, -9350, -8600, -7850, -7100, -6350, -5600, -4850, -4100, -3350, -2600, -1850, -1100,
+        -350, 400, 1150, 1900, 2650, 3400, 4150, 4900, 5650, 6400, 5650, 4900, 4150,
+        // 37°C
+        -21750, -21000, -20250, -19500, -18750, -18000, -17250, -16500, -15750, -15000, -14250, -13500, -12750, -12000,
+        -11250, -10500, -9750, -9000, -8250, -7500, -6750, -6000, -5250, -4500, -3750, -3000, -2250, -1500,
+        -750, 0, 750, 1500, 2250, 3000, 3750, 4500, 5250, 6000, 5250, 4500, 3750,
+        // 38°C
+        -22150, -21400, -20650, -19900, -19150, -18400, -17650, -16900, -16150, -15400, -14650, -13900, -13150, -12400,
+        -11650, -10900, -10150, -9400, -8650, -7900, -7150, -6400, -5650, -4900, -4150, -3400, -2650, -1900,
+        -1150, -400, 350, 1100, 1850, 2600, 3350, 4100, 4850, 5600, 4850, 4100, 3350,
+        // 39°C
+        -22550, -21800, -21050, -20300, -19550, -18800, -18050, -17300, -16550, -15800, -15050, -14300, -13550, -12800,
+        -12050, -11300, -10550, -9800, -9050, -8300, -7550, -6800, -6050, -5300, -4550, -3800, -3050, -2300,
+        -1550, -800, -50, 700, 1450, 2200, 2950, 3700, 4450, 5200, 4450, 3700, 2950,
+        // 40°C
+        -22950, -22200, -21450, -20700, -19950, -19200, -18450, -17700, -16950, -16200, -15450, -14700, -13950, -13200,
+        -12450, -11700, -10950, -10200, -9450, -8700, -7950, -7200, -6450, -5700, -4950, -4200, -3450, -2700,
+        -1950, -1200, -450, 300, 1050, 1800, 2550, 3300, 4050, 4800, 4050, 3300, 2550,
+        // 41°C
+        -23350, -22600, -21850, -21100, -20350, -19600, -18850, -18100, -17350, -16600, -15850, -15100, -14350, -13600,
+        -12850, -12100, -11350, -10600, -9850, -9100, -8350, -7600, -6850, -6100, -5350, -4600, -3850, -3100,
+        -2350, -1600, -850, -100, 650, 1400, 2150, 2900, 3650, 4400, 3650, 2900, 2150,
+        // 42°C
+        -23750, -23000, -22250, -21500, -20750, -20000, -19250, -18500, -17750, -17000, -16250, -15500, -14750, -14000,
+        -13250, -12500, -11750, -11000, -10250, -9500, -8750, -8000, -7250, -6500, -5750, -5000, -4250, -3500,
+        -2750, -2000, -1250, -500, 250, 1000, 1750, 2500, 3250, 4000, 3250, 2500, 1750,
+        // 43°C
+        -24150, -23400, -22650, -21900, -21150, -20400, -19650, -18900, -18150, -17400, -16650, -15900, -15150, -14400,
+        -13650, -12900, -12150, -11400, -10650, -9900, -9150, -8400, -7650, -6900, -6150, -5400, -4650, -3900,
+        -3150, -2400, -1650, -900, -150, 600, 1350, 2100, 2850, 3600, 2850, 2100, 1350,
+        // 44°C
+        -24550, -23800, -23050, -22300, -21550, -20800, -20050, -19300, -18550, -17800, -17050, -16300, -15550, -14800,
+        -14050, -13300, -12550, -11800, -11050, -10300, -9550, -8800, -8050, -7300, -6550, -5800, -5050, -4300,
+        -3550, -2800, -2050, -1300, -550, 200, 950, 1700, 2450, 3200, 2450, 1700, 950,
+        // 45°C
+        -24950, -24200, -23450, -22700, -21950, -21200, -20450, -19700, -18950, -18200, -17450, -16700, -15950, -15200,
+        -14450, -13700, -12950, -12200, -11450, -10700, -9950, -9200, -8450, -7700, -6950, -6200, -5450, -4700,
+        -3950, -3200, -2450, -1700, -950, -200, 550, 1300, 2050, 2800, 2050, 1300, 550,
+        // 46°C
+        -25350, -24600, -23850, -23100, -22350, -21600, -20850, -20100, -19350, -18600, -17850, -17100, -16350, -15600,
+        -14850, -14100, -13350, -12600, -11850, -11100, -10350, -9600, -8850, -8100, -7350, -6600, -5850, -5100,
+        -4350, -3600, -2850, -2100, -1350, -600, 150, 900, 1650, 2400, 1650, 900, 150,
+        // 47°C
+        -25750, -25000, -24250, -23500, -22750, -22000, -21250, -20500, -19750, -19000, -18250, -17500, -16750, -16000,
+        -15250, -14500, -13750, -13000, -12250, -11500, -10750, -10000, -9250, -8500, -7750, -7000, -6250, -5500,
+        -4750, -4000, -3250, -2500, -1750, -1000, -250, 500, 1250, 2000, 1250, 500, -250,
+        // 48°C
+        -26150, -25400, -24650, -23900, -23150, -22400, -21650, -20900, -20150, -19400, -18650, -17900, -17150, -16400,
+        -15650, -14900, -14150, -13400, -12650, -11900, -11150, -10400, -9650, -8900, -8150, -7400, -6650, -5900,
+        -5150, -4400, -3650, -2900, -2150, -1400, -650, 100, 850, 1600, 850, 100, -650,
+        // 49°C
+        -26550, -25800, -25050, -24300, -23550, -22800, -22050, -21300, -20550, -19800, -19050, -18300, -17550, -16800,
+        -16050, -15300, -14550, -13800, -13050, -12300, -11550, -10800, -10050, -9300, -8550, -7800, -7050, -6300,
+        -5550, -4800, -4050, -3300, -2550, -1800, -1050, -300, 450, 1200, 450, -300, -1050,
+        // 50°C
+        -26950, -26200, -25450, -24700, -23950, -23200, -22450, -21700, -20950, -20200, -19450, -18700, -17950, -17200,
+        -16450, -15700, -14950, -14200, -13450, -12700, -11950, -11200, -10450, -9700, -8950, -8200, -7450, -6700,
+        -5950, -5200, -4450, -3700, -2950, -2200, -1450, -700, 50, 800, 50, -700, -1450,
+    },
+    {   // Grape
+        // -10°C
+        -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500,
+        -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500,
+        5500, 6500, 7500, 8500, 9500, 10500, 11500, 12500, 13500, 14500, 13500, 12500, 11500,
+        // -9°C
+        -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000,
+        -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000,
+        6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 14000, 13000, 12000,
+        // -8°C
+        -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500,
+        -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500,
+        6500, 7500, 8500, 9500, 10500, 11500, 12500, 13500, 14500, 15500, 14500, 13500, 12500,
+        // -7°C
+        -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000,
+        -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000,
+        7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 15000, 14000, 13000,
+        // -6°C
+        -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500,
+        -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500,
+        7500, 8500, 9500, 10500, 11500, 12500, 13500, 14500, 15500, 16500, 15500, 14500, 13500,
+        // -5°C
+        -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000,
+        -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000,
+        8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 16000, 15000, 14000,
+        // -4°C
+        -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500,
+        -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500,
+        8500, 9500, 10500, 11500, 12500, 13500, 14500, 15500, 16500, 17500, 16500, 15500, 14500,
+        // -3°C
+        -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000,
+        -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000,
+        9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 18000, 17000, 16000, 15000,
+        // -2°C
+        -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500,
+        -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500,
+        9500, 10500, 11500, 12500, 13500, 14500, 15500, 16500, 17500, 18500, 17500, 16500, 15500,
+        // -1°C
+        -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000,
+        -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000,
+        10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 18000, 19000, 18000, 17000, 16000,
+        // 0°C
+        -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500,
+        -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500, 9500,
+        10500, 11500, 12500, 13500, 14500, 15500, 16500, 17500, 18500, 19500, 18500, 17500, 16500,
+        // 1°C
+        -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000,
+        -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000,
+        11000, 12000, 13000, 14000, 15000, 16000, 17000, 18000, 19000, 20000, 19000, 18000, 17000,
+        // 2°C
+        -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500,
+        -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500, 9500,
+        10500, 11500, 12500, 13500, 14500, 15500, 16500, 17500, 18500, 19500, 18500, 17500, 16500,
+        // 3°C
+        -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000,
+        -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000,
+        10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 18000, 19000, 18000, 17000, 16000,
+        // 4°C
+        -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500,
+        -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500,
+        9500, 10500, 11500, 12500, 13500, 14500, 15500, 16500, 17500, 18500, 17500, 16500, 15500,
+        // 5°C
+        -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000,
+        -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000,
+        9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 18000, 17000, 16000, 15000,
+        // 6°C
+        -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500,
+        -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500,
+        8500, 9500, 10500, 11500, 12500, 13500, 14500, 15500, 16500, 17500, 16500, 15500, 14500,
+        // 7°C
+        -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000,
+        -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000,
+        8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000, 16000, 15000, 14000,
+        // 8°C
+        -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500,
+        -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500,
+        7500, 8500, 9500, 10500, 11500, 12500, 13500, 14500, 15500, 16500, 15500, 14500, 13500,
+        // 9°C
+        -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000,
+        -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000,
+        7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 16000, 15000, 14000, 13000,
+        // 10°C
+        -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500,
+        -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500,
+        6500, 7500, 8500, 9500, 10500, 11500, 12500, 13500, 14500, 15500, 14500, 13500, 12500,
+        // 11°C
+        -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000,
+        -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000,
+        6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000, 14000, 13000, 12000,
+        // 12°C
+        -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500,
+        -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500,
+        5500, 6500, 7500, 8500, 9500, 10500, 11500, 12500, 13500, 14500, 13500, 12500, 11500,
+        // 13°C
+        -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000,
+        -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000,
+        5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 13000, 12000, 11000,
+        // 14°C
+        -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500,
+        -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500,
+        4500, 5500, 6500, 7500, 8500, 9500, 10500, 11500, 12500, 13500, 12500, 11500, 10500,
+        // 15°C
+        -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000,
+        -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000,
+        4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 12000, 11000, 10000,
+        // 16°C
+        -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500,
+        -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500,
+        3500, 4500, 5500, 6500, 7500, 8500, 9500, 10500, 11500, 12500, 11500, 10500, 9500,
+        // 17°C
+        -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000,
+        -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000,
+        3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 11000, 10000, 9000,
+        // 18°C
+        -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500,
+        -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500,
+        2500, 3500, 4500, 5500, 6500, 7500, 8500, 9500, 10500, 11500, 10500, 9500, 8500,
+        // 19°C
+        -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000,
+        -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000,
+        2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 10000, 9000, 8000,
+        // 20°C
+        -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500,
+        -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500,
+        1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500, 9500, 10500, 9500, 8500, 7500,
+        // 21°C
+        -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000,
+        -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0,
+        1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 9000, 8000, 7000,
+        // 22°C
+        -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500,
+        -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500,
+        500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500, 9500, 8500, 7500, 6500,
+        // 23°C
+        -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000,
+        -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000,
+        0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 8000, 7000, 6000,
+        // 24°C
+        -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500,
+        -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500,
+        -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 8500, 7500, 6500, 5500,
+        // 25°C
+        -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000,
+        -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000,
+        -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 7000, 6000, 5000,
+        // 26°C
+        -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500,
+        -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500,
+        -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 7500, 6500, 5500, 4500,
+        // 27°C
+        -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000,
+        -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000,
+        -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 6000, 5000, 4000,
+        // 28°C
+        -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500,
+        -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500,
+        -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 6500, 5500, 4500, 3500,
+        // 29°C
+        -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000,
+        -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000,
+        -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 5000, 4000, 3000,
+        // 30°C
+        -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500,
+        -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500,
+        -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 5500, 4500, 3500, 2500,
+        // 31°C
+        -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000,
+        -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000,
+        -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 4000, 3000, 2000,
+        // 32°C
+        -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500,
+        -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500,
+        -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 4500, 3500, 2500, 1500,
+        // 33°C
+        -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000,
+        -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000,
+        -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 3000, 2000, 1000,
+        // 34°C
+        -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500,
+        -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500,
+        -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 3500, 2500, 1500, 500,
+        // 35°C
+        -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000, -21000,
+        -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000,
+        -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 2000, 1000, 0,
+        // 36°C
+        -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500, -21500,
+        -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500, -7500,
+        -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 2500, 1500, 500, -500,
+        // 37°C
+        -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000, -22000,
+        -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000,
+        -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 1000, 0, -1000,
+        // 38°C
+        -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500, -22500,
+        -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500, -8500,
+        -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, 1500, 500, -500, -1500,
+        // 39°C
+        -32768, -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000, -23000,
+        -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000,
+        -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 0, -1000, -2000,
+        // 40°C
+        -32768, -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500, -23500,
+        -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500, -9500,
+        -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, 500, -500, -1500, -2500,
+        // 41°C
+        -32768, -32768, -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000, -24000,
+        -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000, -10000,
+        -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, -1000, -2000, -3000,
+        // 42°C
+        -32768, -32768, -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500, -24500,
+        -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500, -10500,
+        -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -500, -1500, -2500, -3500,
+        // 43°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000, -25000,
+        -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000, -11000,
+        -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, -2000, -3000, -4000,
+        // 44°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500, -25500,
+        -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500, -11500,
+        -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -1500, -2500, -3500, -4500,
+        // 45°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000, -26000,
+        -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000, -12000,
+        -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -3000, -4000, -5000,
+        // 46°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500, -26500,
+        -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500, -12500,
+        -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -2500, -3500, -4500, -5500,
+        // 47°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000, -27000,
+        -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000, -13000,
+        -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -4000, -5000, -6000,
+        // 48°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500, -27500,
+        -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500, -13500,
+        -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -3500, -4500, -5500, -6500,
+        // 49°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32000, -31000, -30000, -29000, -28000,
+        -27000, -26000, -25000, -24000, -23000, -22000, -21000, -20000, -19000, -18000, -17000, -16000, -15000, -14000,
+        -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -5000, -6000, -7000,
+        // 50°C
+        -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32500, -31500, -30500, -29500, -28500,
+        -27500, -26500, -25500, -24500, -23500, -22500, -21500, -20500, -19500, -18500, -17500, -16500, -15500, -14500,
+        -13500, -12500, -11500, -10500, -9500, -8500, -7500, -6500, -5500, -4500, -5500, -6500, -7500,
+    },
+};
+
+#endif
@@ -9,24 +9,90 @@ Sensors::Sensors() : dht(DHT_PIN, DHT_TYPE) {
     gasBaseline = 0;
     calibrationSamples = 0;
     calibrationSum = 0;
+    gasOversampled = false;
+#if DHT_ASYNC
+    haveReading = false;
+#endif
 }
 
 // 初始化传感器
 void Sensors::begin() {
+#if DHT_ASYNC
+    DHT22Async::begin(DHT_PIN);
+    DHT22Async::start();
+#else
     dht.begin();
+#endif
     pinMode(MQ_PIN, INPUT);
+#if GAS_ADC_DMA
+    gasOversampled = GasADC::begin(MQ_PIN);
+#endif
+}
+
+// 读取气体：过采样模式取窗口统计，否则单次analogRead
+// （过采样运行时不能再调用analogRead，它会重配并关闭ADC）
+void Sensors::readGas(int& mean, int& min, int& max) {
+#if GAS_ADC_DMA
+    if (gasOversampled) {
+        GasStats stats;
+        if (GasADC::read(stats)) {
+            mean = stats.mean;
+            min = stats.min;
+            max = stats.max;
+        } else {
+            mean = min = max = gasBaseline;
+        }
+        return;
+    }
+#endif
+    mean = min = max = analogRead(MQ_PIN);
+}
+
+// 开始一次新的温湿度转换：begin()里的那次转换到第一次采样时已经过了
+// 校准和入网（十几秒），超过DHT_MAX_AGE_MS，第一次采样会无效
+void Sensors::startReading() {
+#if DHT_ASYNC
+    DHT22Async::start();
+#endif
 }
 
 // 读取所有传感器
 SensorData Sensors::readSensors() {
     SensorData data;
     
+#if DHT_ASYNC
+    // 取上一次后台转换的结果，然后开始下一次
+    // （DHT22两次转换至少间隔2秒，提前采样时沿用上一次读数）
+    DHT22Reading reading;
+    if (DHT22Async::poll(reading)) {
+        lastReading = reading;
+        haveReading = true;
+    }
+    DHT22Async::start();
+    
+    if (haveReading && millis() - lastReading.time < DHT_MAX_AGE_MS) {
+        data.temperatureX10 = lastReading.temperatureX10;
+        data.humidityX10 = lastReading.humidityX10;
+        data.temperature = lastReading.temperatureX10 / 10.0;
+        data.humidity = lastReading.humidityX10 / 10.0;
+    } else {
+        data.temperature = NAN;
+        data.humidity = NAN;
+        data.temperatureX10 = 0;
+        data.humidityX10 = 0;
+    }
+#else
     // 读取DHT22
     data.temperature = dht.readTemperature();
     data.humidity = dht.readHumidity();
     
+    // DHT22本身就是0.1分辨率，四舍五入回整数
+    data.temperatureX10 = (int16_t)lround(data.temperature * 10);
+    data.humidityX10 = (uint16_t)lround(data.humidity * 10);
+#endif
+    
     // 读取MQ-135
-    data.gasRaw = analogRead(MQ_PIN);
+    readGas(data.gasRaw, data.gasMin, data.gasMax);
     data.gasBaseline = gasBaseline;
     data.gasDelta = data.gasRaw - gasBaseline;
     
@@ -36,17 +102,36 @@ SensorData Sensors::readSensors() {
     return data;
 }
 
-// 校准气体传感器
-void Sensors::calibrateGasSensor() {
-    int reading = analogRead(MQ_PIN);
+// 校准气体传感器（返回本次读数）
+int Sensors::calibrateGasSensor() {
+    int reading, lo, hi;
+    readGas(reading, lo, hi);
     calibrationSum += reading;
     calibrationSamples++;
     
     // 计算平均值作为基准
     gasBaseline = calibrationSum / calibrationSamples;
+    
+    return reading;
 }
 
 // 获取气体基准值
 int Sensors::getGasBaseline() {
     return gasBaseline;
 }
+
+// 直接设定气体基准值（回放记录时使用，会清掉校准累计）
+void Sensors::setGasBaseline(int baseline) {
+    gasBaseline = baseline;
+    calibrationSum = 0;
+    calibrationSamples = 0;
+}
+
+// DHT22读取失败次数（超时 + CRC错误，DHT库模式不统计）
+uint32_t Sensors::getDHTFailures() {
+#if DHT_ASYNC
+    return DHT22Async::getFailures();
+#else
+    return 0;
+#endif
+}
@@ -12,14 +12,45 @@
 #define DHT_PIN     3       // D3 - ⚠️ 注意是D3不是D2
 #define DHT_TYPE    DHT22
 
+// DHT22读取方式：1=中断异步驱动（仅SAMD），0=DHT库（读取时关中断约5ms）
+#ifndef DHT_ASYNC
+  #if defined(ARDUINO_ARCH_SAMD)
+    #define DHT_ASYNC 1
+  #else
+    #define DHT_ASYNC 0
+  #endif
+#endif
+
+#if DHT_ASYNC
+  #include "dht22_async.h"
+  #define DHT_MAX_AGE_MS  5000  // 超过这个时间没有新读数就算无效
+#endif
+
 // MQ-135 配置
 #define MQ_PIN      A0      // 模拟输入（需分压电路）
 
+// 气体采集方式：1=TC3+EVSYS触发ADC过采样，DMA写环形缓冲（仅SAMD），0=analogRead
+#ifndef GAS_ADC_DMA
+  #if defined(ARDUINO_ARCH_SAMD)
+    #define GAS_ADC_DMA 1
+  #else
+    #define GAS_ADC_DMA 0
+  #endif
+#endif
+
+#if GAS_ADC_DMA
+  #include "gas_adc.h"
+#endif
+
 // 传感器数据结构
 struct SensorData {
     float temperature;      // 温度 (°C)
     float humidity;         // 湿度 (%)
-    int gasRaw;            // 气体原始值 (0-1023)
+    int16_t temperatureX10; // 温度 (0.1°C)，定点模型使用
+    uint16_t humidityX10;   // 湿度 (0.1%)
+    int gasRaw;            // 气体原始值 (0-1023)，过采样时为窗口均值
+    int gasMin;            // 窗口内最小值
+    int gasMax;            // 窗口内最大值
     int gasBaseline;       // 气体基准值
     int gasDelta;          // 气体变化量
     bool valid;            // 数据有效性
@@ -31,14 +62,24 @@ public:
     Sensors();
     void begin();
     SensorData readSensors();
-    void calibrateGasSensor();
+    void startReading();        // 开始一次新的温湿度转换（启动完成时调用）
+    int calibrateGasSensor();
     int getGasBaseline();
+    void setGasBaseline(int baseline);
+    uint32_t getDHTFailures();
     
 private:
     DHT dht;
+#if DHT_ASYNC
+    DHT22Reading lastReading;
+    bool haveReading;
+#endif
     int gasBaseline;
     int calibrationSamples;
     long calibrationSum;
+    bool gasOversampled;
+    
+    void readGas(int& mean, int& min, int& max);
 };
 
 #endif
@@ -0,0 +1,156 @@
+/*
+ * Session Store Implementation
+ */
+
+#include "session_store.h"
+
+#define SESSION_SEQ        0
+#define SESSION_DEVADDR    4
+#define SESSION_NWKSKEY    8
+#define SESSION_APPSKEY    24
+#define SESSION_FCNT_UP    40
+#define SESSION_FCNT_DOWN  44
+#define SESSION_CRC        (FLASH_LOG_PAGE_SIZE - 2)
+
+static uint32_t getUint32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void putUint32(uint8_t* p, uint32_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = (value >> 24) & 0xFF;
+}
+
+SessionStore::SessionStore(LogStorage& storage) : storage(storage) {
+    pages = 0;
+    nextSeq = 0;
+    valid = false;
+    memset(&current, 0, sizeof(current));
+    writes = 0;
+}
+
+bool SessionStore::begin() {
+    pages = storage.pageCount() - storage.pageCount() % FLASH_LOG_PAGES_PER_ROW;
+    valid = false;
+    nextSeq = 0;
+
+    uint8_t page[FLASH_LOG_PAGE_SIZE];
+    uint32_t bestSeq = 0;
+    for (uint16_t p = 0; p < pages; p++) {
+        storage.read(p, page);
+        uint32_t seq = getUint32(page + SESSION_SEQ);
+        if (seq == 0xFFFFFFFF || seq % pages != p) continue;
+        if (((uint16_t)page[SESSION_CRC] | ((uint16_t)page[SESSION_CRC + 1] << 8)) !=
+            flashCrc16(page, SESSION_CRC)) {
+            continue;
+        }
+        if (valid && seq < bestSeq) continue;
+
+        bestSeq = seq;
+        valid = true;
+        memcpy(current.devAddr, page + SESSION_DEVADDR, sizeof(current.devAddr));
+        memcpy(current.nwkSKey, page + SESSION_NWKSKEY, sizeof(current.nwkSKey));
+        memcpy(current.appSKey, page + SESSION_APPSKEY, sizeof(current.appSKey));
+        current.fcntUp = getUint32(page + SESSION_FCNT_UP);
+        current.fcntDown = getUint32(page + SESSION_FCNT_DOWN);
+    }
+
+    nextSeq = valid ? bestSeq + 1 : 0;
+    return valid;
+}
+
+bool SessionStore::load(LoRaSession& session) const {
+    if (!valid) return false;
+    session = current;
+    return true;
+}
+
+void SessionStore::save(const LoRaSession& session) {
+    current = session;
+    current.fcntUp = session.fcntUp + SESSION_FCNT_STEP;
+    valid = true;
+    write();
+}
+
+bool SessionStore::reserve(uint32_t fcntUp, uint32_t fcntDown) {
+    if (!valid || fcntUp + SESSION_FCNT_MARGIN < current.fcntUp) return false;
+
+    current.fcntUp = fcntUp + SESSION_FCNT_STEP;
+    current.fcntDown = fcntDown;
+    write();
+    return true;
+}
+
+// 写下一页，进入新的一行时先擦除（上一条记录在前一行的最后一页，不受影响）
+void SessionStore::write() {
+    if (pages == 0) return;
+
+    uint16_t p = nextSeq % pages;
+    if (p % FLASH_LOG_PAGES_PER_ROW == 0) storage.eraseRow(p);
+
+    uint8_t page[FLASH_LOG_PAGE_SIZE];
+    memset(page, 0xFF, sizeof(page));
+    putUint32(page + SESSION_SEQ, nextSeq);
+    memcpy(page + SESSION_DEVADDR, current.devAddr, sizeof(current.devAddr));
+    memcpy(page + SESSION_NWKSKEY, current.nwkSKey, sizeof(current.nwkSKey));
+    memcpy(page + SESSION_APPSKEY, current.appSKey, sizeof(current.appSKey));
+    putUint32(page + SESSION_FCNT_UP, current.fcntUp);
+    putUint32(page + SESSION_FCNT_DOWN, current.fcntDown);
+    uint16_t crc = flashCrc16(page, SESSION_CRC);
+    page[SESSION_CRC] = crc & 0xFF;
+    page[SESSION_CRC + 1] = crc >> 8;
+
+    storage.write(p, page);
+    nextSeq++;
+    writes++;
+}
+
+uint32_t SessionStore::getReservedUp() const {
+    return current.fcntUp;
+}
+
+uint32_t SessionStore::getWrites() const {
+    return writes;
+}
+
+void SessionStore::printStats() const {
+    Serial.print("Session: ");
+    if (!valid) {
+        Serial.println("none saved");
+        return;
+    }
+    Serial.print("FCntUp reserved up to ");
+    Serial.print(current.fcntUp);
+    Serial.print(", ");
+    Serial.print(writes);
+    Serial.println(" writes since boot");
+}
+
+static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool SessionStore::parseHex(const char* hex, uint8_t* bytes, int length) {
+    for (int i = 0; i < length; i++) {
+        int high = hexDigit(hex[i * 2]);
+        if (high < 0) return false;
+        int low = hexDigit(hex[i * 2 + 1]);
+        if (low < 0) return false;
+        bytes[i] = (high << 4) | low;
+    }
+    return hex[length * 2] == '\0';
+}
+
+void SessionStore::formatHex(const uint8_t* bytes, int length, char* hex) {
+    static const char digits[] = "0123456789ABCDEF";
+    for (int i = 0; i < length; i++) {
+        hex[i * 2] = digits[bytes[i] >> 4];
+        hex[i * 2 + 1] = digits[bytes[i] & 0x0F];
+    }
+    hex[length * 2] = '\0';
+}
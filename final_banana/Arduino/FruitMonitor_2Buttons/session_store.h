@@ -0,0 +1,72 @@
+/*
+ * Session Store - 保存LoRaWAN会话
+ *
+ * OTAA入网成功后把会话（DevAddr、两个会话密钥、帧计数）存进flash，
+ * 重新上电时用ABP方式恢复，不用再等入网（每次最多3×5秒加上入网本身）。
+ *
+ * 上行帧计数不能倒退（网络服务器会丢掉计数重复的帧），但每发一帧写
+ * 一次flash太费：保存的是一个“预留值”，比当前计数大SESSION_FCNT_STEP，
+ * 计数快用完预留时才再写一次；恢复时直接从预留值开始，中间跳过的
+ * 计数不用。
+ *
+ * 每次保存写一页（和断网日志相同的64字节页格式），按序号在几行里
+ * 循环写，启动时序号最大的有效记录就是最新的会话：
+ *   [0-3]   序号
+ *   [4-7]   DevAddr
+ *   [8-23]  NwkSKey
+ *   [24-39] AppSKey
+ *   [40-43] 上行帧计数预留值
+ *   [44-47] 下行帧计数
+ *   [62-63] CRC16（[0-61]）
+ */
+
+#ifndef SESSION_STORE_H
+#define SESSION_STORE_H
+
+#include <Arduino.h>
+#include "flash_log.h"
+
+#define SESSION_STORE_ROWS    2       // 8页，每4次保存擦一行
+#define SESSION_FCNT_STEP     64      // 每次预留的上行帧计数
+#define SESSION_FCNT_MARGIN   16      // 离预留值不到这么多时重新预留（两次检查之间最多发的帧数）
+
+struct LoRaSession {
+    uint8_t devAddr[4];
+    uint8_t nwkSKey[16];
+    uint8_t appSKey[16];
+    uint32_t fcntUp;
+    uint32_t fcntDown;
+};
+
+class SessionStore {
+public:
+    SessionStore(LogStorage& storage);
+
+    bool begin();                           // 扫描flash，返回是否有保存的会话
+    bool load(LoRaSession& session) const;  // fcntUp是预留值，恢复时从这里开始计数
+
+    // 新入网：保存会话，并从当前计数开始预留
+    void save(const LoRaSession& session);
+    // 计数快用完预留时重新预留，写了flash时返回true
+    bool reserve(uint32_t fcntUp, uint32_t fcntDown);
+
+    uint32_t getReservedUp() const;
+    uint32_t getWrites() const;
+    void printStats() const;
+
+    // MKRWAN的会话getter返回十六进制字符串
+    static bool parseHex(const char* hex, uint8_t* bytes, int length);
+    static void formatHex(const uint8_t* bytes, int length, char* hex);
+
+private:
+    LogStorage& storage;
+    uint16_t pages;
+    uint32_t nextSeq;
+    bool valid;
+    LoRaSession current;
+    uint32_t writes;
+
+    void write();
+};
+
+#endif
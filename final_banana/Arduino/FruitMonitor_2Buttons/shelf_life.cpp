@@ -0,0 +1,118 @@
+/*
+ * Shelf Life Implementation
+ */
+
+#include "shelf_life.h"
+
+// Q10^((T-20)/10) ×1000，-10°C到50°C每1°C一项，中间线性插值
+static const int16_t Q10_TABLE_MIN_C = -10;
+static const uint8_t Q10_TABLE_SIZE = 61;
+static const uint16_t q10TableMilli[Q10_TABLE_SIZE] = {
+       64,    70,    77,    84,    92,   101,   111,   122,   133,   146,
+      160,   175,   192,   211,   231,   253,   277,   304,   333,   365,
+      400,   438,   480,   527,   577,   632,   693,   760,   833,   912,
+     1000,  1096,  1201,  1316,  1443,  1581,  1733,  1899,  2081,  2281,
+     2500,  2740,  3003,  3291,  3607,  3953,  4332,  4748,  5203,  5703,
+     6250,  6850,  7507,  8227,  9017,  9882, 10830, 11870, 13009, 14257,
+    15625
+};
+
+ShelfLifeIntegrator::ShelfLifeIntegrator() {
+    for (int i = 0; i < FRUIT_COUNT; i++) {
+        lives[i].used = 0;
+        lives[i].lastUpdate = 0;
+        lives[i].started = false;
+        lives[i].haveFactors = false;
+    }
+}
+
+// 温度、湿度、气体三个因子
+ShelfLifeFactors ShelfLifeIntegrator::factors(int16_t temperatureX10, uint16_t humidityX10,
+                                              int32_t conditionScoreCenti) {
+    ShelfLifeFactors f;
+
+    // 1. 温度因子 (Q10法则)
+    int32_t offset = (int32_t)temperatureX10 - (int32_t)Q10_TABLE_MIN_C * 10;
+    if (offset < 0) offset = 0;
+    if (offset > (Q10_TABLE_SIZE - 1) * 10) offset = (Q10_TABLE_SIZE - 1) * 10;
+    int index = offset / 10;
+    int fraction = offset % 10;
+    uint32_t low = q10TableMilli[index];
+    uint32_t high = q10TableMilli[index < Q10_TABLE_SIZE - 1 ? index + 1 : index];
+    f.tempMilli = (uint16_t)(low + (high - low) * fraction / 10);
+
+    // 2. 湿度因子
+    if (humidityX10 >= 900) f.humidityCenti = 130;      // 理想高湿度
+    else if (humidityX10 >= 700) f.humidityCenti = 110; // 良好
+    else if (humidityX10 >= 500) f.humidityCenti = 100; // 可接受
+    else if (humidityX10 >= 400) f.humidityCenti = 85;  // 偏低
+    else f.humidityCenti = 70;                          // 很低
+
+    // 3. 气体质量因子：不含时间项的评分 / 60
+    int32_t gas = conditionScoreCenti / 60;
+    if (gas > 120) gas = 120;   // 上限
+    if (gas < 50) gas = 50;     // 下限
+    f.gasCenti = (uint8_t)gas;
+
+    return f;
+}
+
+void ShelfLifeIntegrator::reset(FruitType fruit, unsigned long now) {
+    FruitLife& life = lives[fruit];
+    life.used = 0;
+    life.lastUpdate = now;
+    life.started = true;
+    life.haveFactors = false;
+}
+
+// 上一次更新到now消耗的寿命：
+//   dt(ms) × 温度因子 / (预期寿命(ms) × 湿度因子 × 气体因子)
+// 换成十亿分之一：dt × temp × 125000 / (days × 1080 × hum × gas)
+void ShelfLifeIntegrator::integrate(FruitLife& life, FruitType fruit, unsigned long now) {
+    unsigned long dt = now - life.lastUpdate;
+    life.lastUpdate = now;
+    if (!life.haveFactors || dt == 0) return;
+
+    const FruitProfileFixed& profile = FruitDatabase::getProfileFixed(fruit);
+    uint64_t numerator = (uint64_t)dt * life.factors.tempMilli * 125000ULL;
+    uint64_t denominator = (uint64_t)profile.expectedLifeDays * 1080ULL *
+                           life.factors.humidityCenti * life.factors.gasCenti;
+    uint64_t used = life.used + numerator / denominator;
+
+    life.used = (used > SHELF_LIFE_MAX_USED) ? SHELF_LIFE_MAX_USED : (uint32_t)used;
+}
+
+void ShelfLifeIntegrator::update(FruitType fruit, int16_t temperatureX10, uint16_t humidityX10,
+                                 int32_t conditionScoreCenti, unsigned long now) {
+    FruitLife& life = lives[fruit];
+    if (!life.started) reset(fruit, now);
+
+    integrate(life, fruit, now);
+    life.factors = factors(temperatureX10, humidityX10, conditionScoreCenti);
+    life.haveFactors = true;
+}
+
+uint32_t ShelfLifeIntegrator::getUsed(FruitType fruit) const {
+    return lives[fruit].used;
+}
+
+// 已用寿命 × 预期寿命，给评分的时间衰减项用
+uint32_t ShelfLifeIntegrator::getEquivalentAgeSeconds(FruitType fruit) const {
+    const FruitProfileFixed& profile = FruitDatabase::getProfileFixed(fruit);
+    return (uint32_t)((uint64_t)lives[fruit].used * profile.expectedLifeDays * 86400ULL /
+                      SHELF_LIFE_FULL);
+}
+
+// 剩余寿命 × 当前条件下的寿命；用完了返回-1
+int ShelfLifeIntegrator::getRemainingDaysX10(FruitType fruit) const {
+    const FruitLife& life = lives[fruit];
+    if (life.used >= SHELF_LIFE_FULL) return -1;
+
+    const FruitProfileFixed& profile = FruitDatabase::getProfileFixed(fruit);
+    ShelfLifeFactors f = life.haveFactors ? life.factors : factors(SHELF_LIFE_REF_TEMP_X10, 600, 6000);
+
+    // (1 - used) × days × 10 × (hum/100) × (gas/100) / (temp/1000)，常数正好约掉
+    uint64_t remaining = (uint64_t)(SHELF_LIFE_FULL - life.used) * profile.expectedLifeDays *
+                         f.humidityCenti * f.gasCenti;
+    return (int)(remaining / ((uint64_t)f.tempMilli * SHELF_LIFE_FULL));
+}
@@ -0,0 +1,63 @@
+/*
+ * Shelf Life - Q10货架期积分器
+ *
+ * 每条采样把这段时间消耗掉的寿命累加起来（和网页calculateQ10ShelfLife()同一套系数）：
+ *   寿命 = 预期寿命 × 湿度因子 × 气体因子 / Q10^((T-20)/10)
+ * 一个炎热的下午消耗的寿命不会因为温度回落而“还回来”。
+ * 每种水果一份状态，每次采样都更新，切换水果不会清零；只保存累计值，不保存历史。
+ * 全部是整数运算（SAMD21没有FPU）。
+ */
+
+#ifndef SHELF_LIFE_H
+#define SHELF_LIFE_H
+
+#include <Arduino.h>
+#include "fruit_profiles.h"
+
+#define SHELF_LIFE_FULL         1000000000UL    // 寿命单位：十亿分之一
+#define SHELF_LIFE_MAX_USED     2000000000UL    // 最多记到用掉两倍寿命
+
+// Q10参数（和网页一致）
+#define SHELF_LIFE_Q10_X10      25              // Q10 = 2.5
+#define SHELF_LIFE_REF_TEMP_X10 200             // 参考温度 20°C
+
+// 当前条件下的速率因子
+struct ShelfLifeFactors {
+    uint16_t tempMilli;         // Q10温度因子 ×1000（越大消耗越快）
+    uint8_t humidityCenti;      // 湿度因子 ×100（越大寿命越长）
+    uint8_t gasCenti;           // 气体因子 ×100（越大寿命越长）
+};
+
+class ShelfLifeIntegrator {
+public:
+    ShelfLifeIntegrator();
+
+    // 放入新的水果：这种水果的累计值清零
+    void reset(FruitType fruit, unsigned long now);
+
+    // 积分到now（上一段时间按上一条采样的条件算），再记下这次的条件
+    void update(FruitType fruit, int16_t temperatureX10, uint16_t humidityX10,
+                int32_t conditionScoreCenti, unsigned long now);
+
+    uint32_t getUsed(FruitType fruit) const;                // 已用寿命（十亿分之一）
+    uint32_t getEquivalentAgeSeconds(FruitType fruit) const; // 参考条件下相当于放了多久
+    int getRemainingDaysX10(FruitType fruit) const;         // 按当前条件还能放多久（0.1天）
+
+    static ShelfLifeFactors factors(int16_t temperatureX10, uint16_t humidityX10,
+                                    int32_t conditionScoreCenti);
+
+private:
+    struct FruitLife {
+        uint32_t used;
+        unsigned long lastUpdate;
+        ShelfLifeFactors factors;
+        bool started;
+        bool haveFactors;
+    };
+
+    FruitLife lives[FRUIT_COUNT];
+
+    void integrate(FruitLife& life, FruitType fruit, unsigned long now);
+};
+
+#endif
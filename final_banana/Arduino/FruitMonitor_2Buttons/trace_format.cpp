@@ -0,0 +1,43 @@
+/*
+ * Trace Format Implementation
+ */
+
+#include "trace_format.h"
+
+// 把快照写成一行记录（不含换行），返回长度
+size_t TraceFormat::write(const Snapshot& snapshot, char* line, size_t size) {
+    const SensorData& data = snapshot.data;
+    
+    int n = snprintf(line, size, TRACE_PREFIX "%lu,%d,%d,%u,%d,%d,%d,%d",
+                     snapshot.timestamp, (int)snapshot.fruit,
+                     (int)data.temperatureX10, (unsigned)data.humidityX10,
+                     data.gasRaw, data.gasMin, data.gasMax, data.gasBaseline);
+    
+    if (n < 0) return 0;
+    return (size_t)n < size ? (size_t)n : size - 1;
+}
+
+// 解析一行记录（行首可以有串口监视器的时间戳等前缀）
+bool TraceFormat::parse(const char* line, TraceSample& sample) {
+    const char* start = strstr(line, TRACE_PREFIX);
+    if (!start) return false;
+    
+    unsigned long timestamp;
+    int fruit, temperature, humidity, gasRaw, gasMin, gasMax, gasBaseline;
+    
+    int fields = sscanf(start + strlen(TRACE_PREFIX), "%lu,%d,%d,%d,%d,%d,%d,%d",
+                        &timestamp, &fruit, &temperature, &humidity,
+                        &gasRaw, &gasMin, &gasMax, &gasBaseline);
+    if (fields != 8) return false;
+    if (fruit < FRUIT_BANANA || fruit > FRUIT_GRAPE) return false;
+    
+    sample.timestamp = timestamp;
+    sample.fruit = (FruitType)fruit;
+    sample.temperatureX10 = (int16_t)temperature;
+    sample.humidityX10 = (uint16_t)humidity;
+    sample.gasRaw = gasRaw;
+    sample.gasMin = gasMin;
+    sample.gasMax = gasMax;
+    sample.gasBaseline = gasBaseline;
+    return true;
+}
@@ -0,0 +1,36 @@
+/*
+ * Trace Format - 紧凑采样记录格式
+ *
+ * 串口输入'c'后，每个快照输出一行（代替监测数据框）：
+ *   $FM,<时间ms>,<水果>,<温度×10>,<湿度×10>,<气体>,<最小>,<最大>,<基准>
+ * 主机回放工具用parse()读回，和write()是同一份定义。
+ */
+
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+#define TRACE_PREFIX      "$FM,"
+#define TRACE_LINE_SIZE   64
+
+// 一条采样记录
+struct TraceSample {
+    unsigned long timestamp;    // 采样时刻 (ms)
+    FruitType fruit;
+    int16_t temperatureX10;
+    uint16_t humidityX10;
+    int gasRaw;
+    int gasMin;
+    int gasMax;
+    int gasBaseline;
+};
+
+class TraceFormat {
+public:
+    static size_t write(const Snapshot& snapshot, char* line, size_t size);
+    static bool parse(const char* line, TraceSample& sample);
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * Trend Estimator Implementation
+ */
+
+#include "trend_estimator.h"
+#include <math.h>
+
+TrendEstimator::TrendEstimator() {
+    reset();
+}
+
+void TrendEstimator::reset() {
+    score = 0;
+    rate = 0;
+    p00 = 0;
+    p01 = 0;
+    p11 = 0;
+    lastTime = 0;
+    samples = 0;
+}
+
+// 预测 + 测量更新
+void TrendEstimator::update(unsigned long time, float measured) {
+    if (samples == 0) {
+        // 第一条：评分直接取测量值，变化率未知（±5分/小时）
+        score = measured;
+        rate = 0;
+        p00 = TREND_MEASURE_VAR;
+        p01 = 0;
+        p11 = 25.0f;
+        lastTime = time;
+        samples = 1;
+        return;
+    }
+
+    float dt = (time - lastTime) / 3600000.0f;
+    lastTime = time;
+
+    // 1. 预测：score += rate × dt，协方差 F P Fᵀ + Q
+    score += rate * dt;
+    float q00 = TREND_RATE_NOISE * dt * dt * dt / 3.0f + TREND_SCORE_NOISE * dt;
+    float q01 = TREND_RATE_NOISE * dt * dt / 2.0f;
+    float q11 = TREND_RATE_NOISE * dt;
+    p00 += 2.0f * dt * p01 + dt * dt * p11 + q00;
+    p01 += dt * p11 + q01;
+    p11 += q11;
+
+    // 2. 测量更新（只观测评分）
+    float innovation = measured - score;
+    float s = p00 + TREND_MEASURE_VAR;
+    float k0 = p00 / s;
+    float k1 = p01 / s;
+
+    score += k0 * innovation;
+    rate += k1 * innovation;
+
+    float n00 = (1.0f - k0) * p00;
+    float n01 = (1.0f - k0) * p01;
+    float n11 = p11 - k1 * p01;
+    p00 = n00;
+    p01 = n01;
+    p11 = n11;
+
+    samples++;
+}
+
+static uint16_t clampHours(float hours) {
+    if (hours < 0) return 0;
+    if (hours >= TREND_NO_PROJECTION - 1) return TREND_NO_PROJECTION - 1;
+    return (uint16_t)(hours + 0.5f);
+}
+
+// t = (spoilScore - score) / rate，方差按一阶展开：
+//   var(t) = (P00 + 2t·P01 + t²·P11) / rate²
+SpoilProjection TrendEstimator::project(float spoilScore) const {
+    SpoilProjection projection;
+    projection.hours = TREND_NO_PROJECTION;
+    projection.lowHours = TREND_NO_PROJECTION;
+    projection.highHours = TREND_NO_PROJECTION;
+
+    if (samples < TREND_MIN_SAMPLES) return projection;
+
+    if (score <= spoilScore) {
+        projection.hours = 0;
+        projection.lowHours = 0;
+        projection.highHours = 0;
+        return projection;
+    }
+    if (rate >= 0) return projection;
+
+    float t = (spoilScore - score) / rate;
+    float variance = (p00 + 2.0f * t * p01 + t * t * p11) / (rate * rate);
+    float sigma = sqrtf(variance > 0 ? variance : 0);
+
+    projection.hours = clampHours(t);
+    projection.lowHours = clampHours(t - 2.0f * sigma);
+    projection.highHours = clampHours(t + 2.0f * sigma);
+    return projection;
+}
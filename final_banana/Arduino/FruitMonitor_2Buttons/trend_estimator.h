@@ -0,0 +1,50 @@
+/*
+ * Trend Estimator - 评分趋势估计
+ *
+ * 两状态卡尔曼滤波（评分、每小时变化率），每条采样常数时间更新。
+ * 按当前下降速度外推评分跌到SPOILED（<40分）还要多久，
+ * 并由协方差给出约95%（±2σ）的区间。
+ */
+
+#ifndef TREND_ESTIMATOR_H
+#define TREND_ESTIMATOR_H
+
+#include <Arduino.h>
+
+#define TREND_SPOIL_SCORE       40.0f   // 和STAGE_SPOILED的分界一致
+#define TREND_MIN_SAMPLES       150     // 约5分钟后才给出预测
+#define TREND_NO_PROJECTION     0xFFFF
+
+// 滤波参数
+#define TREND_MEASURE_VAR       1.0f    // 评分测量噪声 (分²)
+#define TREND_SCORE_NOISE       0.1f    // 评分过程噪声 (分²/小时)
+#define TREND_RATE_NOISE        0.01f   // 变化率随机游走 ((分/小时)²/小时)
+
+// 预计多久变坏（小时）
+struct SpoilProjection {
+    uint16_t hours;             // TREND_NO_PROJECTION：评分没有在下降或数据不够
+    uint16_t lowHours;
+    uint16_t highHours;
+};
+
+class TrendEstimator {
+public:
+    TrendEstimator();
+
+    void reset();
+    void update(unsigned long time, float score);
+    SpoilProjection project(float spoilScore = TREND_SPOIL_SCORE) const;
+
+    bool isStarted() const { return samples > 0; }
+    unsigned long getLastTime() const { return lastTime; }
+    float getRate() const { return rate; }
+
+private:
+    float score;                // 估计的评分
+    float rate;                 // 估计的变化率 (分/小时)
+    float p00, p01, p11;        // 协方差（对称）
+    unsigned long lastTime;
+    uint32_t samples;
+};
+
+#endif
@@ -4,10 +4,42 @@
  */
 
 #include "ui_manager.h"
+#include "glyph_atlas.h"
+#include "heap_guard.h"
 
 UIManager::UIManager() {
     bus = NULL;
     gfx = NULL;
+    frameStart = 0;
+    headerFruit = FRUIT_BANANA;
+    warningShown = false;
+    pixelsPushed = 0;
+    invalidateFields();
+}
+
+// 数值格式化为一位小数（与Print::print(float, 1)一致）
+static void formatOneDecimal(char* buf, size_t size, float value) {
+    bool negative = value < 0;
+    if (negative) value = -value;
+    unsigned long tenths = (unsigned long)(value * 10.0f + 0.5f);
+    snprintf(buf, size, "%s%lu.%lu", negative ? "-" : "", tenths / 10, tenths % 10);
+}
+
+// 预计变坏时间的区间：100小时以内按小时，否则按天（"25-37" + "h"）
+static const char* formatSpoilRange(char* buf, size_t size, const SpoilProjection& spoil) {
+    unsigned int lowDays = spoil.lowHours / 24;
+    unsigned int highDays = (spoil.highHours + 23) / 24;
+    
+    if (spoil.highHours < 100) {
+        snprintf(buf, size, "%u-%u", spoil.lowHours, spoil.highHours);
+        return "h";
+    }
+    if (highDays > 99) {
+        snprintf(buf, size, "%u+", lowDays > 99 ? 99 : lowDays);
+        return "d";
+    }
+    snprintf(buf, size, "%u-%u", lowDays, highDays);
+    return "d";
 }
 
 // ==================== TFT初始化 ====================
@@ -25,17 +57,30 @@ void UIManager::begin() {
     digitalWrite(TFT_RST, HIGH);
     delay(150);
     
-    // 创建SPI总线
-    bus = new Arduino_SWSPI(TFT_DC, TFT_CS, TFT_SCK, TFT_MOSI, TFT_MISO);
+    // 总线和驱动放在静态存储里（不占堆），begin()只在setup()里调用一次
+    #if TFT_BUS == TFT_BUS_DMA
+      static DMASPIBus busInstance(TFT_DC, TFT_CS);
+      Serial.println("   Bus: HW SPI + DMA (SERCOM1)");
+    #elif TFT_BUS == TFT_BUS_HWSPI
+      static Arduino_HWSPI busInstance(TFT_DC, TFT_CS);
+      Serial.println("   Bus: HW SPI (SERCOM1)");
+    #else
+      static Arduino_SWSPI busInstance(TFT_DC, TFT_CS, TFT_SCK, TFT_MOSI, TFT_MISO);
+      Serial.println("   Bus: SW SPI");
+    #endif
+    bus = &busInstance;
     
-    // 创建驱动
-    #if TFT_DRIVER == 1
-      gfx = new Arduino_ILI9488_18bit(bus, TFT_RST, 0, false);
+    // 驱动
+    #if TFT_DRIVER == 1 && TFT_COLOR_DEPTH == 16
+      static Arduino_ILI9488 gfxInstance(bus, TFT_RST, 0, false);
+    #elif TFT_DRIVER == 1
+      static Arduino_ILI9488_18bit gfxInstance(bus, TFT_RST, 0, false);
     #elif TFT_DRIVER == 2
-      gfx = new Arduino_ILI9341(bus, TFT_RST, 0, false);
+      static Arduino_ILI9341 gfxInstance(bus, TFT_RST, 0, false);
     #elif TFT_DRIVER == 3
-      gfx = new Arduino_ST7796(bus, TFT_RST, 0, false);
+      static Arduino_ST7796 gfxInstance(bus, TFT_RST, 0, false);
     #endif
+    gfx = &gfxInstance;
     
     if (!gfx->begin()) {
         Serial.println("   ✗ TFT init failed!");
@@ -68,6 +113,9 @@ void UIManager::testDisplay() {
     gfx->fillScreen(0xFFFF); delay(1000);
     Serial.println("   WHITE");
     
+    benchmarkFill();
+    benchmarkText();
+    
     gfx->fillScreen(0x0000);
     gfx->setTextSize(3);
     gfx->setTextColor(0xFFFF);
@@ -77,8 +125,79 @@ void UIManager::testDisplay() {
     Serial.println("\n✅ TFT works! Change TFT_TEST_MODE to false\n");
 }
 
+// ==================== 文字绘制基准 ====================
+// 同一字符串分别用GFX逐像素绘制和字形表绘制，比较耗时
+void UIManager::benchmarkText() {
+    static const char* samples[] = { "VERY FRESH", "28.8", " C", "+12", "7 days", "100/100" };
+    const int sampleCount = sizeof(samples) / sizeof(samples[0]);
+    
+    Serial.println("\n⏱ Text render benchmark (size 2, us)");
+    Serial.println("   string       gfx   atlas");
+    
+    gfx->fillScreen(COLOR_BG_CARD);
+    
+    for (int i = 0; i < sampleCount; i++) {
+        int y = 20 + i * 40;
+        
+        waitDisplayIdle();
+        unsigned long start = micros();
+        gfx->setTextSize(2);
+        gfx->setTextColor(COLOR_PRIMARY);
+        gfx->setCursor(20, y);
+        gfx->print(samples[i]);
+        waitDisplayIdle();
+        unsigned long gfxTime = micros() - start;
+        
+        start = micros();
+        drawAtlasText(240, y, samples[i], COLOR_PRIMARY, COLOR_BG_CARD, 2);
+        waitDisplayIdle();
+        unsigned long atlasTime = micros() - start;
+        
+        char line[48];
+        snprintf(line, sizeof(line), "   %-10s %6lu %6lu", samples[i], gfxTime, atlasTime);
+        Serial.println(line);
+    }
+}
+
+// ==================== 整屏填充基准 ====================
+// 对比18位/16位模式：修改TFT_COLOR_DEPTH后重新烧录再跑一次
+void UIManager::benchmarkFill() {
+    const int rounds = 5;
+    
+    Serial.println("\n⏱ fillScreen(COLOR_BG_DARK) benchmark");
+    Serial.print("   Mode: ");
+    #if TFT_DRIVER == 1 && TFT_COLOR_DEPTH == 18
+      Serial.println("RGB666 (3 bytes/pixel)");
+      const uint32_t bytesPerPixel = 3;
+    #else
+      Serial.println("RGB565 (2 bytes/pixel)");
+      const uint32_t bytesPerPixel = 2;
+    #endif
+    
+    waitDisplayIdle();
+    unsigned long start = micros();
+    for (int i = 0; i < rounds; i++) {
+        gfx->fillScreen(COLOR_BG_DARK);
+    }
+    waitDisplayIdle();
+    unsigned long elapsed = micros() - start;
+    
+    uint32_t bytesPerFill = (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT * bytesPerPixel;
+    
+    Serial.print("   Per fill: ");
+    Serial.print(elapsed / rounds / 1000.0, 1);
+    Serial.println(" ms");
+    Serial.print("   Data:     ");
+    Serial.print(bytesPerFill);
+    Serial.println(" bytes/fill");
+    Serial.print("   Rate:     ");
+    Serial.print((float)bytesPerFill * rounds / elapsed, 2);
+    Serial.println(" MB/s");
+}
+
 // ==================== 启动画面 ====================
 void UIManager::showBootScreen() {
+    beginFrame();
     gfx->fillScreen(COLOR_BG_DARK);
     
     // 顶部装饰条
@@ -88,28 +207,30 @@ void UIManager::showBootScreen() {
     // 标题
     gfx->setTextSize(4);
     gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    drawCenteredText("Fruit Monitor", 20, COLOR_TEXT_PRIMARY, 4);
+    drawCenteredText("Fruit Monitor", 20, COLOR_TEXT_PRIMARY, 4, COLOR_PRIMARY);
     
     // 副标题
     gfx->setTextSize(2);
     gfx->setTextColor(COLOR_BG_DARK);
-    drawCenteredText("Env + Fruit Test Mode", 90, COLOR_TEXT_SECONDARY, 1);
+    drawCenteredText("Env + Fruit Test Mode", 90, COLOR_TEXT_SECONDARY, 1, COLOR_BG_DARK);
     
     // 接线信息
     gfx->setTextSize(1);
     gfx->setTextColor(COLOR_TEXT_DIM);
-    drawCenteredText("CS=7 DC=6 RST=4", 150, COLOR_TEXT_DIM, 1);
+    drawCenteredText("CS=7 DC=6 RST=4", 150, COLOR_TEXT_DIM, 1, COLOR_BG_DARK);
     
     // 初始化状态
     gfx->setTextSize(2);
     gfx->setTextColor(COLOR_ACCENT);
-    drawCenteredText("Initializing...", 200, COLOR_ACCENT, 2);
+    drawCenteredText("Initializing...", 200, COLOR_ACCENT, 2, COLOR_BG_DARK);
     
     // 底部装饰点
     for (int i = 0; i < 5; i++) {
         int x = (SCREEN_WIDTH / 2) - 40 + (i * 20);
         gfx->fillCircle(x, 260, 4, COLOR_PRIMARY);
     }
+    
+    endFrame("Boot screen");
 }
 
 // ==================== 校准画面 ====================
@@ -127,7 +248,7 @@ void UIManager::showCalibrationScreen() {
     // 标题
     gfx->setTextSize(3);
     gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    drawCenteredText("Calibrating", 140, COLOR_TEXT_PRIMARY, 3);
+    drawCenteredText("Calibrating", 140, COLOR_TEXT_PRIMARY, 3, COLOR_BG_CARD);
     
     // 副标题
     gfx->setTextSize(2);
@@ -137,7 +258,7 @@ void UIManager::showCalibrationScreen() {
     // 提示
     gfx->setTextSize(1);
     gfx->setTextColor(COLOR_TEXT_DIM);
-    drawCenteredText("Wait 10 seconds...", 220, COLOR_TEXT_DIM, 1);
+    drawCenteredText("Wait 10 seconds...", 220, COLOR_TEXT_DIM, 1, COLOR_BG_DARK);
 }
 
 // ==================== 校准进度 ====================
@@ -183,17 +304,17 @@ void UIManager::showLoRaJoiningScreen() {
     // 标题
     gfx->setTextSize(3);
     gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    drawCenteredText("Joining", 150, COLOR_TEXT_PRIMARY, 3);
+    drawCenteredText("Joining", 150, COLOR_TEXT_PRIMARY, 3, COLOR_BG_CARD);
     
     // 副标题
     gfx->setTextSize(2);
     gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    drawCenteredText("LoRaWAN Network", 185, COLOR_TEXT_SECONDARY, 2);
+    drawCenteredText("LoRaWAN Network", 185, COLOR_TEXT_SECONDARY, 2, COLOR_BG_CARD);
     
     // 提示
     gfx->setTextSize(1);
     gfx->setTextColor(COLOR_ACCENT);
-    drawCenteredText("Please wait...", 220, COLOR_ACCENT, 1);
+    drawCenteredText("Please wait...", 220, COLOR_ACCENT, 1, COLOR_BG_CARD);
 }
 
 // ==================== 错误画面 ====================
@@ -205,40 +326,27 @@ void UIManager::showErrorScreen(const char* message) {
     drawCenteredText("!", 80, COLOR_TEXT_PRIMARY, 6);
     
     gfx->setTextSize(4);
-    drawCenteredText("ERROR", 160, COLOR_TEXT_PRIMARY, 4);
+    drawCenteredText("ERROR", 160, COLOR_TEXT_PRIMARY, 4, COLOR_DANGER);
     
     gfx->setTextSize(2);
     gfx->setTextColor(COLOR_BG_DARK);
-    drawCenteredText(message, 220, COLOR_BG_DARK, 2);
+    drawCenteredText(message, 220, COLOR_BG_DARK, 2, COLOR_DANGER);
 }
 
 // ==================== 环境监测界面（模式A）====================
 void UIManager::showMonitoringScreen(FruitType fruit) {
     Serial.println("   Drawing monitoring screen...");
+    beginFrame();
     
     // 深色背景
     gfx->fillScreen(COLOR_BG_DARK);
     
-    String fruitName = FruitDatabase::getTypeName(fruit);
-    String fruitEmoji = FruitDatabase::getEmoji(fruit);
+    // 整屏重绘后所有字段都需要重画
+    invalidateFields();
+    warningShown = false;
     
     // ===== 顶部栏卡片 =====
-    drawCard(5, 5, SCREEN_WIDTH-10, 45, COLOR_BG_CARD);
-    
-    // 水果信息（左侧）
-    gfx->setTextSize(2);
-    gfx->setTextColor(COLOR_PRIMARY);
-    gfx->setCursor(15, 15);
-    gfx->print(fruitEmoji);
-    gfx->print(" ");
-    gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    gfx->print(fruitName);
-    
-    // Env Monitor标识（右侧）
-    gfx->setTextSize(1);
-    gfx->setTextColor(COLOR_ACCENT);
-    gfx->setCursor(SCREEN_WIDTH - 85, 20);
-    gfx->print("Env Monitor");
+    drawHeader(fruit);
     
     // ===== 主数据区域卡片 =====
     drawCard(10, 60, SCREEN_WIDTH-20, 180, COLOR_BG_CARD);
@@ -255,7 +363,9 @@ void UIManager::showMonitoringScreen(FruitType fruit) {
     gfx->setCursor(labelX, 195); gfx->print("Shelf:");
     gfx->setCursor(labelX, 225); gfx->print("Score:");
     
-    // Storage标签（右下）
+    // Spoil / Storage标签（右下）
+    gfx->setCursor(320, 195);
+    gfx->print("Spoil:");
     gfx->setCursor(320, 225);
     gfx->print("Stor:");
     
@@ -277,94 +387,105 @@ void UIManager::showMonitoringScreen(FruitType fruit) {
     gfx->drawFastHLine(10, 55, SCREEN_WIDTH-20, COLOR_BORDER);
     gfx->drawFastHLine(10, 245, SCREEN_WIDTH-20, COLOR_BORDER);
     
+    endFrame("Monitoring screen");
     Serial.println("   ✓ Framework drawn");
 }
 
+// ==================== 顶部栏（监测界面）====================
+void UIManager::drawHeader(FruitType fruit) {
+    headerFruit = fruit;
+    
+    const char* fruitName = FruitDatabase::getTypeName(fruit);
+    const char* fruitEmoji = FruitDatabase::getEmoji(fruit);
+    
+    drawCard(5, 5, SCREEN_WIDTH-10, 45, COLOR_BG_CARD);
+    
+    // 水果信息（左侧）
+    gfx->setTextSize(2);
+    gfx->setTextColor(COLOR_PRIMARY);
+    gfx->setCursor(15, 15);
+    gfx->print(fruitEmoji);
+    gfx->print(" ");
+    gfx->setTextColor(COLOR_TEXT_PRIMARY);
+    gfx->print(fruitName);
+    
+    // Env Monitor标识（右侧）
+    gfx->setTextSize(1);
+    gfx->setTextColor(COLOR_ACCENT);
+    gfx->setCursor(SCREEN_WIDTH - 85, 20);
+    gfx->print("Env Monitor");
+}
+
 // ==================== 环境数据更新（模式A）====================
 void UIManager::updateMonitoringData(FruitType fruit, const SensorData* data,
                                      float score, int remainDays,
-                                     FreshnessStage stage, int storageQuality) {
+                                     FreshnessStage stage, int storageQuality,
+                                     const SpoilProjection& spoil) {
     if (data == NULL || !data->valid) {
         return;
     }
     
+    beginFrame();
+    
     const char* stageName = getStageName(stage);
     uint16_t stageColor = getStageColor(stage);
     int valueX = 90;  // 数值开始X坐标
+    char value[12];
+    
+    pixelsPushed = 0;
     
     // ===== Stage =====
-    gfx->fillRect(valueX, 72, 220, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(stageColor);
-    gfx->setCursor(valueX, 72);
-    gfx->print(stageName);
+    drawField(FIELD_STAGE, valueX, 72, 220, stageName, stageColor, "");
     
     // ===== Temp =====
-    gfx->fillRect(valueX, 102, 150, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(COLOR_PRIMARY);
-    gfx->setCursor(valueX, 102);
-    gfx->print(data->temperature, 1);
-    gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    gfx->print(" C");
+    formatOneDecimal(value, sizeof(value), data->temperature);
+    drawField(FIELD_TEMP, valueX, 102, 150, value, COLOR_PRIMARY, " C");
     
     // ===== Hum =====
-    gfx->fillRect(valueX, 132, 150, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(COLOR_PRIMARY);
-    gfx->setCursor(valueX, 132);
-    gfx->print(data->humidity, 1);
-    gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    gfx->print(" %");
+    formatOneDecimal(value, sizeof(value), data->humidity);
+    drawField(FIELD_HUM, valueX, 132, 150, value, COLOR_PRIMARY, " %");
     
     // ===== Gas Delta（带颜色） =====
-    uint16_t gasColor = getGasColor(data->gasDelta);
-    gfx->fillRect(valueX, 162, 150, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(gasColor);
-    gfx->setCursor(valueX, 162);
-    if (data->gasDelta > 0) gfx->print("+");
-    gfx->print(data->gasDelta);
+    snprintf(value, sizeof(value), "%s%d", data->gasDelta > 0 ? "+" : "", data->gasDelta);
+    drawField(FIELD_GAS, valueX, 162, 150, value, getGasColor(data->gasDelta), "");
     
     // ===== Shelf Life =====
-    gfx->fillRect(valueX, 192, 150, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(stageColor);
-    gfx->setCursor(valueX, 192);
     if (remainDays >= 0) {
-        gfx->print(remainDays);
-        gfx->setTextColor(COLOR_TEXT_SECONDARY);
-        gfx->print(" days");
+        snprintf(value, sizeof(value), "%d", remainDays);
+        drawField(FIELD_SHELF, valueX, 192, 150, value, stageColor, " days");
     } else {
-        gfx->print("Expired");
+        drawField(FIELD_SHELF, valueX, 192, 150, "Expired", stageColor, "");
     }
     
     // ===== Score =====
-    gfx->fillRect(valueX, 222, 150, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(stageColor);
-    gfx->setCursor(valueX, 222);
-    gfx->print((int)score);
-    gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    gfx->print("/100");
+    snprintf(value, sizeof(value), "%d", (int)score);
+    drawField(FIELD_SCORE, valueX, 222, 150, value, stageColor, "/100");
+    
+    // ===== Spoil（趋势外推的区间）=====
+    if (spoil.hours == TREND_NO_PROJECTION) {
+        drawField(FIELD_SPOIL, 365, 192, 100, "--", COLOR_TEXT_SECONDARY, "");
+    } else if (spoil.highHours == 0) {
+        drawField(FIELD_SPOIL, 365, 192, 100, "now", COLOR_DANGER, "");
+    } else {
+        const char* unit = formatSpoilRange(value, sizeof(value), spoil);
+        drawField(FIELD_SPOIL, 365, 192, 100, value, stageColor, unit);
+    }
     
     // ===== Storage（右下角）=====
-    uint16_t storColor = getStorageColor(storageQuality);
-    gfx->fillRect(365, 222, 100, 20, COLOR_BG_CARD);
-    gfx->setTextSize(2);
-    gfx->setTextColor(storColor);
-    gfx->setCursor(365, 222);
-    gfx->print(storageQuality);
-    gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    gfx->print("%");
+    snprintf(value, sizeof(value), "%d", storageQuality);
+    drawField(FIELD_STORAGE, 365, 222, 100, value, getStorageColor(storageQuality), "%");
+    
+    endFrame("Monitoring update");
 }
 
 // ==================== 水果测试界面（模式B）====================
 void UIManager::showFruitTestResult(FruitType fruit, bool isSpoiled) {
     Serial.println("   Showing fruit test result...");
     
-    String fruitName = FruitDatabase::getTypeName(fruit);
-    String fruitEmoji = FruitDatabase::getEmoji(fruit);
+    const char* fruitName = FruitDatabase::getTypeName(fruit);
+    const char* fruitEmoji = FruitDatabase::getEmoji(fruit);
+    
+    beginFrame();
     
     // 整屏背景颜色
     uint16_t bgColor = isSpoiled ? COLOR_DANGER : COLOR_VERY_FRESH;
@@ -397,9 +518,9 @@ void UIManager::showFruitTestResult(FruitType fruit, bool isSpoiled) {
     gfx->setTextColor(bgColor);
     
     if (isSpoiled) {
-        drawCenteredText("DO NOT EAT", 215, bgColor, 4);
+        drawCenteredText("DO NOT EAT", 215, bgColor, 4, COLOR_BG_DARK);
     } else {
-        drawCenteredText("OK TO EAT", 215, bgColor, 4);
+        drawCenteredText("OK TO EAT", 215, bgColor, 4, COLOR_BG_DARK);
     }
     
     // ===== 底部按钮提示 =====
@@ -414,6 +535,7 @@ void UIManager::showFruitTestResult(FruitType fruit, bool isSpoiled) {
     gfx->setCursor(260, 290);
     gfx->print(" Green: Test Again");
     
+    endFrame("Test result screen");
     Serial.println("   ✓ Test result shown");
 }
 
@@ -432,20 +554,20 @@ void UIManager::showReturnPrompt() {
     // 标题
     gfx->setTextSize(3);
     gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    drawCenteredText("Returning to", 150, COLOR_TEXT_PRIMARY, 3);
-    drawCenteredText("Environment Mode", 180, COLOR_TEXT_PRIMARY, 3);
+    drawCenteredText("Returning to", 150, COLOR_TEXT_PRIMARY, 3, COLOR_BG_CARD);
+    drawCenteredText("Environment Mode", 180, COLOR_TEXT_PRIMARY, 3, COLOR_BG_CARD);
     
     // 提示信息
     gfx->setTextSize(1);
     gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    drawCenteredText("For best results:", 220, COLOR_TEXT_SECONDARY, 1);
+    drawCenteredText("For best results:", 220, COLOR_TEXT_SECONDARY, 1, COLOR_BG_CARD);
     drawCenteredText("Wait 1-2 mins before next test", 240, COLOR_TEXT_SECONDARY, 1);
 }
 
 // ==================== 切换动画 ====================
 void UIManager::showFruitSwitchAnimation(FruitType newFruit) {
-    String fruitEmoji = FruitDatabase::getEmoji(newFruit);
-    String fruitName = FruitDatabase::getTypeName(newFruit);
+    const char* fruitEmoji = FruitDatabase::getEmoji(newFruit);
+    const char* fruitName = FruitDatabase::getTypeName(newFruit);
     
     gfx->fillScreen(COLOR_BG_DARK);
     
@@ -456,17 +578,17 @@ void UIManager::showFruitSwitchAnimation(FruitType newFruit) {
     // emoji
     gfx->setTextSize(6);
     gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    drawCenteredText(fruitEmoji.c_str(), 100, COLOR_TEXT_PRIMARY, 6);
+    drawCenteredText(fruitEmoji, 100, COLOR_TEXT_PRIMARY, 6);
     
     // 名称
     gfx->setTextSize(4);
     gfx->setTextColor(COLOR_ACCENT);
-    drawCenteredText(fruitName.c_str(), 180, COLOR_ACCENT, 4);
+    drawCenteredText(fruitName, 180, COLOR_ACCENT, 4, COLOR_BG_DARK);
     
     // 提示
     gfx->setTextSize(1);
     gfx->setTextColor(COLOR_TEXT_SECONDARY);
-    drawCenteredText("Switching...", 240, COLOR_TEXT_SECONDARY, 1);
+    drawCenteredText("Switching...", 240, COLOR_TEXT_SECONDARY, 1, COLOR_BG_DARK);
     
     // 装饰点
     for (int i = 0; i < 5; i++) {
@@ -477,6 +599,10 @@ void UIManager::showFruitSwitchAnimation(FruitType newFruit) {
 
 // ==================== 变坏警告（顶部红条）====================
 void UIManager::showSpoilageWarning() {
+    // 已经显示过就不再重复推送
+    if (warningShown) return;
+    warningShown = true;
+    
     // 顶部红色警告条
     gfx->fillRect(0, 0, SCREEN_WIDTH, 30, COLOR_DANGER);
     
@@ -489,11 +615,24 @@ void UIManager::showSpoilageWarning() {
     // 警告文字
     gfx->setTextSize(2);
     gfx->setTextColor(COLOR_TEXT_PRIMARY);
-    drawCenteredText("! FRUIT SPOILED !", 8, COLOR_TEXT_PRIMARY, 2);
+    drawCenteredText("! FRUIT SPOILED !", 8, COLOR_TEXT_PRIMARY, 2, COLOR_DANGER);
     
     // 右侧图标
     gfx->setCursor(SCREEN_WIDTH - 35, 8);
     gfx->print("!");
+    
+    pixelsPushed += (uint32_t)SCREEN_WIDTH * 30;
+}
+
+// ==================== 清除警告条（恢复顶部栏）====================
+void UIManager::clearSpoilageWarning() {
+    if (!warningShown) return;
+    warningShown = false;
+    
+    gfx->fillRect(0, 0, SCREEN_WIDTH, 30, COLOR_BG_DARK);
+    drawHeader(headerFruit);
+    
+    pixelsPushed += (uint32_t)SCREEN_WIDTH * 52;
 }
 
 // ==================== 上传状态 ====================
@@ -519,6 +658,90 @@ void UIManager::showUploadStatus(bool success) {
     gfx->print(message);
 }
 
+// ==================== 保留状态 ====================
+void UIManager::invalidateFields() {
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        fieldCache[i].text[0] = '\0';
+        fieldCache[i].valid = false;
+    }
+}
+
+// 绘制一个数值字段：只有文字或颜色变化时才推送到屏幕
+void UIManager::drawField(MonitorField field, int x, int y, int w,
+                          const char* value, uint16_t color, const char* unit) {
+    FieldCache& cache = fieldCache[field];
+    
+    char text[sizeof(cache.text)];
+    snprintf(text, sizeof(text), "%s%s", value, unit);
+    
+    if (cache.valid && cache.color == color && strcmp(cache.text, text) == 0) {
+        return;
+    }
+    
+    // 字形不透明，直接覆盖旧内容，只需擦除文字右侧的剩余部分
+    int valueWidth = strlen(value) * 12;
+    int textWidth = strlen(text) * 12;
+    drawText(x, y, value, color, COLOR_BG_CARD, 2);
+    if (unit[0] != '\0') {
+        drawText(x + valueWidth, y, unit, COLOR_TEXT_SECONDARY, COLOR_BG_CARD, 2);
+    }
+    if (textWidth < w) {
+        gfx->fillRect(x + textWidth, y, w - textWidth, 20, COLOR_BG_CARD);
+    }
+    
+    pixelsPushed += (uint32_t)textWidth * 16;
+    if (textWidth < w) {
+        pixelsPushed += (uint32_t)(w - textWidth) * 20;
+    }
+    
+    strcpy(cache.text, text);
+    cache.color = color;
+    cache.valid = true;
+}
+
+uint32_t UIManager::getLastUpdatePixels() {
+    return pixelsPushed;
+}
+
+// ==================== 显示总线状态 ====================
+bool UIManager::isDisplayBusy() {
+    #if TFT_BUS == TFT_BUS_DMA
+      return ((DMASPIBus*)bus)->transferInFlight();
+    #else
+      return false;
+    #endif
+}
+
+void UIManager::waitDisplayIdle() {
+    #if TFT_BUS == TFT_BUS_DMA
+      ((DMASPIBus*)bus)->waitTransfer();
+    #endif
+}
+
+// ==================== 帧耗时统计 ====================
+void UIManager::beginFrame() {
+    #if UI_FRAME_TIMING
+      frameStart = micros();
+    #endif
+}
+
+// 打印CPU绘制耗时，以及总线真正空闲的时刻
+void UIManager::endFrame(const char* name) {
+    #if UI_FRAME_TIMING
+      unsigned long cpuTime = micros() - frameStart;
+      waitDisplayIdle();
+      unsigned long totalTime = micros() - frameStart;
+      
+      Serial.print("   ⏱ ");
+      Serial.print(name);
+      Serial.print(": ");
+      Serial.print(cpuTime / 1000.0, 1);
+      Serial.print(" ms CPU, ");
+      Serial.print(totalTime / 1000.0, 1);
+      Serial.println(" ms total");
+    #endif
+}
+
 // ==================== 辅助函数 ====================
 
 // 绘制卡片
@@ -542,15 +765,62 @@ void UIManager::drawProgressBar(int x, int y, int w, int h, int percent, uint16_
     }
 }
 
-// 绘制居中文字
-void UIManager::drawCenteredText(const char* text, int y, uint16_t color, int textSize) {
+// 绘制居中文字（给出背景色时走字形表）
+void UIManager::drawCenteredText(const char* text, int y, uint16_t color, int textSize,
+                                 int32_t bgColor) {
+    int textWidth = strlen(text) * 6 * textSize;
+    int x = (SCREEN_WIDTH - textWidth) / 2;
+    
+    if (bgColor != TEXT_NO_BG && drawAtlasText(x, y, text, color, bgColor, textSize)) {
+        return;
+    }
+    
     gfx->setTextSize(textSize);
     gfx->setTextColor(color);
-    int textWidth = strlen(text) * 6 * textSize;
-    gfx->setCursor((SCREEN_WIDTH - textWidth) / 2, y);
+    gfx->setCursor(x, y);
+    gfx->print(text);
+}
+
+// 绘制不透明文字：优先字形表，缺字时退回GFX逐像素绘制
+void UIManager::drawText(int x, int y, const char* text, uint16_t color, uint16_t bgColor, int textSize) {
+    if (drawAtlasText(x, y, text, color, bgColor, textSize)) {
+        return;
+    }
+    
+    gfx->setTextSize(textSize);
+    gfx->setTextColor(color, bgColor);
+    gfx->setCursor(x, y);
     gfx->print(text);
 }
 
+// 用预渲染字形绘制：每个字形一次地址窗口写入
+bool UIManager::drawAtlasText(int x, int y, const char* text, uint16_t color, uint16_t bgColor, int textSize) {
+    const GlyphSet* set = NULL;
+    for (int i = 0; i < GLYPH_SET_COUNT; i++) {
+        if (GLYPH_SETS[i].size == textSize) {
+            set = &GLYPH_SETS[i];
+            break;
+        }
+    }
+    if (set == NULL) return false;
+    
+    // 先确认所有字符都在字形表里
+    for (const char* p = text; *p; p++) {
+        uint8_t c = (uint8_t)*p;
+        if (c < 0x20 || c > 0x7E) return false;
+        if (pgm_read_byte(&set->index[c - 0x20]) == GLYPH_NONE) return false;
+    }
+    
+    for (const char* p = text; *p; p++) {
+        uint8_t glyph = pgm_read_byte(&set->index[(uint8_t)*p - 0x20]);
+        const uint8_t* bitmap = set->bitmaps + (uint16_t)glyph * set->bytesPerGlyph;
+        gfx->drawBitmap(x, y, bitmap, set->width, set->height, color, bgColor);
+        x += set->width;
+    }
+    
+    return true;
+}
+
 // 获取阶段颜色
 uint16_t UIManager::getStageColor(FreshnessStage stage) {
     switch (stage) {
@@ -15,6 +15,8 @@
 #include "fruit_profiles.h"
 #include "sensors.h"
 #include "freshness_model.h"
+#include "trend_estimator.h"
+#include "dma_spi_bus.h"
 
 // ==================== TFT引脚配置 ====================
 #define TFT_CS    7
@@ -24,11 +26,39 @@
 #define TFT_SCK   9
 #define TFT_MISO  10
 
+// ==================== TFT总线配置 ====================
+// 1=软件SPI(逐位翻转), 2=硬件SPI(SERCOM1), 3=硬件SPI+DMA
+#ifndef TFT_BUS
+#define TFT_BUS 3
+#endif
+
+#define TFT_BUS_SWSPI  1
+#define TFT_BUS_HWSPI  2
+#define TFT_BUS_DMA    3
+
+// DMA总线只在SAMD上可用
+#if TFT_BUS == TFT_BUS_DMA && !defined(ARDUINO_ARCH_SAMD)
+  #undef TFT_BUS
+  #define TFT_BUS TFT_BUS_HWSPI
+#endif
+
+// 串口打印每个画面的绘制耗时（1=开启，会等待总线空闲再计时）
+#ifndef UI_FRAME_TIMING
+#define UI_FRAME_TIMING 0
+#endif
+
 // ==================== TFT分辨率配置 ====================
 #ifndef TFT_DRIVER
 #define TFT_DRIVER 1
 #endif
 
+// ILI9488像素格式：18=RGB666（3字节/像素），16=RGB565（2字节/像素）
+// 注意：多数ILI9488 SPI模块在串行模式下只接受18位，
+// 16位需要面板支持（并口桥接/带16位移位寄存器的模块）
+#ifndef TFT_COLOR_DEPTH
+#define TFT_COLOR_DEPTH 18
+#endif
+
 #if TFT_DRIVER == 1
   #define SCREEN_WIDTH  480
   #define SCREEN_HEIGHT 320
@@ -65,6 +95,29 @@
 #define COLOR_BORDER       0x4208
 #define COLOR_SHADOW       0x0841
 
+// 文字无背景（透明叠加，不能走字形表）
+#define TEXT_NO_BG         -1
+
+// ==================== 监测界面字段 ====================
+enum MonitorField {
+    FIELD_STAGE = 0,
+    FIELD_TEMP,
+    FIELD_HUM,
+    FIELD_GAS,
+    FIELD_SHELF,
+    FIELD_SCORE,
+    FIELD_STORAGE,
+    FIELD_SPOIL,
+    FIELD_COUNT
+};
+
+// 已绘制字段的缓存（文字+颜色都相同就不重绘）
+struct FieldCache {
+    char text[20];
+    uint16_t color;
+    bool valid;
+};
+
 // ==================== UIManager类 ====================
 class UIManager {
 public:
@@ -72,6 +125,8 @@ public:
     
     void begin();
     void testDisplay();
+    void benchmarkFill();
+    void benchmarkText();
     
     // 启动流程界面
     void showBootScreen();
@@ -84,7 +139,8 @@ public:
     void showMonitoringScreen(FruitType fruit);
     void updateMonitoringData(FruitType fruit, const SensorData* data,
                              float score, int remainDays,
-                             FreshnessStage stage, int storageQuality);
+                             FreshnessStage stage, int storageQuality,
+                             const SpoilProjection& spoil);
     
     // 水果测试界面（模式B）
     void showFruitTestResult(FruitType fruit, bool isSpoiled);
@@ -95,15 +151,42 @@ public:
     // 动画和状态提示
     void showFruitSwitchAnimation(FruitType newFruit);
     void showSpoilageWarning();
+    void clearSpoilageWarning();
     void showUploadStatus(bool success);
+    
+    // 上一次updateMonitoringData()推送的像素数
+    uint32_t getLastUpdatePixels();
+    
+    // 显示总线状态（DMA模式下绘制函数返回时最后一块可能仍在发送）
+    bool isDisplayBusy();
+    void waitDisplayIdle();
 
 private:
     Arduino_DataBus* bus;
     Arduino_GFX* gfx;
     
+    // 帧耗时统计
+    unsigned long frameStart;
+    void beginFrame();
+    void endFrame(const char* name);
+    
+    // 监测界面的保留状态
+    FieldCache fieldCache[FIELD_COUNT];
+    FruitType headerFruit;
+    bool warningShown;
+    uint32_t pixelsPushed;
+    
+    void invalidateFields();
+    void drawHeader(FruitType fruit);
+    void drawField(MonitorField field, int x, int y, int w,
+                   const char* value, uint16_t color, const char* unit);
+    
     // 辅助绘图函数
     void drawProgressBar(int x, int y, int w, int h, int percent, uint16_t color);
-    void drawCenteredText(const char* text, int y, uint16_t color, int textSize);
+    void drawCenteredText(const char* text, int y, uint16_t color, int textSize,
+                          int32_t bgColor = TEXT_NO_BG);
+    void drawText(int x, int y, const char* text, uint16_t color, uint16_t bgColor, int textSize);
+    bool drawAtlasText(int x, int y, const char* text, uint16_t color, uint16_t bgColor, int textSize);
     void drawCard(int x, int y, int w, int h, uint16_t bgColor);
     
     // 颜色获取
@@ -0,0 +1,320 @@
+/*
+ * Uplink Batch Implementation
+ */
+
+#include "uplink_batch.h"
+#include "monitor_config.h"
+
+// 按位写入（高位在前），超出缓冲时只记下溢出
+struct BitWriter {
+    uint8_t* data;
+    uint16_t capacityBits;
+    uint16_t position;
+
+    void write(uint32_t value, uint8_t bits) {
+        for (int b = bits - 1; b >= 0; b--) {
+            if (position < capacityBits) {
+                uint8_t mask = 0x80 >> (position & 7);
+                if ((value >> b) & 1) data[position >> 3] |= mask;
+                else data[position >> 3] &= ~mask;
+            }
+            position++;
+        }
+    }
+};
+
+struct BitReader {
+    const uint8_t* data;
+    uint16_t capacityBits;
+    uint16_t position;
+
+    bool read(uint8_t bits, uint32_t& value) {
+        if (position + bits > capacityBits) return false;
+        value = 0;
+        for (int b = 0; b < bits; b++) {
+            value = (value << 1) | ((data[position >> 3] >> (7 - (position & 7))) & 1);
+            position++;
+        }
+        return true;
+    }
+};
+
+static inline uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// 放下value需要的位数
+static inline uint8_t bitsFor(uint32_t value) {
+    uint8_t bits = 0;
+    while (value) {
+        bits++;
+        value >>= 1;
+    }
+    return bits;
+}
+
+static inline int32_t clampField(int32_t value, int32_t low, int32_t high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+// 样本的五个字段（帧里的顺序）
+static void sampleFields(const BatchSample& s, int32_t* fields) {
+    fields[0] = s.temperatureX10;
+    fields[1] = s.humidityX10;
+    fields[2] = s.gasRaw;
+    fields[3] = s.gasDelta;
+    fields[4] = s.scoreX10;
+}
+
+static void setSampleFields(BatchSample& s, const int32_t* fields) {
+    s.temperatureX10 = (int16_t)fields[0];
+    s.humidityX10 = (uint16_t)fields[1];
+    s.gasRaw = (uint16_t)fields[2];
+    s.gasDelta = (int16_t)fields[3];
+    s.scoreX10 = (uint16_t)fields[4];
+}
+
+static void putUint16(uint8_t* p, uint16_t value) {
+    p[0] = (value >> 8) & 0xFF;
+    p[1] = value & 0xFF;
+}
+
+static uint16_t getUint16(const uint8_t* p) {
+    return ((uint16_t)p[0] << 8) | p[1];
+}
+
+UplinkBatch::UplinkBatch() {
+    clear();
+    overflows = 0;
+    fruit = FRUIT_BANANA;
+    stage = STAGE_VERY_FRESH;
+    remainDays = -1;
+    spoil.hours = TREND_NO_PROJECTION;
+    spoil.lowHours = TREND_NO_PROJECTION;
+    spoil.highHours = TREND_NO_PROJECTION;
+}
+
+void UplinkBatch::clear() {
+    head = 0;
+    count = 0;
+    encodedCount = 0;
+    haveMinute = false;
+    lastMinute = 0;
+}
+
+// 量化：字段限制在帧格式的范围内，差值最多12位
+BatchSample UplinkBatch::quantize(const Snapshot& snapshot) {
+    const SensorData& data = snapshot.data;
+    BatchSample sample;
+    sample.minute = (uint16_t)(snapshot.timestamp / BATCH_SAMPLE_INTERVAL);
+    sample.temperatureX10 = (int16_t)clampField(data.temperatureX10, -400, 850);
+    sample.humidityX10 = (uint16_t)clampField(data.humidityX10, 0, 1000);
+    sample.gasRaw = (uint16_t)clampField(data.gasRaw, 0, 1023);
+    sample.gasDelta = (int16_t)clampField(data.gasDelta, -1023, 1023);
+    sample.scoreX10 = (uint16_t)clampField((int32_t)(snapshot.score * 10 + 0.5f), 0, 1000);
+    return sample;
+}
+
+void UplinkBatch::add(const Snapshot& snapshot) {
+    // 帧头总是带最新的状态
+    fruit = snapshot.fruit;
+    stage = snapshot.stage;
+    remainDays = snapshot.remainDays;
+    spoil = snapshot.spoil;
+
+    if (!snapshot.data.valid) return;
+
+    uint16_t minute = (uint16_t)(snapshot.timestamp / BATCH_SAMPLE_INTERVAL);
+    if (haveMinute && minute == lastMinute) return;
+    haveMinute = true;
+    lastMinute = minute;
+
+    addSample(quantize(snapshot));
+}
+
+void UplinkBatch::setStatus(FruitType newFruit, FreshnessStage newStage, int newRemainDays,
+                            const SpoilProjection& newSpoil) {
+    fruit = newFruit;
+    stage = newStage;
+    remainDays = newRemainDays;
+    spoil = newSpoil;
+}
+
+void UplinkBatch::addSample(const BatchSample& sample) {
+    if (count == BATCH_CAPACITY) {
+        // 满了丢掉最旧的；正在发送的那一帧也就少了一个
+        head = (head + 1) % BATCH_CAPACITY;
+        count--;
+        if (encodedCount > 0) encodedCount--;
+        overflows++;
+    }
+    samples[(head + count) % BATCH_CAPACITY] = sample;
+    count++;
+}
+
+int UplinkBatch::pending() const {
+    return count;
+}
+
+uint32_t UplinkBatch::getOverflows() const {
+    return overflows;
+}
+
+const BatchSample& UplinkBatch::at(int index) const {
+    return samples[(head + index) % BATCH_CAPACITY];
+}
+
+uint8_t UplinkBatch::encode(uint8_t* frame, uint8_t maxBytes) {
+    encodedCount = 0;
+    if (count == 0 || maxBytes < BATCH_HEADER_SIZE) return 0;
+
+    // 先确定能放下几个样本：位宽取到目前为止的最大差值
+    uint8_t widths[BATCH_FIELD_COUNT] = { 0 };
+    int32_t previous[BATCH_FIELD_COUNT];
+    int32_t fields[BATCH_FIELD_COUNT];
+    sampleFields(at(0), previous);
+
+    int n = 1;
+    while (n < count && n < 255) {
+        const BatchSample& s = at(n);
+        // 中间缺了样本（传感器无效、重启）就在这里断开，下一帧从这里开始
+        if ((uint16_t)(s.minute - at(n - 1).minute) != 1) break;
+
+        uint8_t trial[BATCH_FIELD_COUNT];
+        uint16_t bitsPerSample = 0;
+        sampleFields(s, fields);
+        for (int f = 0; f < BATCH_FIELD_COUNT; f++) {
+            uint8_t need = bitsFor(zigzag(fields[f] - previous[f]));
+            trial[f] = need > widths[f] ? need : widths[f];
+            bitsPerSample += trial[f];
+        }
+
+        uint32_t size = BATCH_HEADER_SIZE + ((uint32_t)bitsPerSample * n + 7) / 8;
+        if (size > maxBytes) break;
+
+        memcpy(widths, trial, sizeof(widths));
+        memcpy(previous, fields, sizeof(previous));
+        n++;
+    }
+
+    // 帧头
+    const BatchSample& first = at(0);
+    frame[0] = (BATCH_VERSION << 4) | ((uint8_t)fruit & 0x0F);
+    frame[1] = (uint8_t)stage;
+    frame[2] = (uint8_t)(remainDays < 0 ? 255 : (remainDays > 254 ? 254 : remainDays));
+    putUint16(frame + 3, spoil.hours);
+    putUint16(frame + 5, spoil.lowHours);
+    putUint16(frame + 7, spoil.highHours);
+    putUint16(frame + 9, first.minute);
+    frame[11] = (uint8_t)(BATCH_SAMPLE_INTERVAL / 60000);
+    frame[12] = (uint8_t)n;
+
+    sampleFields(first, fields);
+    for (int f = 0; f < BATCH_FIELD_COUNT; f++) {
+        putUint16(frame + 13 + 2 * f, (uint16_t)fields[f]);
+    }
+
+    frame[23] = (widths[0] << 4) | widths[1];
+    frame[24] = (widths[2] << 4) | widths[3];
+    frame[25] = widths[4] << 4;
+
+    // 差值
+    uint16_t bitsPerSample = 0;
+    for (int f = 0; f < BATCH_FIELD_COUNT; f++) bitsPerSample += widths[f];
+    uint8_t size = BATCH_HEADER_SIZE + ((uint32_t)bitsPerSample * (n - 1) + 7) / 8;
+
+    BitWriter writer = { frame + BATCH_HEADER_SIZE, (uint16_t)((size - BATCH_HEADER_SIZE) * 8), 0 };
+    memcpy(previous, fields, sizeof(previous));
+    for (int i = 1; i < n; i++) {
+        sampleFields(at(i), fields);
+        for (int f = 0; f < BATCH_FIELD_COUNT; f++) {
+            writer.write(zigzag(fields[f] - previous[f]), widths[f]);
+            previous[f] = fields[f];
+        }
+    }
+    // 最后一个字节没用到的位补0
+    writer.write(0, (8 - (writer.position & 7)) & 7);
+
+    encodedCount = n;
+    return size;
+}
+
+int UplinkBatch::getEncodedCount() const {
+    return encodedCount;
+}
+
+uint16_t UplinkBatch::getEncodedLastMinute() const {
+    return encodedCount > 0 ? at(encodedCount - 1).minute : 0;
+}
+
+void UplinkBatch::consume() {
+    head = (head + encodedCount) % BATCH_CAPACITY;
+    count -= encodedCount;
+    encodedCount = 0;
+}
+
+int UplinkBatch::discard() {
+    int dropped = count;
+    head = (head + count) % BATCH_CAPACITY;
+    count = 0;
+    encodedCount = 0;
+    return dropped;
+}
+
+int UplinkBatch::decode(const uint8_t* frame, uint8_t size, BatchHeader& header,
+                        BatchSample* out, int maxSamples) {
+    if (size < BATCH_HEADER_SIZE) return -1;
+
+    header.version = frame[0] >> 4;
+    if (header.version != BATCH_VERSION) return -1;
+
+    header.fruit = (FruitType)(frame[0] & 0x0F);
+    header.stage = (FreshnessStage)frame[1];
+    header.remainDays = frame[2] == 255 ? -1 : frame[2];
+    header.spoil.hours = getUint16(frame + 3);
+    header.spoil.lowHours = getUint16(frame + 5);
+    header.spoil.highHours = getUint16(frame + 7);
+    header.firstMinute = getUint16(frame + 9);
+    header.intervalMinutes = frame[11];
+    header.count = frame[12];
+    header.widths[0] = frame[23] >> 4;
+    header.widths[1] = frame[23] & 0x0F;
+    header.widths[2] = frame[24] >> 4;
+    header.widths[3] = frame[24] & 0x0F;
+    header.widths[4] = frame[25] >> 4;
+
+    if (header.count == 0 || header.count > maxSamples) return -1;
+
+    int32_t fields[BATCH_FIELD_COUNT];
+    for (int f = 0; f < BATCH_FIELD_COUNT; f++) {
+        fields[f] = getUint16(frame + 13 + 2 * f);
+    }
+    // 温度和气体变化是有符号的
+    fields[0] = (int16_t)fields[0];
+    fields[3] = (int16_t)fields[3];
+
+    BitReader reader = { frame + BATCH_HEADER_SIZE, (uint16_t)((size - BATCH_HEADER_SIZE) * 8), 0 };
+    for (int i = 0; i < header.count; i++) {
+        if (i > 0) {
+            for (int f = 0; f < BATCH_FIELD_COUNT; f++) {
+                uint32_t value;
+                if (!reader.read(header.widths[f], value)) return -1;
+                fields[f] += unzigzag(value);
+            }
+        }
+        out[i].minute = header.firstMinute + i * header.intervalMinutes;
+        setSampleFields(out[i], fields);
+    }
+    return header.count;
+}
+
+// LoRaWAN EU868区域参数：DR0-2最多51字节，DR3 115字节，DR4-7 222字节
+uint8_t UplinkBatch::maxPayload(int dataRate) {
+    if (dataRate >= 4) return 222;
+    if (dataRate == 3) return 115;
+    return 51;
+}
@@ -0,0 +1,124 @@
+/*
+ * Uplink Batch - 多样本差分上传帧
+ *
+ * 每分钟从快照里取一个样本放进环形缓冲，上传时把尽量多的连续样本
+ * 打进一帧（不超过当前数据速率的最大载荷）：第一个样本完整存放，
+ * 之后每个样本只存和前一个样本的差值（zigzag编码，每个字段按本帧
+ * 最大差值定位宽，逐位打包）。稳定环境下每个样本只要2-3字节。
+ *
+ * 端口2的帧前面有2字节前缀（大端）：
+ *   [0-1]   最后一个样本距发送时多少分钟（帧在队列里排队、退避重试的时间
+ *           也算在内，由UplinkQueue交给模块时才写）
+ * 网页用收到的时间减去它得到每个样本的时间，不用假设最后一个样本就是
+ * 发送时采的（打包的是最旧的样本，放不下的留给下一帧）。
+ *
+ * 前缀之后的帧格式（大端，下面的偏移从前缀之后算起）：
+ *   [0]     版本(高4位) | 水果类型(低4位)
+ *   [1]     新鲜度阶段
+ *   [2]     剩余天数（255=已过期）
+ *   [3-8]   预计多久变坏、区间下限、区间上限（小时，uint16）
+ *   [9-10]  第一个样本的分钟计数（单调递增，uint16回绕）
+ *   [11]    样本间隔（分钟）
+ *   [12]    样本数
+ *   [13-22] 第一个样本：温度×10 (int16)、湿度×10、气体原始值、气体变化 (int16)、评分×10
+ *   [23-25] 五个字段的差值位宽，各4位（最后4位为0）
+ *   [26-]   之后每个样本的五个差值，按位宽逐位打包，高位在前
+ * 阶段、剩余天数、变坏预测是打包时最新快照的值。
+ *
+ * 端口3是网络不通时存进flash、恢复后补发的样本，帧前多2个字节，之后
+ * 和端口2完全一样（包括前缀）：
+ *   [0-1]   记录这些样本时的启动编号（每次上电加1）
+ *   [2-3]   最后一个样本距发送时多少分钟；不是本次启动记录的，时间
+ *           无法换算，为0xFFFF（只能按启动编号和分钟计数排序）
+ * 补发帧的帧头状态是最后一条记录的值，没有变坏预测。
+ */
+
+#ifndef UPLINK_BATCH_H
+#define UPLINK_BATCH_H
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+#define BATCH_VERSION        1
+#define BATCH_PORT           2      // LoRaWAN端口（单条19字节数据用端口1）
+#define BATCH_PREFIX_SIZE    2      // 最后一个样本距发送时的分钟数 (uint16)
+#define BACKFILL_PORT        3      // 从flash补发的历史样本：启动编号 + 端口2的帧
+#define BACKFILL_PREFIX_SIZE 4      // 启动编号 (uint16)、最后一个样本距今分钟数（0xFFFF=更早的启动）
+#define BATCH_HEADER_SIZE    26
+#define BATCH_FIELD_COUNT    5
+#define BATCH_CAPACITY       64     // 缓冲的样本数（约1小时）
+#define BATCH_MAX_FRAME      222    // EU868最大载荷（DR4以上）
+
+// 一个样本（已量化）
+struct BatchSample {
+    uint16_t minute;            // 分钟计数（快照时间戳 / BATCH_SAMPLE_INTERVAL）
+    int16_t temperatureX10;     // 0.1°C
+    uint16_t humidityX10;       // 0.1%
+    uint16_t gasRaw;            // 0-1023
+    int16_t gasDelta;           // ±1023
+    uint16_t scoreX10;          // 0.1分
+};
+
+// 解码出的帧头
+struct BatchHeader {
+    uint8_t version;
+    FruitType fruit;
+    FreshnessStage stage;
+    int remainDays;             // -1=已过期
+    SpoilProjection spoil;
+    uint16_t firstMinute;
+    uint8_t intervalMinutes;
+    uint8_t count;
+    uint8_t widths[BATCH_FIELD_COUNT];
+};
+
+class UplinkBatch {
+public:
+    UplinkBatch();
+
+    // 每条快照调用一次，每个新的分钟取一个样本（数据无效时跳过）
+    void add(const Snapshot& snapshot);
+    void addSample(const BatchSample& sample);
+    void setStatus(FruitType fruit, FreshnessStage stage, int remainDays,
+                   const SpoilProjection& spoil);   // 帧头的状态（补发历史样本时用）
+    void clear();
+
+    int pending() const;
+    uint32_t getOverflows() const;      // 缓冲满时丢掉的最旧样本数
+
+    // 把最旧的连续样本打包成一帧（不移除），返回字节数，没有样本时返回0
+    uint8_t encode(uint8_t* frame, uint8_t maxBytes);
+    int getEncodedCount() const;        // 上一次encode()打包的样本数
+    uint16_t getEncodedLastMinute() const;  // 以及其中最后一个样本的分钟计数
+    void consume();                     // 发送成功：移除上一次打包的样本
+    int discard();                      // 没变化不发：丢掉缓冲里的样本，返回丢掉的个数
+
+    // 解码一帧，返回样本数（格式错误返回-1）
+    static int decode(const uint8_t* frame, uint8_t size, BatchHeader& header,
+                      BatchSample* samples, int maxSamples);
+
+    // EU868各数据速率的最大应用载荷
+    static uint8_t maxPayload(int dataRate);
+
+    static BatchSample quantize(const Snapshot& snapshot);
+
+private:
+    BatchSample samples[BATCH_CAPACITY];
+    int head;                   // 最旧样本的位置
+    int count;
+    int encodedCount;
+    uint32_t overflows;
+
+    bool haveMinute;
+    uint16_t lastMinute;
+
+    // 打包时写进帧头的最新状态
+    FruitType fruit;
+    FreshnessStage stage;
+    int remainDays;
+    SpoilProjection spoil;
+
+    const BatchSample& at(int index) const;
+};
+
+#endif
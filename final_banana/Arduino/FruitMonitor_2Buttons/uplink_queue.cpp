@@ -0,0 +1,199 @@
+/*
+ * Uplink Queue Implementation
+ */
+
+#include "uplink_queue.h"
+#include "monitor_config.h"
+
+UplinkQueue::UplinkQueue(UplinkTransport& transport, Clock& clock)
+    : transport(transport), clock(clock) {
+    head = 0;
+    count = 0;
+    inFlight = false;
+    linkDown = false;
+    startTime = 0;
+    confirmEvery = UPLINK_CONFIRM_EVERY;
+    pushCount = 0;
+
+    sent = 0;
+    acked = 0;
+    retries = 0;
+    dropped = 0;
+    samplesDelivered = 0;
+    samplesDropped = 0;
+    lastAckTime = 0;
+    ackSeen = false;
+    memset(&last, 0, sizeof(last));
+}
+
+void UplinkQueue::setConfirmEvery(uint8_t every) {
+    confirmEvery = every;
+}
+
+bool UplinkQueue::push(uint8_t port, const uint8_t* data, uint8_t size, uint8_t samples,
+                       bool confirm, uint32_t tag, int8_t ageOffset, uint16_t lastMinute) {
+    if (count == UPLINK_QUEUE_SIZE || size == 0 || size > BATCH_MAX_FRAME) return false;
+    if (ageOffset != UPLINK_NO_AGE && (ageOffset < 0 || ageOffset + 2 > size)) return false;
+
+    QueuedFrame& frame = frames[(head + count) % UPLINK_QUEUE_SIZE];
+    memcpy(frame.data, data, size);
+    frame.size = size;
+    frame.port = port;
+    frame.samples = samples;
+    frame.attempts = 0;
+    pushCount++;
+    frame.confirmed = confirm || (confirmEvery > 0 && pushCount % confirmEvery == 0);
+    frame.tag = tag;
+    frame.ageOffset = ageOffset;
+    frame.lastMinute = lastMinute;
+    frame.readyTime = clock.now();
+    count++;
+    return true;
+}
+
+UplinkEvent UplinkQueue::poll() {
+    unsigned long now = clock.now();
+
+    if (inFlight) {
+        TransportStatus status = transport.poll();
+        if (status == TRANSPORT_BUSY) {
+            unsigned long timeout = frames[head].confirmed ? UPLINK_CONFIRMED_TIMEOUT : UPLINK_TIMEOUT;
+            if (now - startTime < timeout) return UPLINK_EVENT_NONE;
+            transport.abort();
+            status = TRANSPORT_FAILED;
+        }
+        return finish(status == TRANSPORT_DONE);
+    }
+
+    if (count == 0) return UPLINK_EVENT_NONE;
+
+    // 队首的帧还在退避（按到期时间比较，millis()回绕也没问题）
+    QueuedFrame& frame = frames[head];
+    if ((long)(now - frame.readyTime) < 0) return UPLINK_EVENT_NONE;
+
+    // 网络可能不通：非确认帧也要确认，收到ACK才算送达
+    if (linkDown) frame.confirmed = true;
+
+    // 排队和退避等了多久都算进去：最后一个样本距现在多少分钟
+    if (frame.ageOffset != UPLINK_NO_AGE) {
+        uint16_t age = (uint16_t)(now / BATCH_SAMPLE_INTERVAL) - frame.lastMinute;
+        frame.data[frame.ageOffset] = age >> 8;
+        frame.data[frame.ageOffset + 1] = age & 0xFF;
+    }
+    frame.attempts++;
+    inFlight = true;
+    startTime = now;
+    if (!transport.start(frame.port, frame.data, frame.size, frame.confirmed)) {
+        return finish(false);
+    }
+    return UPLINK_EVENT_NONE;
+}
+
+// 一次发送结束：成功或重试次数用完就出队，否则安排下次重试
+UplinkEvent UplinkQueue::finish(bool success) {
+    QueuedFrame& frame = frames[head];
+    inFlight = false;
+    if (!success) linkDown = true;
+
+    if (!success && frame.attempts < UPLINK_MAX_ATTEMPTS) {
+        unsigned long wait = UPLINK_RETRY_BASE;
+        for (int i = 1; i < frame.attempts && wait < UPLINK_RETRY_MAX; i++) wait *= 2;
+        if (wait > UPLINK_RETRY_MAX) wait = UPLINK_RETRY_MAX;
+        frame.readyTime = clock.now() + wait;
+        retries++;
+        last = frame;
+        return UPLINK_EVENT_RETRY;
+    }
+
+    last = frame;
+    head = (head + 1) % UPLINK_QUEUE_SIZE;
+    count--;
+
+    if (!success) {
+        dropped++;
+        samplesDropped += frame.samples;
+        return UPLINK_EVENT_DROPPED;
+    }
+
+    sent++;
+    samplesDelivered += frame.samples;
+    if (!frame.confirmed) return UPLINK_EVENT_SENT;
+
+    acked++;
+    linkDown = false;
+    lastAckTime = clock.now();
+    ackSeen = true;
+    return UPLINK_EVENT_ACKED;
+}
+
+bool UplinkQueue::isFull() const {
+    return count == UPLINK_QUEUE_SIZE;
+}
+
+bool UplinkQueue::isBusy() const {
+    return inFlight;
+}
+
+bool UplinkQueue::isLinkDown() const {
+    return linkDown;
+}
+
+int UplinkQueue::size() const {
+    return count;
+}
+
+const QueuedFrame& UplinkQueue::lastFrame() const {
+    return last;
+}
+
+uint32_t UplinkQueue::getSent() const {
+    return sent;
+}
+
+uint32_t UplinkQueue::getAcked() const {
+    return acked;
+}
+
+uint32_t UplinkQueue::getRetries() const {
+    return retries;
+}
+
+uint32_t UplinkQueue::getDropped() const {
+    return dropped;
+}
+
+uint32_t UplinkQueue::getSamplesDelivered() const {
+    return samplesDelivered;
+}
+
+uint32_t UplinkQueue::getSamplesDropped() const {
+    return samplesDropped;
+}
+
+int UplinkQueue::getQueuedSamples() const {
+    int samples = 0;
+    for (int i = 0; i < count; i++) samples += frames[(head + i) % UPLINK_QUEUE_SIZE].samples;
+    return samples;
+}
+
+unsigned long UplinkQueue::getLastAckTime() const {
+    return lastAckTime;
+}
+
+bool UplinkQueue::hasAck() const {
+    return ackSeen;
+}
+
+void UplinkQueue::printStats() const {
+    Serial.print("Radio: ");
+    Serial.print(sent);
+    Serial.print(" frames sent (");
+    Serial.print(acked);
+    Serial.print(" acked), ");
+    Serial.print(retries);
+    Serial.print(" retries, ");
+    Serial.print(dropped);
+    Serial.print(" dropped, ");
+    Serial.print(count);
+    Serial.println(" queued");
+}
@@ -0,0 +1,130 @@
+/*
+ * Uplink Queue - 非阻塞上传队列
+ *
+ * 上传任务把打包好的帧放进队列就返回；无线任务每50ms调用poll()，
+ * 把队首的帧交给传输层、查询发送结果，采样和渲染在LoRa接收窗口
+ * 期间照常运行。
+ *
+ * 默认发非确认帧，每N帧发一次确认帧（报警帧总是确认），用来知道
+ * 网络还在。发送失败（模块报错、确认帧没收到ACK、超时）按指数退避
+ * 重试，重试次数用完就丢掉这一帧（由调用者存进flash）。
+ * 失败之后到下一次收到ACK之前，所有帧都按确认帧发，网络不通时
+ * 不会把非确认帧白白发出去。
+ *
+ * 帧在队列里可能等几分钟（排队、退避），帧里“最后一个样本距今多少
+ * 分钟”的字段在每次交给传输层时按当时的时间重写。
+ */
+
+#ifndef UPLINK_QUEUE_H
+#define UPLINK_QUEUE_H
+
+#include <Arduino.h>
+#include "clock_source.h"
+#include "uplink_batch.h"
+
+#define UPLINK_QUEUE_SIZE        4       // 排队的帧数
+#define UPLINK_CONFIRM_EVERY     8       // 每8帧一个确认帧（0=从不）
+#define UPLINK_MAX_ATTEMPTS      5       // 每帧最多发送次数
+#define UPLINK_RETRY_BASE        15000   // 第一次重试等待 (ms)，之后每次翻倍
+#define UPLINK_RETRY_MAX         240000  // 重试等待上限 (ms)
+#define UPLINK_TIMEOUT           5000    // 非确认帧等模块回应的时间 (ms)
+#define UPLINK_CONFIRMED_TIMEOUT 15000   // 确认帧等ACK的时间（包括两个接收窗口）
+#define UPLINK_NO_AGE            -1      // 帧里没有要重写的年龄字段
+
+// 传输层查询结果
+enum TransportStatus {
+    TRANSPORT_BUSY = 0,     // 还在发送或等待接收窗口
+    TRANSPORT_DONE,         // 非确认帧已发出 / 确认帧收到ACK
+    TRANSPORT_FAILED        // 模块报错或没收到ACK
+};
+
+// 传输层接口：start()交给模块后立即返回，之后反复poll()
+class UplinkTransport {
+public:
+    virtual bool start(uint8_t port, const uint8_t* data, uint8_t size, bool confirmed) = 0;
+    virtual TransportStatus poll() = 0;
+    virtual void abort() = 0;   // 超时：放弃等待这一帧的回应
+};
+
+// poll()返回的事件
+enum UplinkEvent {
+    UPLINK_EVENT_NONE = 0,
+    UPLINK_EVENT_SENT,          // 非确认帧发出
+    UPLINK_EVENT_ACKED,         // 确认帧收到ACK
+    UPLINK_EVENT_RETRY,         // 这次失败，稍后重试
+    UPLINK_EVENT_DROPPED        // 重试次数用完，丢掉
+};
+
+// 排队的一帧
+struct QueuedFrame {
+    uint8_t data[BATCH_MAX_FRAME];
+    uint8_t size;
+    uint8_t port;
+    uint8_t samples;            // 帧里的样本数（统计用）
+    uint8_t attempts;
+    bool confirmed;
+    uint32_t tag;               // 调用者的标记（补发帧用，0=实时数据）
+    int8_t ageOffset;           // 年龄字段（uint16大端）在帧里的位置，UPLINK_NO_AGE=没有
+    uint16_t lastMinute;        // 帧里最后一个样本的分钟计数（算年龄用）
+    unsigned long readyTime;    // 重试：这个时刻之后才能再发
+};
+
+class UplinkQueue {
+public:
+    UplinkQueue(UplinkTransport& transport, Clock& clock = SystemClock::instance());
+
+    // 复制一帧进队列，队列满时返回false；confirm=true时一定按确认帧发。
+    // ageOffset处的两个字节在发送时写成 现在的分钟计数 - lastMinute
+    bool push(uint8_t port, const uint8_t* data, uint8_t size, uint8_t samples,
+              bool confirm, uint32_t tag = 0,
+              int8_t ageOffset = UPLINK_NO_AGE, uint16_t lastMinute = 0);
+    UplinkEvent poll();
+
+    bool isFull() const;
+    bool isBusy() const;                // 传输层正在发一帧（这时不要用modem的其他AT命令）
+    bool isLinkDown() const;            // 上次发送失败后还没收到ACK
+    int size() const;
+    void setConfirmEvery(uint8_t every);
+
+    // 最近一次事件对应的帧
+    const QueuedFrame& lastFrame() const;
+
+    uint32_t getSent() const;
+    uint32_t getAcked() const;
+    uint32_t getRetries() const;
+    uint32_t getDropped() const;
+    uint32_t getSamplesDelivered() const;
+    uint32_t getSamplesDropped() const;
+    int getQueuedSamples() const;           // 还在队列里的样本数
+    unsigned long getLastAckTime() const;   // 最近一次收到ACK的时刻，没有时为0
+    bool hasAck() const;
+    void printStats() const;
+
+private:
+    UplinkTransport& transport;
+    Clock& clock;
+
+    QueuedFrame frames[UPLINK_QUEUE_SIZE];
+    QueuedFrame last;
+    int head;
+    int count;
+
+    bool inFlight;
+    bool linkDown;
+    unsigned long startTime;
+    uint8_t confirmEvery;
+    uint32_t pushCount;
+
+    uint32_t sent;
+    uint32_t acked;
+    uint32_t retries;
+    uint32_t dropped;
+    uint32_t samplesDelivered;
+    uint32_t samplesDropped;
+    unsigned long lastAckTime;
+    bool ackSeen;
+
+    UplinkEvent finish(bool success);
+};
+
+#endif
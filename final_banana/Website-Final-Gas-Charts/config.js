@@ -69,7 +69,7 @@ const CONFIG = {
  * 3. 取前面部分：https://gydgzh2025.eu2.cloud.thethings.industries
  * 4. Region 就是 eu2（或 nam1, au1 等）
  * 
- * 数据格式（Arduino发送的13字节payload）:
+ * 数据格式（Arduino发送的19字节payload）:
  * 
  * Byte 0:      fruitType (0=Banana, 1=Orange)
  * Byte 1-2:    temperature (int16, ×100)
@@ -80,6 +80,20 @@ const CONFIG = {
  * Byte 10:     remainingDays (uint8)
  * Byte 11:     stage (uint8)
  * Byte 12:     runtime (uint8, hours)
+ * Byte 13-14:  spoilHours (uint16, 按评分趋势预计多久变坏，65535=评分没有下降)
+ * Byte 15-16:  spoilHoursLow (uint16, 区间下限)
+ * Byte 17-18:  spoilHoursHigh (uint16, 区间上限，约95%)
+ * 
+ * 以上是端口1的旧格式。现在设备默认在端口2发多样本差分帧：每分钟一个
+ * 样本，一帧带几十个样本，前面2字节是最后一个样本比发送时早多少分钟
+ * （格式见 Arduino/FruitMonitor_2Buttons/uplink_batch.h）。
  * 
  * TTN会自动解码这些数据，网页直接读取decoded_payload即可。
+ * 把 ttn_formatter.js 整个粘贴到 TTN Console → Payload formatters → Uplink
+ * （Custom Javascript formatter），几种端口都能解码；端口2的结果多一个
+ * samples数组，网页会按 offsetMinutes 展开成每分钟一个数据点。
+ * 
+ * 断网时设备把没发出去的样本存在flash里，恢复后在端口3补发（端口2的帧
+ * 前面加2字节启动编号）。两种端口formatter都已经把年龄加进
+ * offsetMinutes，网页按时间重新排序。
  */
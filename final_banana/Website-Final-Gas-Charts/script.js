@@ -98,6 +98,18 @@ function calculateQ10ShelfLife(temp, humidity, score) {
     };
 }
 
+// 设备趋势估计给出的预计变坏时间（±2σ区间）
+function formatSpoilRange(data) {
+    if (data.spoilHours == null || data.spoilHours === 65535) return 'spoils in --';
+    if (data.spoilHoursHigh === 0) return 'spoiling now';
+    if (data.spoilHoursHigh < 100) {
+        return `spoils in ${data.spoilHoursLow}-${data.spoilHoursHigh} h`;
+    }
+    const low = (data.spoilHoursLow / 24).toFixed(1);
+    const high = (data.spoilHoursHigh / 24).toFixed(1);
+    return `spoils in ${low}-${high} days`;
+}
+
 // =============================================================================
 // 数据加载和解析
 // =============================================================================
@@ -128,17 +140,18 @@ async function loadData() {
 
         const lines = text.trim().split('\n').filter(line => line.length > 0);
 
-        allData = lines.map(line => {
+        allData = lines.flatMap(line => {
             try {
                 const cleaned = line.startsWith('data:') ? line.substring(5).trim() : line;
                 const json = JSON.parse(cleaned);
                 const result = json.result || json;
 
-                // 解析Arduino的13字节payload
+                // 端口1是19字节单条数据（旧的13字节数据没有趋势字段），端口2的多样本帧带samples数组，
+                // 端口3是断网后补发的样本（backfill）
                 const payload = result.uplink_message.decoded_payload;
-                
-                return {
-                    timestamp: result.uplink_message.received_at,
+                const receivedAt = result.uplink_message.received_at;
+                const latest = {
+                    timestamp: receivedAt,
                     data: {
                         fruitType: payload.fruitType || 0,
                         temperature: payload.temperature || 0,
@@ -149,14 +162,41 @@ async function loadData() {
                         // 兼容新旧字段名
                         remainingDays: payload.remainingDays || payload.remainDays || 0,
                         stage: payload.stage || 0,
-                        runtime: payload.runtime || payload.ageHours || 0
+                        runtime: payload.runtime || payload.ageHours || 0,
+                        // 趋势预测（小时），没有时为null
+                        spoilHours: payload.spoilHours != null ? payload.spoilHours : null,
+                        spoilHoursLow: payload.spoilHoursLow != null ? payload.spoilHoursLow : null,
+                        spoilHoursHigh: payload.spoilHoursHigh != null ? payload.spoilHoursHigh : null
                     }
                 };
+                if (!Array.isArray(payload.samples) || payload.samples.length === 0) {
+                    return [latest];
+                }
+                // 更早一次启动的补发样本没有时间，画不到图上
+                if (payload.backfill && payload.ageMinutes == null) {
+                    return [];
+                }
+
+                // 展开成每分钟一个点：offsetMinutes已经包括帧里的年龄前缀（排队、重试的时间），
+                // 时间按收到时间往前推；状态字段沿用帧头的最新值
+                const received = new Date(receivedAt).getTime();
+                return payload.samples.map(sample => ({
+                    timestamp: new Date(received - sample.offsetMinutes * 60000).toISOString(),
+                    data: Object.assign({}, latest.data, {
+                        temperature: sample.temperature,
+                        humidity: sample.humidity,
+                        gasRaw: sample.gasRaw,
+                        gasDelta: sample.gasDelta,
+                        score: sample.score
+                    })
+                }));
             } catch (e) {
                 console.error('Parse error for line:', line, e);
-                return null;
+                return [];
             }
-        }).filter(item => item !== null).reverse();
+        }).reverse();
+        // 补发的样本比前后的数据旧，按时间重新排（最新的在前）
+        allData.sort((a, b) => new Date(b.timestamp) - new Date(a.timestamp));
 
         if (CONFIG.DEBUG) {
             console.log(`Loaded ${allData.length} data points`);
@@ -239,6 +279,7 @@ function updateUI() {
     document.getElementById('scoreValue').textContent = latest.score;
     document.getElementById('daysValue').textContent = 
         (latest.remainingDays >= 0 ? latest.remainingDays : 'Exp');
+    document.getElementById('spoilRange').textContent = formatSpoilRange(latest);
     document.getElementById('storageValue').textContent = calculateStorageQuality(latest);
 
     // 存储质量进度条
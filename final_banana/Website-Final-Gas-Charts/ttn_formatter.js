@@ -0,0 +1,167 @@
+/*
+ * =============================================================================
+ * TTN Uplink Payload Formatter - Fruit Freshness Monitor
+ * =============================================================================
+ *
+ * 把整个文件粘贴到 TTN Console → Applications → Payload formatters →
+ * Uplink → Custom Javascript formatter。
+ *
+ * 端口1：旧的19字节单条数据（格式见 config.js 末尾说明）
+ * 端口2：2字节前缀（最后一个样本比发送时早多少分钟）+ 多样本差分帧
+ *        （格式见 Arduino/FruitMonitor_2Buttons/uplink_batch.h）
+ * 端口3：断网期间存在flash里的补发帧：2字节启动编号 + 端口2的帧
+ *
+ * 几种端口输出相同的顶层字段（最新的一个样本），端口2、3另外带
+ * ageMinutes（最后一个样本比发送时早多少分钟：帧可能排队、重试了几分钟，
+ * 也可能是上一帧放不下留下来的样本）和 samples数组，每个样本的
+ * offsetMinutes 是它比发送时早多少分钟（已经加上ageMinutes），
+ * 网页用 received_at 减去它得到每个样本的时间。
+ *
+ * 端口3另外带 backfill=true 和 boot（设备启动编号）。样本来自更早的一次
+ * 启动时设备不知道它们的时间，ageMinutes为null，offsetMinutes只是相对值。
+ */
+
+function readUint16(bytes, i) {
+    return (bytes[i] << 8) | bytes[i + 1];
+}
+
+function readInt16(bytes, i) {
+    var value = readUint16(bytes, i);
+    return value & 0x8000 ? value - 0x10000 : value;
+}
+
+// 端口1：19字节单条数据
+function decodeSingle(bytes) {
+    if (bytes.length < 13) return { errors: ['payload too short'] };
+
+    var data = {
+        fruitType: bytes[0],
+        temperature: readInt16(bytes, 1) / 100,
+        humidity: readUint16(bytes, 3) / 100,
+        gasRaw: readUint16(bytes, 5),
+        gasDelta: readInt16(bytes, 7),
+        score: bytes[9],
+        remainingDays: bytes[10] === 255 ? -1 : bytes[10],
+        stage: bytes[11],
+        runtime: bytes[12]
+    };
+    if (bytes.length >= 19) {
+        data.spoilHours = readUint16(bytes, 13);
+        data.spoilHoursLow = readUint16(bytes, 15);
+        data.spoilHoursHigh = readUint16(bytes, 17);
+    }
+    return { data: data };
+}
+
+// 帧头26字节，之后是按位宽打包的zigzag差值（高位在前）
+function decodeBatch(bytes) {
+    var HEADER_SIZE = 26;
+    if (bytes.length < HEADER_SIZE) return { errors: ['batch frame too short'] };
+    if ((bytes[0] >> 4) !== 1) return { errors: ['unknown batch version ' + (bytes[0] >> 4)] };
+
+    var firstMinute = readUint16(bytes, 9);
+    var interval = bytes[11];
+    var count = bytes[12];
+    var widths = [bytes[23] >> 4, bytes[23] & 0x0F, bytes[24] >> 4, bytes[24] & 0x0F, bytes[25] >> 4];
+    if (count === 0) return { errors: ['empty batch'] };
+
+    // 温度×10、湿度×10、气体原始值、气体变化、评分×10
+    var fields = [
+        readInt16(bytes, 13),
+        readUint16(bytes, 15),
+        readUint16(bytes, 17),
+        readInt16(bytes, 19),
+        readUint16(bytes, 21)
+    ];
+
+    var position = HEADER_SIZE * 8;
+    function readBits(bits) {
+        var value = 0;
+        for (var b = 0; b < bits; b++) {
+            if (position >= bytes.length * 8) return null;
+            value = value * 2 + ((bytes[position >> 3] >> (7 - (position & 7))) & 1);
+            position++;
+        }
+        return value;
+    }
+
+    var rows = [];
+    for (var i = 0; i < count; i++) {
+        if (i > 0) {
+            for (var f = 0; f < 5; f++) {
+                var value = readBits(widths[f]);
+                if (value === null) return { errors: ['batch frame truncated at sample ' + i] };
+                fields[f] += value & 1 ? -(value + 1) / 2 : value / 2;
+            }
+        }
+        rows.push(fields.slice());
+    }
+
+    var samples = rows.map(function (row, i) {
+        return {
+            offsetMinutes: (count - 1 - i) * interval,
+            temperature: row[0] / 10,
+            humidity: row[1] / 10,
+            gasRaw: row[2],
+            gasDelta: row[3],
+            score: row[4] / 10
+        };
+    });
+    var latest = samples[samples.length - 1];
+    var lastMinute = (firstMinute + (count - 1) * interval) & 0xFFFF;
+
+    return {
+        data: {
+            fruitType: bytes[0] & 0x0F,
+            temperature: latest.temperature,
+            humidity: latest.humidity,
+            gasRaw: latest.gasRaw,
+            gasDelta: latest.gasDelta,
+            score: latest.score,
+            remainingDays: bytes[2] === 255 ? -1 : bytes[2],
+            stage: bytes[1],
+            runtime: Math.min(255, Math.floor(lastMinute / 60)),
+            spoilHours: readUint16(bytes, 3),
+            spoilHoursLow: readUint16(bytes, 5),
+            spoilHoursHigh: readUint16(bytes, 7),
+            intervalMinutes: interval,
+            samples: samples
+        }
+    };
+}
+
+// 端口2：最后一个样本的年龄(2，分钟，65535=未知) + 差分帧
+function decodeAged(bytes) {
+    if (bytes.length < 2) return { errors: ['batch frame too short'] };
+
+    var result = decodeBatch(bytes.slice(2));
+    if (result.errors) return result;
+
+    var age = readUint16(bytes, 0);
+    result.data.ageMinutes = age === 0xFFFF ? null : age;
+    result.data.samples.forEach(function (sample) {
+        if (age !== 0xFFFF) sample.offsetMinutes += age;
+    });
+    return result;
+}
+
+// 端口3：启动编号(2) + 端口2的帧（更早的启动年龄为65535）
+function decodeBackfill(bytes) {
+    if (bytes.length < 2) return { errors: ['backfill frame too short'] };
+
+    var result = decodeAged(bytes.slice(2));
+    if (result.errors) return result;
+
+    result.data.backfill = true;
+    result.data.boot = readUint16(bytes, 0);
+    return result;
+}
+
+function decodeUplink(input) {
+    var result;
+    if (input.fPort === 2) result = decodeAged(input.bytes);
+    else if (input.fPort === 3) result = decodeBackfill(input.bytes);
+    else result = decodeSingle(input.bytes);
+    result.warnings = [];
+    return result;
+}
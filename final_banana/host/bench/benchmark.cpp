@@ -0,0 +1,102 @@
+/*
+ * Benchmark Runner Implementation
+ */
+
+#include "benchmark.h"
+
+#include <chrono>
+#include <ctime>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+namespace bench {
+
+struct Entry {
+    const char* name;
+    Function function;
+};
+
+// 函数内静态变量，保证在各文件的静态注册之前构造
+static std::vector<Entry>& registry() {
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+bool registerBenchmark(const char* name, Function function) {
+    Entry entry = { name, function };
+    registry().push_back(entry);
+    return true;
+}
+
+struct Result {
+    double seconds;     // 墙钟时间
+    double cpuSeconds;  // 进程CPU时间
+    uint64_t items;
+};
+
+static Result runOnce(Function function, uint64_t iterations) {
+    State state(iterations);
+    std::clock_t cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+    function(state);
+    auto end = std::chrono::steady_clock::now();
+    std::clock_t cpuEnd = std::clock();
+
+    Result result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.cpuSeconds = (double)(cpuEnd - cpuStart) / CLOCKS_PER_SEC;
+    result.items = state.itemsProcessedCount();
+    return result;
+}
+
+// 参数：--benchmark_filter=<子串>  --benchmark_min_time=<秒>
+int runAll(int argc, char** argv) {
+    const char* filter = NULL;
+    double minTime = 0.5;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--benchmark_filter=", 19) == 0) {
+            filter = argv[i] + 19;
+        } else if (strncmp(argv[i], "--benchmark_min_time=", 21) == 0) {
+            minTime = atof(argv[i] + 21);
+        } else {
+            fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    printf("%-40s %14s %14s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+    printf("--------------------------------------------------------------------------------------\n");
+
+    for (size_t i = 0; i < registry().size(); i++) {
+        const Entry& entry = registry()[i];
+        if (filter && !strstr(entry.name, filter)) continue;
+
+        uint64_t iterations = 1;
+        Result result = runOnce(entry.function, iterations);
+
+        // 加倍迭代次数直到超过最短时间（按已测速度预估，最多放大10倍）
+        while (result.seconds < minTime && iterations < (1ULL << 40)) {
+            double scale = result.seconds > 0 ? minTime * 1.4 / result.seconds : 10.0;
+            if (scale > 10.0) scale = 10.0;
+            if (scale < 2.0) scale = 2.0;
+            iterations = (uint64_t)(iterations * scale);
+            result = runOnce(entry.function, iterations);
+        }
+
+        printf("%-40s %11.2f ns %11.2f ns %12llu", entry.name,
+               result.seconds * 1e9 / iterations,
+               result.cpuSeconds * 1e9 / iterations,
+               (unsigned long long)iterations);
+        if (result.items) {
+            printf(" items_per_second=%.3gM/s", result.items / result.seconds / 1e6);
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
+
+}  // namespace bench
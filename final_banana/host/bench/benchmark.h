@@ -0,0 +1,81 @@
+/*
+ * Benchmark - 最小基准测试框架（接口仿照Google Benchmark）
+ *
+ *   static void BM_Something(bench::State& state) {
+ *       for (auto _ : state) {
+ *           bench::DoNotOptimize(something());
+ *       }
+ *   }
+ *   BENCHMARK(BM_Something);
+ *
+ * 每个基准自动加倍迭代次数，直到运行时间超过--min_time（默认0.5秒），
+ * 按Google Benchmark的表格格式输出每次迭代的耗时。
+ */
+
+#ifndef HOST_BENCHMARK_H
+#define HOST_BENCHMARK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace bench {
+
+class State {
+public:
+    explicit State(uint64_t iterations) : remaining(iterations), total(iterations) {}
+
+    // 支持 for (auto _ : state) 写法
+    struct Value {};
+    class Iterator {
+    public:
+        explicit Iterator(uint64_t* remaining) : remaining(remaining) {}
+        Value operator*() const { return Value(); }
+        Iterator& operator++() { --*remaining; return *this; }
+        bool operator!=(const Iterator&) const { return *remaining != 0; }
+
+    private:
+        uint64_t* remaining;
+    };
+
+    Iterator begin() { return Iterator(&remaining); }
+    Iterator end() { return Iterator(&remaining); }
+
+    bool KeepRunning() { return remaining-- != 0; }
+    uint64_t iterations() const { return total; }
+
+    void SetItemsProcessed(uint64_t items) { itemsProcessed = items; }
+    uint64_t itemsProcessedCount() const { return itemsProcessed; }
+
+private:
+    uint64_t remaining;
+    uint64_t total;
+    uint64_t itemsProcessed = 0;
+};
+
+typedef void (*Function)(State& state);
+
+bool registerBenchmark(const char* name, Function function);
+int runAll(int argc, char** argv);
+
+// 阻止编译器把被测结果优化掉
+template<class T>
+inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void ClobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+}  // namespace bench
+
+#define BENCHMARK_CONCAT2(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT2(a, b)
+#define BENCHMARK(function) \
+    static bool BENCHMARK_CONCAT(benchmarkRegistered_, __LINE__) = \
+        bench::registerBenchmark(#function, function)
+
+#define BENCHMARK_MAIN() \
+    int main(int argc, char** argv) { return bench::runAll(argc, argv); }
+
+#endif
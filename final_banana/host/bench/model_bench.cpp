@@ -0,0 +1,164 @@
+/*
+ * Model Benchmarks - 新鲜度模型和上传编码的主机基准
+ *
+ * 输入取自一张固定网格（温度/湿度/气体），循环使用，
+ * 避免编译器把常量输入折叠掉。
+ */
+
+#include "benchmark.h"
+#include "host_shim.h"
+
+#include "freshness_model.h"
+#include "lora_payload.h"
+#include "trend_estimator.h"
+
+#define INPUT_COUNT 64
+
+struct ModelInput {
+    int16_t temperatureX10;
+    uint16_t humidityX10;
+    int gasDelta;
+    float temperature;
+    float humidity;
+};
+
+static ModelInput inputs[INPUT_COUNT];
+
+// 覆盖冷藏到常温、干燥到潮湿、气体正负变化
+static bool buildInputs() {
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        ModelInput& in = inputs[i];
+        in.temperatureX10 = -50 + (i * 37) % 400;
+        in.humidityX10 = 300 + (i * 53) % 680;
+        in.gasDelta = -20 + (i * 29) % 180;
+        in.temperature = in.temperatureX10 / 10.0f;
+        in.humidity = in.humidityX10 / 10.0f;
+    }
+    hostSetSerialEnabled(false);
+    return true;
+}
+
+static const bool inputsReady = buildInputs();
+
+static void BM_CalculateScoreFloat(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_BANANA);
+    int i = 0;
+    for (auto _ : state) {
+        const ModelInput& in = inputs[i++ & (INPUT_COUNT - 1)];
+        bench::DoNotOptimize(model.calculateScore(in.temperature, in.humidity, in.gasDelta, 12.5f));
+    }
+}
+BENCHMARK(BM_CalculateScoreFloat);
+
+static void BM_CalculateScoreFixed(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_BANANA);
+    int i = 0;
+    for (auto _ : state) {
+        const ModelInput& in = inputs[i++ & (INPUT_COUNT - 1)];
+        bench::DoNotOptimize(model.calculateScoreFixed(in.temperatureX10, in.humidityX10,
+                                                       in.gasDelta, 45000));
+    }
+}
+BENCHMARK(BM_CalculateScoreFixed);
+
+static void BM_CalculateScoreSurface(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_BANANA);
+    int i = 0;
+    for (auto _ : state) {
+        const ModelInput& in = inputs[i++ & (INPUT_COUNT - 1)];
+        bench::DoNotOptimize(model.calculateScoreSurface(in.temperatureX10, in.humidityX10,
+                                                         in.gasDelta, 45000));
+    }
+}
+BENCHMARK(BM_CalculateScoreSurface);
+
+static void BM_StorageScoreFloat(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_ORANGE);
+    int i = 0;
+    for (auto _ : state) {
+        const ModelInput& in = inputs[i++ & (INPUT_COUNT - 1)];
+        bench::DoNotOptimize(model.calculateStorageScore(in.temperature, in.humidity));
+    }
+}
+BENCHMARK(BM_StorageScoreFloat);
+
+static void BM_StorageScoreFixed(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_ORANGE);
+    int i = 0;
+    for (auto _ : state) {
+        const ModelInput& in = inputs[i++ & (INPUT_COUNT - 1)];
+        bench::DoNotOptimize(model.calculateStorageScoreFixed(in.temperatureX10, in.humidityX10));
+    }
+}
+BENCHMARK(BM_StorageScoreFixed);
+
+// 每次换一组读数再取剩余天数（updateReadingsFixed是设备上的实际路径）
+static void BM_UpdateAndRemainingDays(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_BANANA);
+    int i = 0;
+    for (auto _ : state) {
+        const ModelInput& in = inputs[i++ & (INPUT_COUNT - 1)];
+        model.updateReadingsFixed(in.temperatureX10, in.humidityX10, in.gasDelta);
+        bench::DoNotOptimize(model.getRemainingDays());
+    }
+}
+BENCHMARK(BM_UpdateAndRemainingDays);
+
+static void BM_RemainingDays(bench::State& state) {
+    FreshnessModel model;
+    model.setFruitType(FRUIT_APPLE);
+    model.updateReadingsFixed(30, 920, 5);
+    for (auto _ : state) {
+        bench::DoNotOptimize(model.getRemainingDays());
+        bench::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RemainingDays);
+
+// 每条采样一次卡尔曼更新 + 外推（设备上每2秒一次）
+static void BM_TrendUpdateAndProject(bench::State& state) {
+    TrendEstimator trend;
+    unsigned long time = 0;
+    int i = 0;
+    for (auto _ : state) {
+        time += 2000;
+        float score = 90.0f - time / 6000000.0f + (inputs[i++ & (INPUT_COUNT - 1)].gasDelta & 3) * 0.1f;
+        trend.update(time, score);
+        bench::DoNotOptimize(trend.project());
+    }
+}
+BENCHMARK(BM_TrendUpdateAndProject);
+
+static void BM_PackPayload(bench::State& state) {
+    Snapshot snapshots[INPUT_COUNT];
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        Snapshot& s = snapshots[i];
+        memset(&s, 0, sizeof(s));
+        s.data.temperature = inputs[i].temperature;
+        s.data.humidity = inputs[i].humidity;
+        s.data.gasRaw = 300 + inputs[i].gasDelta;
+        s.data.gasDelta = inputs[i].gasDelta;
+        s.data.valid = true;
+        s.fruit = (FruitType)(i & 1);
+        s.score = 40.0f + i;
+        s.remainDays = i % 15 - 1;
+        s.stage = (FreshnessStage)(i & 3);
+        s.timestamp = i * 3600000UL;
+    }
+
+    uint8_t payload[LORA_PAYLOAD_SIZE];
+    int i = 0;
+    for (auto _ : state) {
+        bench::DoNotOptimize(LoRaPayload::pack(snapshots[i++ & (INPUT_COUNT - 1)], payload));
+        bench::ClobberMemory();
+    }
+}
+BENCHMARK(BM_PackPayload);
+
+BENCHMARK_MAIN();
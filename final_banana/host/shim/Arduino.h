@@ -0,0 +1,119 @@
+/*
+ * Arduino.h - 主机构建用的最小Arduino环境
+ *
+ * 只提供固件核心（传感器、模型、编码）用到的接口。
+ * millis()/micros()/analogRead()的返回值由host_shim.h里的函数注入。
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+#include <string>
+
+#define HIGH 1
+#define LOW  0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE  2
+#define FALLING 3
+#define RISING  4
+
+#define A0 15
+#define A1 16
+#define A2 17
+
+#define PROGMEM
+#define F(str) (str)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// 和Arduino一样，abs/min/max对任何数值类型都可用
+template<class T> inline T abs(T x) { return x > 0 ? x : -x; }
+using std::min;
+using std::max;
+using std::isnan;
+using std::lround;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+void noInterrupts();
+void interrupts();
+
+// String：只需要能从C字符串构造并打印
+class String {
+public:
+    String(const char* str = "") : value(str ? str : "") {}
+    String(int number) : value(std::to_string(number)) {}
+    const char* c_str() const { return value.c_str(); }
+    size_t length() const { return value.length(); }
+
+private:
+    std::string value;
+};
+
+// Print：和Arduino一样，所有print()都落到write()上，由子类决定写到哪里
+class Print {
+public:
+    virtual ~Print() {}
+
+    size_t print(const char* str);
+    size_t print(const String& str);
+    size_t print(char c);
+    size_t print(int number, int base = 10);
+    size_t print(unsigned int number, int base = 10);
+    size_t print(long number, int base = 10);
+    size_t print(unsigned long number, int base = 10);
+    size_t print(double number, int digits = 2);
+
+    size_t println();
+    template<class T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    template<class T> size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+};
+
+// Stream：可读的Print（测试里用假的模块串口替换）
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+};
+
+// 串口：输出到stdout，没有输入
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    operator bool() { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,23 @@
+/*
+ * DHT.h - 主机构建用的DHT库替身
+ *
+ * 读数由hostSetDHT()注入。
+ */
+
+#ifndef HOST_DHT_H
+#define HOST_DHT_H
+
+#include <Arduino.h>
+
+#define DHT11 11
+#define DHT22 22
+
+class DHT {
+public:
+    DHT(uint8_t pin, uint8_t type) { (void)pin; (void)type; }
+    void begin() {}
+    float readTemperature();
+    float readHumidity();
+};
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ * Arduino Shim Implementation
+ */
+
+#include "host_shim.h"
+#include <DHT.h>
+
+#define HOST_ANALOG_PINS 32
+
+static unsigned long hostMillis = 0;
+static int analogValues[HOST_ANALOG_PINS];
+static HostAnalogSource analogSource = NULL;
+static float dhtTemperature = 20.0f;
+static float dhtHumidity = 50.0f;
+static bool serialEnabled = true;
+
+HardwareSerial Serial;
+
+// ==================== 注入接口 ====================
+void hostSetMillis(unsigned long ms) {
+    hostMillis = ms;
+}
+
+void hostAdvanceMillis(unsigned long ms) {
+    hostMillis += ms;
+}
+
+void hostSetAnalog(uint8_t pin, int value) {
+    if (pin < HOST_ANALOG_PINS) analogValues[pin] = value;
+}
+
+void hostSetAnalogSource(HostAnalogSource source) {
+    analogSource = source;
+}
+
+void hostSetDHT(float temperature, float humidity) {
+    dhtTemperature = temperature;
+    dhtHumidity = humidity;
+}
+
+void hostSetSerialEnabled(bool enabled) {
+    serialEnabled = enabled;
+}
+
+// ==================== Arduino接口 ====================
+unsigned long millis() {
+    return hostMillis;
+}
+
+unsigned long micros() {
+    return hostMillis * 1000;
+}
+
+void delay(unsigned long ms) {
+    hostMillis += ms;
+}
+
+void delayMicroseconds(unsigned int us) {
+    (void)us;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    (void)pin;
+    (void)value;
+}
+
+int digitalRead(uint8_t pin) {
+    (void)pin;
+    return HIGH;
+}
+
+int analogRead(uint8_t pin) {
+    if (analogSource) return analogSource(pin);
+    return pin < HOST_ANALOG_PINS ? analogValues[pin] : 0;
+}
+
+void noInterrupts() {}
+void interrupts() {}
+
+float DHT::readTemperature() {
+    return dhtTemperature;
+}
+
+float DHT::readHumidity() {
+    return dhtHumidity;
+}
+
+// ==================== 串口 ====================
+static size_t emit(Print& out, const char* str) {
+    return out.write((const uint8_t*)str, strlen(str));
+}
+
+static size_t emitNumber(Print& out, unsigned long number, int base) {
+    char buffer[40];
+    char* p = &buffer[sizeof(buffer) - 1];
+    *p = '\0';
+
+    if (base < 2) base = 10;
+    do {
+        int digit = number % base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        number /= base;
+    } while (number);
+
+    return emit(out, p);
+}
+
+size_t Print::print(const char* str) {
+    return emit(*this, str);
+}
+
+size_t Print::print(const String& str) {
+    return emit(*this, str.c_str());
+}
+
+size_t Print::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t Print::print(int number, int base) {
+    return print((long)number, base);
+}
+
+size_t Print::print(unsigned int number, int base) {
+    return print((unsigned long)number, base);
+}
+
+size_t Print::print(long number, int base) {
+    if (number < 0 && base == 10) {
+        return emit(*this, "-") + emitNumber(*this, -(unsigned long)number, base);
+    }
+    return emitNumber(*this, (unsigned long)number, base);
+}
+
+size_t Print::print(unsigned long number, int base) {
+    return emitNumber(*this, number, base);
+}
+
+size_t Print::print(double number, int digits) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, number);
+    return emit(*this, buffer);
+}
+
+size_t Print::println() {
+    return emit(*this, "\r\n");
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    if (serialEnabled) fwrite(buffer, 1, size, stdout);
+    return size;
+}
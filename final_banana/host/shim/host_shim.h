@@ -0,0 +1,27 @@
+/*
+ * Host Shim - 主机构建的注入接口
+ *
+ * 测试/基准程序用这些函数控制时间和传感器读数。
+ */
+
+#ifndef HOST_SHIM_H
+#define HOST_SHIM_H
+
+#include <Arduino.h>
+
+// 时间：默认从0开始，只在调用时前进
+void hostSetMillis(unsigned long ms);
+void hostAdvanceMillis(unsigned long ms);
+
+// 模拟输入：每个引脚一个固定值，或者一个回调
+typedef int (*HostAnalogSource)(uint8_t pin);
+void hostSetAnalog(uint8_t pin, int value);
+void hostSetAnalogSource(HostAnalogSource source);
+
+// DHT22读数（NAN表示读取失败）
+void hostSetDHT(float temperature, float humidity);
+
+// 串口输出开关（基准测试时关掉）
+void hostSetSerialEnabled(bool enabled);
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * Model Compare - 定点模型与浮点模型的网格对比
+ *
+ * 对每种水果扫描 温度×湿度×气体×存放时间 网格，比较：
+ *   评分：定点(0.01分) 必须等于 round(浮点×100)
+ *   阶段：两种构建的getStage()相同（都按0.01分的评分分档）
+ *   存储评分：定点必须等于浮点
+ *   全部水果一次计算（updateReadingsFixed）：时钟按采样周期前进，中途切换显示的
+ *     水果；每种水果都等于按同样的读数单独积分存放时间、再用calculateScoreFixed()
+ *     算出的评分，显示水果的剩余天数也相同
+ *   评分面查表（calculateScoreSurface）：每0.1°C、0.1%都等于calculateScoreFixed()，
+ *     另外报告它和浮点模型的最大偏差
+ * 不满足时返回1。
+ *
+ * 用法：model_compare [--verbose]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_shim.h"
+#include "freshness_model.h"
+#include "monitor_config.h"
+
+int main(int argc, char** argv) {
+    bool verbose = (argc > 1 && strcmp(argv[1], "--verbose") == 0);
+    hostSetSerialEnabled(false);
+
+    FreshnessModel model;
+    long points = 0;
+    long scoreMismatch = 0;
+    long stageMismatch = 0;
+    long storagePoints = 0;
+    long storageMismatch = 0;
+
+    for (int f = 0; f < 4; f++) {
+        model.setFruitType((FruitType)f);
+
+        // 评分：-10..40°C，20..100%，气体-20..200，0..111小时
+        for (int t = -100; t <= 400; t += 3) {
+            for (int h = 200; h <= 1000; h += 7) {
+                for (int g = -20; g <= 200; g += 11) {
+                    for (uint32_t age = 0; age < 400000; age += 37000) {
+                        float score = model.calculateScore(t / 10.0f, h / 10.0f, g, age / 3600.0f);
+                        long expected = lroundf(score * 100);
+                        long fixed = model.calculateScoreFixed(t, h, g, age);
+                        points++;
+
+                        if (expected != fixed) {
+                            scoreMismatch++;
+                            if (verbose) {
+                                printf("score  fruit=%d t=%d h=%d gas=%d age=%u float=%ld fixed=%ld\n",
+                                       f, t, h, g, age, expected, fixed);
+                            }
+                        }
+
+                        // 和updateReadings()一样把浮点评分换成0.01分再分档
+                        FreshnessStage floatStage = FreshnessModel::stageForScore((int32_t)(score * 100 + 0.5f));
+                        FreshnessStage fixedStage = FreshnessModel::stageForScore(fixed);
+                        if (floatStage != fixedStage) {
+                            stageMismatch++;
+                            if (verbose) {
+                                printf("stage  fruit=%d t=%d h=%d gas=%d age=%u float=%d fixed=%d\n",
+                                       f, t, h, g, age, floatStage, fixedStage);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // 存储评分：每0.1°C、0.1%
+        for (int t = -100; t <= 400; t++) {
+            for (int h = 200; h <= 1000; h++) {
+                int floatScore = model.calculateStorageScore(t / 10.0f, h / 10.0f);
+                int fixedScore = model.calculateStorageScoreFixed(t, h);
+                storagePoints++;
+
+                if (floatScore != fixedScore) {
+                    storageMismatch++;
+                    if (verbose) {
+                        printf("storage fruit=%d t=%d h=%d float=%d fixed=%d\n",
+                               f, t, h, floatScore, fixedScore);
+                    }
+                }
+            }
+        }
+    }
+
+    // 全部水果一次计算：每次采样时钟前进一个采样周期，每种水果的存放时间
+    // 用一个单独的积分器按同样的读数积分，再按单一水果的系数算评分
+    SimulatedClock clock;
+    FreshnessModel allModel(clock);
+    FreshnessModel single(clock);
+    ShelfLifeIntegrator reference;
+    for (int f = 0; f < FRUIT_COUNT; f++) reference.reset((FruitType)f, clock.now());
+
+    long allSamples = 0;
+    long allPoints = 0;
+    long allMismatch = 0;
+    long allNonZero = 0;
+    long viewMismatch = 0;
+    uint32_t maxAge = 0;
+    const long switchAt = 31000;    // 大约一半的采样之后切换显示的水果
+
+    for (int t = -100; t <= 400; t += 7) {
+        for (int h = 200; h <= 1000; h += 13) {
+            for (int g = -20; g <= 200; g += 17) {
+                clock.advance(DISPLAY_UPDATE_INTERVAL);
+                if (allSamples++ == switchAt) allModel.setFruitType(FRUIT_APPLE);
+
+                allModel.updateReadingsFixed(t, h, g);
+                for (int f = 0; f < FRUIT_COUNT; f++) {
+                    FruitType fruit = (FruitType)f;
+                    single.setFruitType(fruit);
+                    int32_t condition = single.calculateScoreFixed(t, h, g, 0);
+                    reference.update(fruit, t, h, condition, clock.now());
+
+                    uint32_t age = reference.getEquivalentAgeSeconds(fruit);
+                    if (age > maxAge) maxAge = age;
+                    long expected = single.calculateScoreFixed(t, h, g, age);
+                    long actual = allModel.getScoreCenti(fruit);
+                    allPoints++;
+                    if (expected != 0) allNonZero++;
+                    if (expected != actual) {
+                        allMismatch++;
+                        if (verbose) {
+                            printf("all    fruit=%d t=%d h=%d gas=%d age=%u single=%ld all=%ld\n",
+                                   f, t, h, g, age, expected, actual);
+                        }
+                    }
+                }
+
+                // 显示的水果：评分和剩余天数来自同一份状态
+                FruitType viewed = allModel.getFruitType();
+                int32_t viewedScore = allModel.getScoreCenti(viewed);
+                int daysX10 = reference.getRemainingDaysX10(viewed);
+                int expectedDays = (viewedScore <= 0 || daysX10 < 0) ? -1 : daysX10 / 10;
+                if (allModel.getScoreCenti() != viewedScore || allModel.getRemainingDays() != expectedDays) {
+                    viewMismatch++;
+                }
+            }
+        }
+    }
+
+    // 评分面：网格内外每0.1°C、0.1%，和定点公式、浮点模型比较
+    static const int surfaceGases[] = { -5, 0, 37 };
+    static const uint32_t surfaceAges[] = { 0, 90000 };
+    long surfacePoints = 0;
+    long surfaceMismatch = 0;
+    long surfaceFloatDiff = 0;
+    long surfaceFloatMax = 0;
+
+    for (int f = 0; f < FRUIT_COUNT; f++) {
+        model.setFruitType((FruitType)f);
+        for (int t = -150; t <= 550; t++) {
+            for (int h = 0; h <= 1000; h++) {
+                for (int g = 0; g < 3; g++) {
+                    for (int a = 0; a < 2; a++) {
+                        int gas = surfaceGases[g];
+                        uint32_t age = surfaceAges[a];
+                        long surface = model.calculateScoreSurface(t, h, gas, age);
+                        long fixed = model.calculateScoreFixed(t, h, gas, age);
+                        long analytic = lroundf(model.calculateScore(t / 10.0f, h / 10.0f, gas,
+                                                                     age / 3600.0f) * 100);
+                        surfacePoints++;
+
+                        if (surface != fixed) {
+                            surfaceMismatch++;
+                            if (verbose) {
+                                printf("surface fruit=%d t=%d h=%d gas=%d age=%u fixed=%ld surface=%ld\n",
+                                       f, t, h, gas, age, fixed, surface);
+                            }
+                        }
+                        long diff = labs(surface - analytic);
+                        if (diff != 0) surfaceFloatDiff++;
+                        if (diff > surfaceFloatMax) surfaceFloatMax = diff;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("score:   %ld points, %ld mismatches, %ld stage mismatches\n",
+           points, scoreMismatch, stageMismatch);
+    printf("storage: %ld points, %ld mismatches\n", storagePoints, storageMismatch);
+
+    printf("all:     %ld points (%ld non-zero, age up to %.1f h), %ld mismatches against "
+           "single-profile scoring, %ld viewed-fruit mismatches\n",
+           allPoints, allNonZero, maxAge / 3600.0, allMismatch, viewMismatch);
+
+    printf("surface: %ld points, %ld mismatches against fixed point, "
+           "%ld differ from float (max %ld.%02ld points)\n",
+           surfacePoints, surfaceMismatch, surfaceFloatDiff, surfaceFloatMax / 100, surfaceFloatMax % 100);
+
+    bool pass = (scoreMismatch == 0 && stageMismatch == 0 && storageMismatch == 0 && allMismatch == 0 && viewMismatch == 0 &&
+                 surfaceMismatch == 0);
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
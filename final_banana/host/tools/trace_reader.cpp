@@ -0,0 +1,222 @@
+/*
+ * Trace Reader Implementation
+ */
+
+#include "trace_reader.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "monitor_config.h"
+
+#define BOX_HAVE_TEMP      0x01
+#define BOX_HAVE_HUMIDITY  0x02
+#define BOX_HAVE_GAS       0x04
+#define BOX_HAVE_BASELINE  0x08
+#define BOX_COMPLETE       0x0F
+
+TraceReader::TraceReader() {
+    file = NULL;
+    close();
+}
+
+TraceReader::~TraceReader() {
+    close();
+}
+
+bool TraceReader::open(const char* path) {
+    close();
+    file = fopen(path, "r");
+    return file != NULL;
+}
+
+void TraceReader::close() {
+    if (file) fclose(file);
+    file = NULL;
+    lineNumber = 0;
+    for (int i = 0; i < TRACE_SOURCE_COUNT; i++) records[i] = 0;
+    skippedBoxes = 0;
+    inBox = false;
+    boxIsTest = false;
+    boxFields = 0;
+    boxClock = -1;
+    lastTimestamp = 0;
+    haveTimestamp = false;
+    lastClock = -1;
+    clockOffset = 0;
+}
+
+const char* TraceReader::sourceName(TraceSource source) {
+    switch (source) {
+        case TRACE_COMPACT:     return "compact";
+        case TRACE_MONITOR_BOX: return "monitor box";
+        default:                return "age_h line";
+    }
+}
+
+// 串口监视器时间戳 "HH:MM:SS.mmm -> "，返回当天毫秒数，没有返回-1
+static long parseSerialClock(const char* text, const char** rest) {
+    int h, m, s, ms, n = 0;
+    if (sscanf(text, "%d:%d:%d.%d -> %n", &h, &m, &s, &ms, &n) == 4 && n > 0) {
+        *rest = text + n;
+        return ((h * 60L + m) * 60 + s) * 1000 + ms;
+    }
+    *rest = text;
+    return -1;
+}
+
+// 串口时间只有时分秒，跨过午夜时补一天
+unsigned long TraceReader::timestampFromClock(long clock) {
+    if (lastClock >= 0 && clock < lastClock) {
+        clockOffset += 86400000UL;
+    }
+    lastClock = clock;
+    return clockOffset + clock;
+}
+
+unsigned long TraceReader::nextSyntheticTimestamp() {
+    return haveTimestamp ? lastTimestamp + DISPLAY_UPDATE_INTERVAL : 0;
+}
+
+void TraceReader::finish(TraceRecord& record, TraceSource source, unsigned long timestamp) {
+    record.sample.timestamp = timestamp;
+    record.source = source;
+    record.line = lineNumber;
+    lastTimestamp = timestamp;
+    haveTimestamp = true;
+    records[source]++;
+}
+
+bool TraceReader::parseCompact(const char* text, TraceRecord& record) {
+    if (!TraceFormat::parse(text, record.sample)) return false;
+    finish(record, TRACE_COMPACT, record.sample.timestamp);
+    return true;
+}
+
+// age_h=1.23, T=25.30C, H=48.70%, gasRaw=312, gasDelta=12 (...)
+bool TraceReader::parseAgeLine(const char* text, TraceRecord& record) {
+    const char* start = strstr(text, "age_h=");
+    if (!start) return false;
+
+    float ageHours, temperature, humidity;
+    int gasRaw, gasDelta;
+    if (sscanf(start, "age_h=%f, T=%fC, H=%f%%, gasRaw=%d, gasDelta=%d",
+               &ageHours, &temperature, &humidity, &gasRaw, &gasDelta) != 5) {
+        return false;
+    }
+    if (isnan(temperature) || isnan(humidity)) return false;
+
+    TraceSample& s = record.sample;
+    s.fruit = FRUIT_BANANA;     // 003程序只测香蕉
+    s.temperatureX10 = (int16_t)lroundf(temperature * 10);
+    s.humidityX10 = (uint16_t)lroundf(humidity * 10);
+    s.gasRaw = gasRaw;
+    s.gasMin = gasRaw;
+    s.gasMax = gasRaw;
+    s.gasBaseline = gasRaw - gasDelta;
+
+    finish(record, TRACE_AGE_LINE, (unsigned long)lroundf(ageHours * 3600000.0f));
+    return true;
+}
+
+static bool findFruit(const char* text, FruitType& fruit) {
+    static const char* names[] = { "Banana", "Orange", "Apple", "Grape" };
+    for (int i = 0; i < 4; i++) {
+        if (strstr(text, names[i])) {
+            fruit = (FruitType)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 标签后面的第一个数
+static bool valueAfter(const char* text, const char* label, float& value) {
+    const char* p = strstr(text, label);
+    if (!p) return false;
+    return sscanf(p + strlen(label), " %f", &value) == 1;
+}
+
+bool TraceReader::parseBoxLine(const char* text, long clock, TraceRecord& record) {
+    if (strstr(text, "Env Monitor:") || strstr(text, "FRUIT TEST:")) {
+        inBox = true;
+        boxIsTest = (strstr(text, "FRUIT TEST:") != NULL);
+        boxFields = 0;
+        boxClock = clock;
+        box.fruit = FRUIT_BANANA;
+        findFruit(text, box.fruit);
+        return false;
+    }
+
+    if (!inBox) return false;
+
+    float value;
+    if (valueAfter(text, "Temp:", value)) {
+        box.temperatureX10 = (int16_t)lroundf(value * 10);
+        boxFields |= BOX_HAVE_TEMP;
+    } else if (valueAfter(text, "Humidity:", value)) {
+        box.humidityX10 = (uint16_t)lroundf(value * 10);
+        boxFields |= BOX_HAVE_HUMIDITY;
+    } else if (valueAfter(text, "Gas Raw:", value)) {
+        box.gasRaw = (int)value;
+        box.gasMin = box.gasRaw;
+        box.gasMax = box.gasRaw;
+
+        // 过采样版本："312 ADC (309-315)"
+        const char* range = strchr(text, '(');
+        int lo, hi;
+        if (range && sscanf(range, "(%d-%d)", &lo, &hi) == 2) {
+            box.gasMin = lo;
+            box.gasMax = hi;
+        }
+        boxFields |= BOX_HAVE_GAS;
+    } else if (valueAfter(text, "Gas Base:", value)) {
+        box.gasBaseline = (int)value;
+        boxFields |= BOX_HAVE_BASELINE;
+    }
+
+    // 框结束（监测框└，测试框╚）
+    if (strstr(text, "└") || strstr(text, "╚")) {
+        inBox = false;
+
+        // 测试框没有原始气体值和基准，无法回放
+        if (boxIsTest || boxFields != BOX_COMPLETE) {
+            skippedBoxes++;
+            return false;
+        }
+
+        record.sample = box;
+        unsigned long timestamp = boxClock >= 0 ? timestampFromClock(boxClock)
+                                                : nextSyntheticTimestamp();
+        finish(record, TRACE_MONITOR_BOX, timestamp);
+        return true;
+    }
+
+    return false;
+}
+
+// 读到下一条记录，文件结束返回false
+bool TraceReader::next(TraceRecord& record) {
+    if (!file) return false;
+
+    char buffer[512];
+    while (fgets(buffer, sizeof(buffer), file)) {
+        lineNumber++;
+
+        const char* text;
+        long clock = parseSerialClock(buffer, &text);
+
+        if (strstr(text, TRACE_PREFIX)) {
+            if (parseCompact(text, record)) return true;
+            continue;
+        }
+        if (strstr(text, "age_h=")) {
+            if (parseAgeLine(text, record)) return true;
+            continue;
+        }
+        if (parseBoxLine(text, clock, record)) return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,74 @@
+/*
+ * Trace Reader - 读取串口日志里的采样记录
+ *
+ * 支持三种格式，可以混在同一个文件里：
+ *   1. 紧凑记录  $FM,...（trace_format.h，串口'c'打开）
+ *   2. 监测数据框  printMonitoringData()的输出（没有时间时按2秒一条补上）
+ *   3. 旧版003程序的  age_h=..., T=...C, H=...%, gasRaw=..., gasDelta=...
+ * 行首的串口监视器时间戳（"12:34:56.789 -> "）会被识别并用作时间。
+ */
+
+#ifndef TRACE_READER_H
+#define TRACE_READER_H
+
+#include <stdio.h>
+#include "trace_format.h"
+
+enum TraceSource {
+    TRACE_COMPACT = 0,
+    TRACE_MONITOR_BOX = 1,
+    TRACE_AGE_LINE = 2
+};
+
+#define TRACE_SOURCE_COUNT 3
+
+struct TraceRecord {
+    TraceSample sample;
+    TraceSource source;
+    long line;                  // 记录结束所在行
+};
+
+// 流式读取，几个月的日志也不用整个读进内存
+class TraceReader {
+public:
+    TraceReader();
+    ~TraceReader();
+
+    bool open(const char* path);
+    void close();
+    bool next(TraceRecord& record);
+
+    long getLines() const { return lineNumber; }
+    long getRecords(TraceSource source) const { return records[source]; }
+    long getSkippedBoxes() const { return skippedBoxes; }
+
+    static const char* sourceName(TraceSource source);
+
+private:
+    FILE* file;
+    long lineNumber;
+    long records[TRACE_SOURCE_COUNT];
+    long skippedBoxes;
+
+    // 监测数据框的解析状态
+    bool inBox;
+    bool boxIsTest;
+    int boxFields;
+    TraceSample box;
+    long boxClock;              // 框开始行的串口时间 (ms)，没有时为-1
+
+    // 没有时间的记录按采样周期补时间
+    unsigned long lastTimestamp;
+    bool haveTimestamp;
+    long lastClock;
+    unsigned long clockOffset;
+
+    bool parseCompact(const char* text, TraceRecord& record);
+    bool parseAgeLine(const char* text, TraceRecord& record);
+    bool parseBoxLine(const char* text, long clock, TraceRecord& record);
+    unsigned long timestampFromClock(long clock);
+    unsigned long nextSyntheticTimestamp();
+    void finish(TraceRecord& record, TraceSource source, unsigned long timestamp);
+};
+
+#endif
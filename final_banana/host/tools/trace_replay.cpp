@@ -0,0 +1,202 @@
+/*
+ * Trace Replay - 把记录的串口日志回放进固件模型
+ *
+ * 每条采样都走真实的 Sensors -> AcquisitionPipeline -> FreshnessModel，
+ * 再用DecisionRules做水果测试和环境判断，时钟直接跳到记录的时间。
+ * 设备重启（时间倒退）时按新的一段处理，模型重新开始计时。
+ *
+ * 输出每条采样一行CSV，最后打印汇总（--summary只打印汇总）。
+ *
+ * 用法：trace_replay [--summary] [--fruit N] <日志文件>...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "host_shim.h"
+#include "sensors.h"
+#include "freshness_model.h"
+#include "acquisition.h"
+#include "decision_rules.h"
+#include "monitor_config.h"
+#include "trace_reader.h"
+
+static int currentGas = 0;
+
+static int gasSource(uint8_t pin) {
+    (void)pin;
+    return currentGas;
+}
+
+static const char* stageName(FreshnessStage stage) {
+    switch (stage) {
+        case STAGE_VERY_FRESH: return "VERY_FRESH";
+        case STAGE_GOOD:       return "GOOD";
+        case STAGE_EAT_TODAY:  return "EAT_TODAY";
+        default:               return "SPOILED";
+    }
+}
+
+// 没有预测时输出-1
+static int spoilColumn(uint16_t hours) {
+    return hours == TREND_NO_PROJECTION ? -1 : hours;
+}
+
+int main(int argc, char** argv) {
+    bool summaryOnly = false;
+    int fruitOverride = -1;
+    int firstFile = argc;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--summary") == 0) {
+            summaryOnly = true;
+        } else if (strcmp(argv[i], "--fruit") == 0 && i + 1 < argc) {
+            fruitOverride = atoi(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return 1;
+        } else {
+            firstFile = i;
+            break;
+        }
+    }
+
+    if (firstFile >= argc) {
+        fprintf(stderr, "usage: trace_replay [--summary] [--fruit N] <log>...\n");
+        return 1;
+    }
+    if (fruitOverride > FRUIT_GRAPE) {
+        fprintf(stderr, "fruit must be 0-3\n");
+        return 1;
+    }
+
+    hostSetSerialEnabled(false);
+    hostSetAnalogSource(gasSource);
+
+    SimulatedClock clock;
+    Sensors sensors;
+    FreshnessModel model(clock);
+    AcquisitionPipeline pipeline(sensors, model, clock);
+    DecisionRules rules;
+    sensors.begin();
+
+    long samples = 0;
+    long stageCounts[4] = { 0, 0, 0, 0 };
+    long envAlerts = 0;
+    long testSpoiled = 0;
+    long sourceCounts[TRACE_SOURCE_COUNT] = { 0, 0, 0 };
+    long skippedBoxes = 0;
+    long segments = 0;
+    unsigned long simulatedMs = 0;
+
+    if (!summaryOnly) {
+        printf("time_h,source,fruit,temp_c,humidity,gas_delta,score,stage,remain_days,life_used,"
+               "spoil_h,spoil_low_h,spoil_high_h,storage,env_bad,test_spoiled\n");
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    for (int f = firstFile; f < argc; f++) {
+        TraceReader reader;
+        if (!reader.open(argv[f])) {
+            fprintf(stderr, "cannot open %s\n", argv[f]);
+            return 1;
+        }
+
+        // 每个文件、每次设备重启都是新的一段
+        unsigned long segmentStart = 0;
+        unsigned long lastTimestamp = 0;
+        bool inSegment = false;
+        int segmentFruit = -1;
+        bool newSegment = false;
+
+        TraceRecord record;
+        while (reader.next(record)) {
+            TraceSample& s = record.sample;
+            if (fruitOverride >= 0) s.fruit = (FruitType)fruitOverride;
+
+            if (!inSegment || s.timestamp < lastTimestamp) {
+                if (inSegment) simulatedMs += lastTimestamp - segmentStart;
+                // 紧凑记录从开机、003从放入香蕉算起，模型从0开始计时；
+                // 监测数据框的时间是串口监视器的钟点，从第一条开始计时
+                segmentStart = (record.source == TRACE_MONITOR_BOX) ? s.timestamp : 0;
+                segmentFruit = -1;
+                newSegment = true;
+                inSegment = true;
+                segments++;
+            }
+            lastTimestamp = s.timestamp;
+
+            if (s.fruit != segmentFruit) {
+                clock.set(segmentFruit < 0 ? segmentStart : s.timestamp);
+                // 新的一段相当于设备重启，所有水果从头开始；段内切换只是换视图
+                if (newSegment) {
+                    for (int f = 0; f < FRUIT_COUNT; f++) {
+                        model.setFruitType((FruitType)f);
+                        model.startNewFruit();
+                        pipeline.restartTrend();
+                    }
+                }
+                model.setFruitType(s.fruit);
+                newSegment = false;
+                segmentFruit = s.fruit;
+            }
+            clock.set(s.timestamp);
+
+            hostSetDHT(s.temperatureX10 / 10.0f, s.humidityX10 / 10.0f);
+            currentGas = s.gasRaw;
+            if (sensors.getGasBaseline() != s.gasBaseline) {
+                sensors.setGasBaseline(s.gasBaseline);
+            }
+
+            if (!pipeline.acquire()) continue;
+            const Snapshot& snap = pipeline.latest();
+
+            bool envBad = rules.checkEnvironmentSpoilage(snap.data.gasDelta, snap.score);
+            FruitTestDecision test = rules.evaluateFruitTest(snap.fruit, snap.data.gasDelta, snap.score);
+
+            samples++;
+            stageCounts[snap.stage]++;
+            if (envBad) envAlerts++;
+            if (test.spoiled) testSpoiled++;
+
+            if (!summaryOnly) {
+                printf("%.4f,%s,%s,%.1f,%.1f,%d,%.2f,%s,%d,%.3f,%d,%d,%d,%d,%d,%d\n",
+                       s.timestamp / 3600000.0, TraceReader::sourceName(record.source),
+                       FruitDatabase::getTypeName(snap.fruit),
+                       snap.data.temperature, snap.data.humidity, snap.data.gasDelta,
+                       snap.score, stageName(snap.stage), snap.remainDays,
+                       snap.lifeUsedPermille / 1000.0,
+                       spoilColumn(snap.spoil.hours), spoilColumn(snap.spoil.lowHours),
+                       spoilColumn(snap.spoil.highHours),
+                       snap.storageQuality, envBad ? 1 : 0, test.spoiled ? 1 : 0);
+            }
+        }
+
+        if (inSegment) simulatedMs += lastTimestamp - segmentStart;
+        for (int i = 0; i < TRACE_SOURCE_COUNT; i++) {
+            sourceCounts[i] += reader.getRecords((TraceSource)i);
+        }
+        skippedBoxes += reader.getSkippedBoxes();
+    }
+
+    double wallSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - wallStart).count();
+
+    FILE* out = summaryOnly ? stdout : stderr;
+    fprintf(out, "Samples: %ld in %ld segment(s), %.1f h of history\n",
+            samples, segments, simulatedMs / 3600000.0);
+    fprintf(out, "Sources: %ld compact, %ld monitor box, %ld age_h line, %ld boxes skipped\n",
+            sourceCounts[TRACE_COMPACT], sourceCounts[TRACE_MONITOR_BOX],
+            sourceCounts[TRACE_AGE_LINE], skippedBoxes);
+    fprintf(out, "Stages:  %ld very fresh, %ld good, %ld eat today, %ld spoiled\n",
+            stageCounts[0], stageCounts[1], stageCounts[2], stageCounts[3]);
+    fprintf(out, "Alerts:  %ld environment, %ld fruit test spoiled\n", envAlerts, testSpoiled);
+    if (wallSeconds > 0) {
+        fprintf(out, "Replay:  %.3f s, %.0f samples/s\n", wallSeconds, samples / wallSeconds);
+    }
+
+    return 0;
+}
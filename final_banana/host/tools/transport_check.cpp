@@ -0,0 +1,145 @@
+/*
+ * Transport Check - LoRaTransport写给模块串口的字节
+ *
+ * 用一个假的Stream代替Murata模块的串口，逐字节比较：
+ *   AT+PORT=n、AT+UTX n / AT+CTX n 只以CR结尾（和MKRWAN的LORA_NL相同），
+ *     二进制载荷紧跟在CR后面，之后没有多余的字节
+ *   端口不变时不再发AT+PORT
+ *   回应按+OK / +ACK / +NOACK / +ERR推进状态，行尾是CR、LF还是CR LF都行
+ *   AT+PORT被拒绝后下一帧重新设置端口
+ * 不满足时返回1。
+ *
+ * 用法：transport_check [--verbose]
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "host_shim.h"
+#include "lora_transport.h"
+
+// 假的模块串口：记下写出的字节，回应由测试放进去
+class FakeModem : public Stream {
+public:
+    std::string written;
+    std::string input;
+
+    size_t write(uint8_t c) {
+        written += (char)c;
+        return 1;
+    }
+    using Print::write;
+
+    int available() { return (int)input.size(); }
+    int read() {
+        if (input.empty()) return -1;
+        int c = (uint8_t)input[0];
+        input.erase(0, 1);
+        return c;
+    }
+
+    void reply(const char* text) { input += text; }
+    std::string take() {
+        std::string bytes = written;
+        written.clear();
+        return bytes;
+    }
+};
+
+static bool verbose = false;
+static int failures = 0;
+
+static void printBytes(const std::string& bytes) {
+    for (size_t i = 0; i < bytes.size(); i++) {
+        uint8_t c = bytes[i];
+        if (c >= 0x20 && c < 0x7F) putchar(c);
+        else printf("\\x%02X", c);
+    }
+}
+
+static void expectBytes(const char* what, const std::string& actual, const std::string& expected) {
+    bool ok = (actual == expected);
+    if (!ok) failures++;
+    if (!ok || verbose) {
+        printf("%-28s %s  ", what, ok ? "ok  " : "FAIL");
+        printBytes(actual);
+        if (!ok) {
+            printf("  expected ");
+            printBytes(expected);
+        }
+        printf("\n");
+    }
+}
+
+static void expectStatus(const char* what, TransportStatus actual, TransportStatus expected) {
+    bool ok = (actual == expected);
+    if (!ok) failures++;
+    if (!ok || verbose) {
+        printf("%-28s %s  status=%d", what, ok ? "ok  " : "FAIL", actual);
+        if (!ok) printf(" expected=%d", expected);
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    verbose = (argc > 1 && strcmp(argv[1], "--verbose") == 0);
+    hostSetSerialEnabled(false);
+
+    FakeModem modem;
+    LoRaTransport transport(modem);
+
+    // 载荷里故意放CR、LF和0：模块按长度读，不按行读
+    const uint8_t frame[] = { 0x0A, 0x0D, 0x00, 0x41, 0xFF };
+    const std::string frameBytes((const char*)frame, sizeof(frame));
+
+    // 非确认帧，新端口：先AT+PORT，+OK之后才写AT+UTX和载荷
+    transport.start(2, frame, sizeof(frame), false);
+    expectBytes("port command", modem.take(), "AT+PORT=2\r");
+    expectStatus("port pending", transport.poll(), TRANSPORT_BUSY);
+    modem.reply("+OK\r\n");
+    expectStatus("port accepted", transport.poll(), TRANSPORT_BUSY);
+    expectBytes("unconfirmed send", modem.take(), std::string("AT+UTX 5\r") + frameBytes);
+    modem.reply("+OK\r");
+    expectStatus("unconfirmed done", transport.poll(), TRANSPORT_DONE);
+    expectBytes("nothing after send", modem.take(), "");
+
+    // 确认帧，同一端口：直接AT+CTX，+OK之后还要等+ACK
+    transport.start(2, frame, 3, true);
+    expectBytes("confirmed send", modem.take(), std::string("AT+CTX 3\r") + frameBytes.substr(0, 3));
+    modem.reply("+OK\n");
+    expectStatus("confirmed accepted", transport.poll(), TRANSPORT_BUSY);
+    modem.reply("+EVENT=1,1\r\n+AC");
+    expectStatus("ack split across reads", transport.poll(), TRANSPORT_BUSY);
+    modem.reply("K\r\n");
+    expectStatus("confirmed ack", transport.poll(), TRANSPORT_DONE);
+
+    modem.reply("+OK\r\n");     // 上一帧留下的回应，start()时丢掉
+    transport.start(2, frame, 1, true);
+    expectBytes("stale reply dropped", modem.take(), std::string("AT+CTX 1\r") + frameBytes.substr(0, 1));
+    expectStatus("stale reply ignored", transport.poll(), TRANSPORT_BUSY);
+    modem.reply("+OK\r\n+NOACK\r\n");
+    expectStatus("confirmed noack", transport.poll(), TRANSPORT_FAILED);
+
+    // 端口被拒绝：这一帧失败，下一帧重新设置端口
+    transport.start(3, frame, 2, false);
+    expectBytes("new port", modem.take(), "AT+PORT=3\r");
+    modem.reply("+ERR_PARAM\r\n");
+    expectStatus("port rejected", transport.poll(), TRANSPORT_FAILED);
+    transport.start(3, frame, 2, false);
+    expectBytes("port retried", modem.take(), "AT+PORT=3\r");
+    modem.reply("+OK\r\n");
+    transport.poll();
+    expectBytes("send after retry", modem.take(), std::string("AT+UTX 2\r") + frameBytes.substr(0, 2));
+
+    // 发送中途放弃（入网前），resetPort()之后重新设置端口
+    transport.abort();
+    transport.resetPort();
+    transport.start(3, frame, 1, false);
+    expectBytes("port after reset", modem.take(), "AT+PORT=3\r");
+
+    bool pass = (failures == 0);
+    printf("LoRaTransport: %d failures\n", failures);
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
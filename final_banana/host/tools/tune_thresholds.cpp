@@ -0,0 +1,629 @@
+/*
+ * Tune Thresholds - 在标注过的记录数据上搜索判断阈值和衰减系数
+ *
+ * 清单文件每行一个数据集：
+ *   <日志文件> <水果0-3> <从第几小时开始算坏|never>
+ * 日志路径相对清单文件所在目录，'#'开头的行是注释。
+ *
+ * 网格 = 时间衰减倍数 × 气体衰减倍数 × 气体阈值 × 评分阈值，
+ * 分三组判断分别评估：香蕉测试（香蕉数据集）、橘子测试（其他水果）、环境（全部）。
+ * 每个（系数组合, 判断组）是一个tile，交给工作窃取线程池；tile里每条采样只算一次评分，
+ * 再用二维直方图 + 前缀和一次得到所有阈值组合的TP/FP/FN。
+ *
+ * 输出每组的Pareto前沿（精确率↑ 召回率↑ 平均判坏延迟↓），
+ * --csv 另外写出全部组合。
+ *
+ * 用法：tune_thresholds [--threads N] [--gas a:b:step] [--score a:b:step]
+ *                       [--time-decay x,y,...] [--gas-decay x,y,...]
+ *                       [--csv out.csv] <清单文件>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "freshness_model.h"
+#include "decision_rules.h"
+#include "trace_reader.h"
+#include "work_stealing.h"
+
+enum RuleFamily {
+    FAMILY_BANANA_TEST = 0,
+    FAMILY_ORANGE_TEST = 1,
+    FAMILY_ENVIRONMENT = 2
+};
+
+#define FAMILY_COUNT 3
+
+static const char* familyName(int family) {
+    switch (family) {
+        case FAMILY_BANANA_TEST: return "banana_test";
+        case FAMILY_ORANGE_TEST: return "orange_test";
+        default:                 return "environment";
+    }
+}
+
+// 一条采样（模型输入 + 标注）
+struct LabelledSample {
+    int16_t temperatureX10;
+    uint16_t humidityX10;
+    int gasDelta;
+    uint32_t ageSeconds;        // 模型计时（设备重启后从0开始）
+    double hours;               // 数据集内的累计时间，用来和标注比较
+};
+
+struct Dataset {
+    std::string path;
+    FruitType fruit;
+    double spoiledFrom;         // 小时，<0表示一直没坏
+    std::vector<LabelledSample> samples;
+    size_t firstSpoiled;        // 第一条标注为坏的采样
+};
+
+// 一个组合的评估结果
+struct Result {
+    int timeIdx;
+    int gasDecayIdx;
+    int gasIdx;
+    int scoreIdx;
+    long tp;
+    long fp;
+    long fn;
+    double precision;
+    double recall;
+    double meanLatency;         // 小时（漏判的数据集按整段坏的时间计）
+    int missed;                 // 一直没报警的坏数据集
+};
+
+struct Grid {
+    std::vector<int> gas;               // 报警条件 gasDelta > g
+    std::vector<int32_t> scoreCenti;    // 报警条件 score < s
+    std::vector<double> timeDecay;
+    std::vector<double> gasDecay;
+};
+
+static bool parseRange(const char* text, double& from, double& to, double& step) {
+    if (sscanf(text, "%lf:%lf:%lf", &from, &to, &step) != 3) return false;
+    return step > 0 && to >= from;
+}
+
+static bool parseList(const char* text, std::vector<double>& values) {
+    values.clear();
+    const char* p = text;
+    while (*p) {
+        char* end;
+        double v = strtod(p, &end);
+        if (end == p || v <= 0) return false;
+        values.push_back(v);
+        p = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') return false;
+    }
+    return !values.empty();
+}
+
+static std::string directoryOf(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    return (slash == std::string::npos) ? std::string() : path.substr(0, slash + 1);
+}
+
+// 读一个数据集，模型计时规则和trace_replay一样
+static bool loadDataset(Dataset& dataset) {
+    TraceReader reader;
+    if (!reader.open(dataset.path.c_str())) {
+        fprintf(stderr, "cannot open %s\n", dataset.path.c_str());
+        return false;
+    }
+
+    unsigned long segmentStart = 0;
+    unsigned long lastTimestamp = 0;
+    unsigned long elapsedMs = 0;        // 之前各段的总时长
+    bool inSegment = false;
+
+    TraceRecord record;
+    while (reader.next(record)) {
+        const TraceSample& s = record.sample;
+
+        if (!inSegment || s.timestamp < lastTimestamp) {
+            if (inSegment) elapsedMs += lastTimestamp - segmentStart;
+            segmentStart = (record.source == TRACE_MONITOR_BOX) ? s.timestamp : 0;
+            inSegment = true;
+        }
+        lastTimestamp = s.timestamp;
+
+        LabelledSample sample;
+        sample.temperatureX10 = s.temperatureX10;
+        sample.humidityX10 = s.humidityX10;
+        sample.gasDelta = s.gasRaw - s.gasBaseline;
+        sample.ageSeconds = (s.timestamp - segmentStart) / 1000;
+        sample.hours = (elapsedMs + (s.timestamp - segmentStart)) / 3600000.0;
+        dataset.samples.push_back(sample);
+    }
+
+    dataset.firstSpoiled = dataset.samples.size();
+    if (dataset.spoiledFrom >= 0) {
+        for (size_t i = 0; i < dataset.samples.size(); i++) {
+            if (dataset.samples[i].hours >= dataset.spoiledFrom) {
+                dataset.firstSpoiled = i;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+static bool loadManifest(const char* path, std::vector<Dataset>& datasets) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+
+    std::string base = directoryOf(path);
+    char line[512];
+    int lineNumber = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        char trace[400];
+        int fruit;
+        char spoiled[32];
+
+        if (line[0] == '#' || strspn(line, " \t\r\n") == strlen(line)) continue;
+        if (sscanf(line, "%399s %d %31s", trace, &fruit, spoiled) != 3 ||
+            fruit < FRUIT_BANANA || fruit > FRUIT_GRAPE) {
+            fprintf(stderr, "%s:%d: expected <trace> <fruit 0-3> <hours|never>\n", path, lineNumber);
+            ok = false;
+            break;
+        }
+
+        Dataset dataset;
+        dataset.path = (trace[0] == '/') ? std::string(trace) : base + trace;
+        dataset.fruit = (FruitType)fruit;
+        dataset.spoiledFrom = (strcmp(spoiled, "never") == 0) ? -1.0 : atof(spoiled);
+        ok = loadDataset(dataset);
+        datasets.push_back(dataset);
+    }
+
+    fclose(file);
+    return ok && !datasets.empty();
+}
+
+static bool inFamily(int family, FruitType fruit) {
+    if (family == FAMILY_BANANA_TEST) return fruit == FRUIT_BANANA;
+    if (family == FAMILY_ORANGE_TEST) return fruit != FRUIT_BANANA;
+    return true;
+}
+
+// 按倍数缩放时间/气体衰减系数（浮点和定点两份一起改）
+static void scaleProfiles(double timeScale, double gasScale,
+                          FruitProfile profiles[4], FruitProfileFixed profilesFixed[4]) {
+    for (int f = 0; f < 4; f++) {
+        profiles[f] = FruitDatabase::getProfile((FruitType)f);
+        profilesFixed[f] = FruitDatabase::getProfileFixed((FruitType)f);
+        profiles[f].timeDecayCoeff *= timeScale;
+        profiles[f].gasDecayCoeff *= gasScale;
+        profilesFixed[f].timeDecayCenti = (int16_t)(profilesFixed[f].timeDecayCenti * timeScale + 0.5);
+        profilesFixed[f].gasDecayCenti = (int16_t)(profilesFixed[f].gasDecayCenti * gasScale + 0.5);
+    }
+}
+
+// 采样在网格上的位置：
+//   gasLevel  = 满足 gasDelta > g 的气体阈值个数（阈值下标 < gasLevel 时报警）
+//   scoreLevel = 第一个满足 score < s 的评分阈值下标（阈值下标 >= scoreLevel 时报警）
+static int gasLevel(const Grid& grid, int gasDelta) {
+    return (int)(std::lower_bound(grid.gas.begin(), grid.gas.end(), gasDelta) - grid.gas.begin());
+}
+
+static int scoreLevel(const Grid& grid, int32_t scoreCenti) {
+    return (int)(std::upper_bound(grid.scoreCenti.begin(), grid.scoreCenti.end(), scoreCenti) -
+                 grid.scoreCenti.begin());
+}
+
+// 评估一个tile：一组衰减系数 × 一组判断的全部阈值组合
+static void evaluateTile(const Grid& grid, const std::vector<Dataset>& datasets,
+                         int timeIdx, int gasDecayIdx, int family,
+                         std::vector<Result>& results) {
+    const int G = (int)grid.gas.size();
+    const int S = (int)grid.scoreCenti.size();
+
+    FruitProfile profiles[4];
+    FruitProfileFixed profilesFixed[4];
+    scaleProfiles(grid.timeDecay[timeIdx], grid.gasDecay[gasDecayIdx], profiles, profilesFixed);
+
+    SimulatedClock clock;
+    FreshnessModel model(clock);
+
+    // 不报警的采样数：(gasLevel, scoreLevel) 的二维直方图，正负样本各一份
+    std::vector<long> quietPos((G + 1) * (S + 1), 0);
+    std::vector<long> quietNeg((G + 1) * (S + 1), 0);
+    long positives = 0;
+    long negatives = 0;
+
+    // 每个坏数据集：坏之后的 gasLevel 前缀最大值、scoreLevel 前缀最小值
+    struct SpoiledRun {
+        std::vector<int> maxGas;
+        std::vector<int> minScore;
+        std::vector<double> hours;
+        double spoiledFrom;
+    };
+    std::vector<SpoiledRun> runs;
+
+    for (size_t d = 0; d < datasets.size(); d++) {
+        const Dataset& dataset = datasets[d];
+        if (!inFamily(family, dataset.fruit)) continue;
+
+        model.setFruitType(dataset.fruit);
+        model.setProfiles(profiles[dataset.fruit], profilesFixed[dataset.fruit]);
+
+        SpoiledRun run;
+        run.spoiledFrom = dataset.spoiledFrom;
+
+        for (size_t i = 0; i < dataset.samples.size(); i++) {
+            const LabelledSample& s = dataset.samples[i];
+            int32_t score = model.calculateScoreFixed(s.temperatureX10, s.humidityX10,
+                                                      s.gasDelta, s.ageSeconds);
+            int g = gasLevel(grid, s.gasDelta);
+            int k = scoreLevel(grid, score);
+
+            if (i >= dataset.firstSpoiled) {
+                quietPos[g * (S + 1) + k]++;
+                positives++;
+                int prevGas = run.maxGas.empty() ? 0 : run.maxGas.back();
+                int prevScore = run.minScore.empty() ? S : run.minScore.back();
+                run.maxGas.push_back(std::max(prevGas, g));
+                run.minScore.push_back(std::min(prevScore, k));
+                run.hours.push_back(s.hours);
+            } else {
+                quietNeg[g * (S + 1) + k]++;
+                negatives++;
+            }
+        }
+
+        if (!run.hours.empty()) runs.push_back(run);
+    }
+
+    // 原地做前缀和：quiet[j][k] = gasLevel <= j 且 scoreLevel > k 的采样数
+    for (int j = 0; j <= G; j++) {
+        for (int k = S - 1; k >= 0; k--) {
+            quietPos[j * (S + 1) + k] += quietPos[j * (S + 1) + k + 1];
+            quietNeg[j * (S + 1) + k] += quietNeg[j * (S + 1) + k + 1];
+        }
+        if (j > 0) {
+            for (int k = 0; k <= S; k++) {
+                quietPos[j * (S + 1) + k] += quietPos[(j - 1) * (S + 1) + k];
+                quietNeg[j * (S + 1) + k] += quietNeg[(j - 1) * (S + 1) + k];
+            }
+        }
+    }
+
+    results.clear();
+    results.reserve(G * S);
+
+    for (int j = 0; j < G; j++) {
+        for (int k = 0; k < S; k++) {
+            // 阈值(j,k)不报警 ⇔ gasLevel <= j 且 scoreLevel > k
+            long fn = quietPos[j * (S + 1) + k + 1];
+            long tn = quietNeg[j * (S + 1) + k + 1];
+
+            Result r;
+            r.timeIdx = timeIdx;
+            r.gasDecayIdx = gasDecayIdx;
+            r.gasIdx = j;
+            r.scoreIdx = k;
+            r.tp = positives - fn;
+            r.fp = negatives - tn;
+            r.fn = fn;
+            r.precision = (r.tp + r.fp > 0) ? (double)r.tp / (r.tp + r.fp) : 0.0;
+            r.recall = (positives > 0) ? (double)r.tp / positives : 0.0;
+
+            // 判坏延迟：坏之后第一次报警，两个前缀序列都单调，各二分一次
+            double latencySum = 0;
+            r.missed = 0;
+            for (size_t d = 0; d < runs.size(); d++) {
+                const SpoiledRun& run = runs[d];
+                size_t byGas = std::upper_bound(run.maxGas.begin(), run.maxGas.end(), j) -
+                               run.maxGas.begin();
+                size_t byScore = std::lower_bound(run.minScore.begin(), run.minScore.end(), k,
+                                                  std::greater<int>()) - run.minScore.begin();
+                size_t first = std::min(byGas, byScore);
+                if (first < run.hours.size()) {
+                    latencySum += run.hours[first] - run.spoiledFrom;
+                } else {
+                    latencySum += run.hours.back() - run.spoiledFrom;
+                    r.missed++;
+                }
+            }
+            r.meanLatency = runs.empty() ? 0.0 : latencySum / runs.size();
+
+            results.push_back(r);
+        }
+    }
+}
+
+static bool dominatesOrEqual(const Result& a, const Result& b) {
+    return a.precision >= b.precision && a.recall >= b.recall && a.meanLatency <= b.meanLatency;
+}
+
+// 三目标Pareto前沿：按精确率从高到低扫，(召回率, 延迟)维护一条阶梯
+static std::vector<const Result*> paretoFront(const std::vector<const Result*>& all) {
+    std::vector<const Result*> sorted(all);
+    std::sort(sorted.begin(), sorted.end(), [](const Result* a, const Result* b) {
+        if (a->precision != b->precision) return a->precision > b->precision;
+        if (a->recall != b->recall) return a->recall > b->recall;
+        return a->meanLatency < b->meanLatency;
+    });
+
+    // 阶梯上召回率越高延迟越高；key = 召回率，value = 延迟
+    std::map<double, double> stairs;
+    std::vector<const Result*> front;
+
+    for (size_t i = 0; i < sorted.size(); i++) {
+        const Result* r = sorted[i];
+        if (r->tp + r->fp == 0) continue;   // 从不报警的组合没有意义
+
+        std::map<double, double>::iterator above = stairs.lower_bound(r->recall);
+        if (above != stairs.end() && above->second <= r->meanLatency) continue;
+
+        // 去掉被新点支配的台阶（召回率不高于它、延迟不低于它）
+        std::map<double, double>::iterator it = above;
+        while (it != stairs.begin()) {
+            std::map<double, double>::iterator prev = it;
+            --prev;
+            if (prev->second < r->meanLatency) break;
+            stairs.erase(prev);
+        }
+        stairs[r->recall] = r->meanLatency;
+        front.push_back(r);
+    }
+
+    return front;
+}
+
+// 直接用DecisionRules和固件默认系数评估默认阈值，和网格结果互相校验
+static void checkDefaults(const Grid& grid, const std::vector<Dataset>& datasets,
+                          int baseTime, int baseGas,
+                          const std::vector<Result> results[FAMILY_COUNT]) {
+    DecisionRules rules;
+    const DecisionThresholds& t = rules.getThresholds();
+    int gasThreshold[FAMILY_COUNT] = { t.bananaGasTest, t.orangeGasTest, t.envGasSpike };
+    float scoreThreshold[FAMILY_COUNT] = { t.bananaScoreTest, t.orangeScoreTest, t.envScore };
+
+    SimulatedClock clock;
+    FreshnessModel model(clock);
+
+    printf("\nFirmware defaults:\n");
+    for (int family = 0; family < FAMILY_COUNT; family++) {
+        long tp = 0, fp = 0, positives = 0;
+
+        for (size_t d = 0; d < datasets.size(); d++) {
+            const Dataset& dataset = datasets[d];
+            if (!inFamily(family, dataset.fruit)) continue;
+            model.setFruitType(dataset.fruit);
+
+            for (size_t i = 0; i < dataset.samples.size(); i++) {
+                const LabelledSample& s = dataset.samples[i];
+                float score = model.calculateScoreFixed(s.temperatureX10, s.humidityX10,
+                                                        s.gasDelta, s.ageSeconds) / 100.0f;
+                bool alarm;
+                if (family == FAMILY_ENVIRONMENT) {
+                    alarm = rules.checkEnvironmentSpoilage(s.gasDelta, score);
+                } else {
+                    alarm = rules.evaluateFruitTest(dataset.fruit, s.gasDelta, score).spoiled;
+                }
+                bool spoiled = (i >= dataset.firstSpoiled);
+                if (spoiled) positives++;
+                if (alarm && spoiled) tp++;
+                if (alarm && !spoiled) fp++;
+            }
+        }
+
+        double precision = (tp + fp > 0) ? (double)tp / (tp + fp) : 0.0;
+        double recall = (positives > 0) ? (double)tp / positives : 0.0;
+        printf("  %-12s gas>%-3d score<%-5.1f precision %.3f recall %.3f",
+               familyName(family), gasThreshold[family], scoreThreshold[family], precision, recall);
+
+        // 默认值在网格上时核对网格的计数
+        int32_t centi = (int32_t)(scoreThreshold[family] * 100 + 0.5f);
+        std::vector<int>::const_iterator g =
+            std::find(grid.gas.begin(), grid.gas.end(), gasThreshold[family]);
+        std::vector<int32_t>::const_iterator s =
+            std::find(grid.scoreCenti.begin(), grid.scoreCenti.end(), centi);
+        if (baseTime < 0 || baseGas < 0 || g == grid.gas.end() || s == grid.scoreCenti.end()) {
+            printf("  (not on grid)\n");
+            continue;
+        }
+
+        size_t tile = (size_t)(baseTime * grid.gasDecay.size() + baseGas);
+        size_t index = tile * grid.gas.size() * grid.scoreCenti.size() +
+                       (g - grid.gas.begin()) * grid.scoreCenti.size() + (s - grid.scoreCenti.begin());
+        const Result& r = results[family][index];
+        bool match = (r.tp == tp && r.fp == fp);
+        printf("  grid %s\n", match ? "OK" : "MISMATCH");
+    }
+}
+
+int main(int argc, char** argv) {
+    int threads = 0;
+    double gasFrom = 0, gasTo = 60, gasStep = 1;
+    double scoreFrom = 20, scoreTo = 70, scoreStep = 0.5;
+    std::vector<double> timeDecay;
+    std::vector<double> gasDecay;
+    const char* csvPath = NULL;
+    const char* manifest = NULL;
+
+    static const double defaultScales[] = { 0.5, 0.75, 1.0, 1.25, 1.5 };
+    timeDecay.assign(defaultScales, defaultScales + 5);
+    gasDecay.assign(defaultScales, defaultScales + 5);
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--gas") == 0 && hasValue) {
+            if (!parseRange(argv[++i], gasFrom, gasTo, gasStep)) {
+                fprintf(stderr, "--gas expects from:to:step\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--score") == 0 && hasValue) {
+            if (!parseRange(argv[++i], scoreFrom, scoreTo, scoreStep)) {
+                fprintf(stderr, "--score expects from:to:step\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--time-decay") == 0 && hasValue) {
+            if (!parseList(argv[++i], timeDecay)) {
+                fprintf(stderr, "--time-decay expects positive multipliers, e.g. 0.5,1,1.5\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--gas-decay") == 0 && hasValue) {
+            if (!parseList(argv[++i], gasDecay)) {
+                fprintf(stderr, "--gas-decay expects positive multipliers, e.g. 0.5,1,1.5\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--csv") == 0 && hasValue) {
+            csvPath = argv[++i];
+        } else if (argv[i][0] == '-' || manifest) {
+            fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return 1;
+        } else {
+            manifest = argv[i];
+        }
+    }
+
+    if (!manifest) {
+        fprintf(stderr, "usage: tune_thresholds [--threads N] [--gas a:b:step] [--score a:b:step]\n"
+                        "                       [--time-decay x,y] [--gas-decay x,y] [--csv out.csv]\n"
+                        "                       <manifest>\n");
+        return 1;
+    }
+
+    Grid grid;
+    for (double g = gasFrom; g <= gasTo + 1e-9; g += gasStep) {
+        grid.gas.push_back((int)(g >= 0 ? g + 0.5 : g - 0.5));
+    }
+    for (double s = scoreFrom; s <= scoreTo + 1e-9; s += scoreStep) {
+        grid.scoreCenti.push_back((int32_t)(s * 100 + 0.5));
+    }
+    grid.gas.erase(std::unique(grid.gas.begin(), grid.gas.end()), grid.gas.end());
+    grid.scoreCenti.erase(std::unique(grid.scoreCenti.begin(), grid.scoreCenti.end()),
+                          grid.scoreCenti.end());
+    grid.timeDecay = timeDecay;
+    grid.gasDecay = gasDecay;
+
+    std::vector<Dataset> datasets;
+    if (!loadManifest(manifest, datasets)) return 1;
+
+    long sampleCount = 0;
+    int spoiledSets = 0;
+    for (size_t d = 0; d < datasets.size(); d++) {
+        sampleCount += (long)datasets[d].samples.size();
+        if (datasets[d].firstSpoiled < datasets[d].samples.size()) spoiledSets++;
+    }
+
+    const int coeffCombos = (int)(timeDecay.size() * gasDecay.size());
+    const int tiles = coeffCombos * FAMILY_COUNT;
+    const size_t perTile = grid.gas.size() * grid.scoreCenti.size();
+
+    // 每个tile写自己的那一段，不需要加锁
+    std::vector<std::vector<Result> > tileResults(tiles);
+
+    WorkStealingPool pool(threads);
+    auto wallStart = std::chrono::steady_clock::now();
+
+    pool.run(tiles, [&](int tile, int worker) {
+        (void)worker;
+        int family = tile % FAMILY_COUNT;
+        int combo = tile / FAMILY_COUNT;
+        evaluateTile(grid, datasets, combo / (int)gasDecay.size(), combo % (int)gasDecay.size(),
+                     family, tileResults[tile]);
+    });
+
+    double wallSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - wallStart).count();
+
+    // 按判断组收集：下标 = 系数组合 × 阈值组合
+    std::vector<Result> results[FAMILY_COUNT];
+    for (int family = 0; family < FAMILY_COUNT; family++) {
+        results[family].reserve(coeffCombos * perTile);
+        for (int combo = 0; combo < coeffCombos; combo++) {
+            const std::vector<Result>& part = tileResults[combo * FAMILY_COUNT + family];
+            results[family].insert(results[family].end(), part.begin(), part.end());
+        }
+    }
+
+    printf("Datasets: %d (%d spoiled), %ld samples\n", (int)datasets.size(), spoiledSets, sampleCount);
+    printf("Grid:     %d gas x %d score x %d time decay x %d gas decay, %d families\n",
+           (int)grid.gas.size(), (int)grid.scoreCenti.size(),
+           (int)timeDecay.size(), (int)gasDecay.size(), FAMILY_COUNT);
+    printf("Sweep:    %d tiles on %d threads (%ld steals), %.3f s, %.0f combinations/s\n",
+           tiles, pool.getThreads(), pool.getSteals(), wallSeconds,
+           wallSeconds > 0 ? coeffCombos * perTile * FAMILY_COUNT / wallSeconds : 0.0);
+
+    for (int family = 0; family < FAMILY_COUNT; family++) {
+        std::vector<const Result*> all;
+        for (size_t i = 0; i < results[family].size(); i++) {
+            all.push_back(&results[family][i]);
+        }
+        std::vector<const Result*> front = paretoFront(all);
+
+        printf("\nPareto front: %s (%d points)\n", familyName(family), (int)front.size());
+        printf("  time_x gas_x  gas>  score<  precision  recall  latency_h  missed\n");
+        for (size_t i = 0; i < front.size(); i++) {
+            const Result* r = front[i];
+            printf("  %5.2f %5.2f %5d %7.1f %10.3f %7.3f %10.2f %7d\n",
+                   timeDecay[r->timeIdx], gasDecay[r->gasDecayIdx],
+                   grid.gas[r->gasIdx], grid.scoreCenti[r->scoreIdx] / 100.0,
+                   r->precision, r->recall, r->meanLatency, r->missed);
+        }
+
+        // 前沿上的点互不支配（自检）
+        for (size_t a = 0; a < front.size(); a++) {
+            for (size_t b = 0; b < front.size(); b++) {
+                if (a != b && dominatesOrEqual(*front[a], *front[b]) &&
+                    !dominatesOrEqual(*front[b], *front[a])) {
+                    fprintf(stderr, "Pareto check failed in %s\n", familyName(family));
+                    return 1;
+                }
+            }
+        }
+    }
+
+    int baseTime = -1;
+    int baseGas = -1;
+    for (size_t i = 0; i < timeDecay.size(); i++) {
+        if (timeDecay[i] == 1.0) baseTime = (int)i;
+    }
+    for (size_t i = 0; i < gasDecay.size(); i++) {
+        if (gasDecay[i] == 1.0) baseGas = (int)i;
+    }
+    checkDefaults(grid, datasets, baseTime, baseGas, results);
+
+    if (csvPath) {
+        FILE* csv = fopen(csvPath, "w");
+        if (!csv) {
+            fprintf(stderr, "cannot write %s\n", csvPath);
+            return 1;
+        }
+        fprintf(csv, "family,time_decay_x,gas_decay_x,gas_threshold,score_threshold,"
+                     "tp,fp,fn,precision,recall,mean_latency_h,missed\n");
+        for (int family = 0; family < FAMILY_COUNT; family++) {
+            for (size_t i = 0; i < results[family].size(); i++) {
+                const Result& r = results[family][i];
+                fprintf(csv, "%s,%.2f,%.2f,%d,%.2f,%ld,%ld,%ld,%.4f,%.4f,%.3f,%d\n",
+                        familyName(family), timeDecay[r.timeIdx], gasDecay[r.gasDecayIdx],
+                        grid.gas[r.gasIdx], grid.scoreCenti[r.scoreIdx] / 100.0,
+                        r.tp, r.fp, r.fn, r.precision, r.recall, r.meanLatency, r.missed);
+            }
+        }
+        fclose(csv);
+        printf("\nWrote %s\n", csvPath);
+    }
+
+    return 0;
+}
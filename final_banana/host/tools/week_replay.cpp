@@ -0,0 +1,722 @@
+/*
+ * Week Replay - 用模拟时钟回放一周
+ *
+ * 把真实的采样流水线、新鲜度模型和调度器接到SimulatedClock上，
+ * 时钟直接跳到下一个到期的任务，一周（30万次采样）在一秒内跑完。
+ * 环境是合成的：温度按天正弦波动，气体随时间缓慢上升。
+ *
+ * 检查（不满足时返回1）：
+ *   - 采样次数 = 时长 / 采样周期
+ *   - 上传次数 = 时长 / 上传周期
+ *   - 同样的输入跑两遍，阶段变化记录完全一致
+ *   - 上传帧解码后和每分钟的样本逐个相同，没有丢失或重复
+ *   - 上报策略：每个上传周期要么发送要么跳过，两次发送间隔不超过最长静默时间
+ *   - 发送队列：模拟的LoRa模块有发送和接收窗口的延迟，可以按比例丢帧；
+ *     每个打包的样本要么送达、要么重试用完存进flash、要么还在队列里
+ *   - 断网日志：存进flash的样本要么补发送达、要么还在日志里、要么被覆盖；
+ *     补发帧解码后和当时的样本相同；重新打开日志（模拟重启）后未发送的
+ *     样本数不变
+ *   - 帧的年龄前缀：每次交给模拟的模块时，发送时刻减去前缀里的分钟数
+ *     正好是帧里最后一个样本的时间（排队、退避重试都算进去）
+ *   - 会话保存：每一帧用的上行计数都在flash里的预留值之内（重启后不会
+ *     重复），写flash的次数远少于帧数
+ *
+ * 用法：week_replay [--fruit N] [--days D] [--temp C] [--humidity H] [--gas-rise ADC] [--dr DR]
+ *                    [--deadband on|off] [--loss PERCENT]
+ *                    [--outage START_HOUR:HOURS]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "host_shim.h"
+#include "sensors.h"
+#include "freshness_model.h"
+#include "acquisition.h"
+#include "lora_payload.h"
+#include "uplink_batch.h"
+#include "report_policy.h"
+#include "uplink_queue.h"
+#include "flash_log.h"
+#include "session_store.h"
+#include "decision_rules.h"
+#include "scheduler.h"
+#include "monitor_config.h"
+
+#define GAS_BASELINE 300
+
+struct ReplayConfig {
+    FruitType fruit;
+    unsigned long days;
+    float temperature;      // 日均温度
+    float humidity;
+    int gasRise;            // 整个回放期间气体上升量 (ADC)
+    int dataRate;           // 上传帧按这个数据速率的最大载荷打包
+    bool deadband;          // off：死区为0，每个周期都发
+    int lossPercent;        // 模拟丢帧的比例
+    unsigned long outageStart;  // 网络中断（网关不通）的开始时刻和时长 (ms)
+    unsigned long outageLength;
+};
+
+struct ReplayResult {
+    unsigned long samples;
+    unsigned long uploads;
+    unsigned long frameBytes;
+    unsigned long samplesSent;
+    unsigned long batchMismatches;
+    unsigned long pendingSamples;
+    unsigned long overflows;
+    unsigned long discarded;            // 没变化跳过的周期里丢掉的样本
+    unsigned long suppressed;
+    unsigned long sent[REPORT_REASON_COUNT];
+    unsigned long longestSilence;       // 两次发送之间最长的间隔 (ms)
+    unsigned long samplesDelivered;     // 网关真正收到的样本
+    unsigned long samplesLost;          // 非确认帧丢了（设备不知道）
+    unsigned long samplesDropped;       // 重试用完（存进flash）
+    unsigned long samplesStored;        // 队列满时直接存进flash
+    unsigned long samplesBackfilled;    // 从flash补发送达
+    unsigned long samplesInFlash;       // 结束时还在日志里
+    unsigned long samplesOverwritten;   // 日志写满被覆盖
+    unsigned long backfillFrames;
+    unsigned long backfillMismatches;
+    unsigned long ageChecked;           // 发送时检查过年龄前缀的帧
+    unsigned long ageMismatches;        // 年龄前缀算回来不是最后一个样本的时间
+    unsigned long maxAge;               // 发送时最后一个样本最旧的年龄（分钟）
+    unsigned long flashErases;
+    unsigned long flashViolations;      // 往没擦除的页写
+    bool reopenMatches;                 // 重新打开日志后未发送的样本数不变
+    unsigned long fcntUp;               // 发出的帧数（上行计数）
+    unsigned long fcntOverruns;         // 用到了预留值之外的计数
+    unsigned long sessionWrites;
+    bool sessionCovers;                 // 重新打开后的预留值不小于已用的计数
+    unsigned long samplesQueued;        // 结束时还在队列里
+    unsigned long radioSent;
+    unsigned long radioAcked;
+    unsigned long radioRetries;
+    unsigned long radioDropped;
+    std::vector<BatchSample> expected;  // 每分钟一个样本（按固件的取样规则）
+    std::string transitions;    // 阶段变化记录
+    FreshnessStage finalStage;
+    float finalScore;
+};
+
+// 回放期间的全局状态（任务函数没有参数）
+static SimulatedClock* replayClock;
+static AcquisitionPipeline* replayPipeline;
+static ReplayConfig replayConfig;
+static ReplayResult* replayResult;
+static FreshnessStage lastStage;
+static bool haveStage;
+static UplinkBatch* replayBatch;
+static ReportPolicy* replayPolicy;
+static UplinkQueue* replayQueue;
+static FlashLog* replayLog;
+static UplinkBatch* replayBackfillBatch;
+static int backfillSamples;
+static SessionStore* replaySession;
+static TaskScheduler* replayScheduler;
+static DecisionRules replayRules;
+static unsigned long lastSentTime;
+
+static const char* stageName(FreshnessStage stage) {
+    switch (stage) {
+        case STAGE_VERY_FRESH: return "VERY FRESH";
+        case STAGE_GOOD:       return "GOOD";
+        case STAGE_EAT_TODAY:  return "EAT TODAY";
+        default:               return "SPOILED";
+    }
+}
+
+// 合成环境：由模拟时间决定
+static float elapsedDays() {
+    return replayClock->now() / 86400000.0f;
+}
+
+static int gasSource(uint8_t pin) {
+    (void)pin;
+    float progress = elapsedDays() / replayConfig.days;
+    return GAS_BASELINE + (int)(replayConfig.gasRise * progress);
+}
+
+static void updateEnvironment() {
+    float phase = elapsedDays() * 2 * (float)M_PI;
+    float temperature = replayConfig.temperature + 2.0f * sinf(phase);
+    // DHT22分辨率0.1
+    hostSetDHT(roundf(temperature * 10) / 10, replayConfig.humidity);
+}
+
+static void sampleTask() {
+    updateEnvironment();
+    replayPipeline->acquire();
+}
+
+// 模拟的LoRa模块：非确认帧约1.5秒后回应，确认帧再等两个接收窗口；
+// 按伪随机数丢帧（非确认帧丢了设备也不知道）
+class SimulatedTransport : public UplinkTransport {
+public:
+    SimulatedTransport(Clock& clock, int lossPercent)
+        : clock(clock), lossPercent(lossPercent), random(12345), busy(false), lost(false), lastLost(false),
+          fcntUp(0) {}
+
+    bool start(uint8_t port, const uint8_t* data, uint8_t size, bool confirmed) {
+        checkAge(port, data, size);
+        // 模块每发一帧上行计数加1（重发也是新的一帧）
+        if (fcntUp >= replaySession->getReservedUp()) replayResult->fcntOverruns++;
+        fcntUp++;
+        random = random * 1103515245u + 12345u;
+        lost = (int)((random >> 16) % 100) < lossPercent;
+        unsigned long now = clock.now();
+        if (now >= replayConfig.outageStart && now - replayConfig.outageStart < replayConfig.outageLength) {
+            lost = true;
+        }
+        startTime = clock.now();
+        latency = confirmed ? 3500 : 1500;
+        this->confirmed = confirmed;
+        busy = true;
+        return true;
+    }
+
+    TransportStatus poll() {
+        if (!busy) return TRANSPORT_FAILED;
+        if (clock.now() - startTime < latency) return TRANSPORT_BUSY;
+        busy = false;
+        lastLost = lost;
+        return (confirmed && lost) ? TRANSPORT_FAILED : TRANSPORT_DONE;
+    }
+
+    void abort() {
+        busy = false;
+    }
+
+    // 发送时帧里的年龄加上现在的时间，应该正好是最后一个样本的时间
+    void checkAge(uint8_t port, const uint8_t* data, uint8_t size) {
+        int prefix = port == BACKFILL_PORT ? BACKFILL_PREFIX_SIZE : BATCH_PREFIX_SIZE;
+        if (size <= prefix) {
+            replayResult->ageMismatches++;
+            return;
+        }
+        uint16_t age = ((uint16_t)data[prefix - 2] << 8) | data[prefix - 1];
+        if (port == BACKFILL_PORT && age == 0xFFFF) return;
+
+        BatchHeader header;
+        BatchSample decoded[255];
+        int n = UplinkBatch::decode(data + prefix, size - prefix, header, decoded, 255);
+        uint16_t nowMinute = (uint16_t)(clock.now() / BATCH_SAMPLE_INTERVAL);
+        if (n <= 0 || decoded[n - 1].minute != (uint16_t)(nowMinute - age)) {
+            replayResult->ageMismatches++;
+        }
+        replayResult->ageChecked++;
+        if (age > replayResult->maxAge) replayResult->maxAge = age;
+    }
+
+    bool lastFrameLost() const { return lastLost; }
+    uint32_t getFcntUp() const { return fcntUp; }
+
+private:
+    Clock& clock;
+    int lossPercent;
+    uint32_t random;
+    bool busy;
+    bool lost;
+    bool lastLost;
+    uint32_t fcntUp;
+    bool confirmed;
+    unsigned long startTime;
+    unsigned long latency;
+};
+
+static SimulatedTransport* replayTransport;
+
+// 模拟的flash：上传程序后日志区是全0，只能往擦除过（全1）的页写
+class SimulatedFlash : public LogStorage {
+public:
+    SimulatedFlash(uint16_t rows)
+        : bytes(rows * FLASH_LOG_PAGES_PER_ROW * FLASH_LOG_PAGE_SIZE, 0), erases(0), violations(0) {}
+
+    uint16_t pageCount() { return bytes.size() / FLASH_LOG_PAGE_SIZE; }
+
+    void read(uint16_t page, uint8_t* data) {
+        memcpy(data, &bytes[page * FLASH_LOG_PAGE_SIZE], FLASH_LOG_PAGE_SIZE);
+    }
+
+    void write(uint16_t page, const uint8_t* data) {
+        uint8_t* dst = &bytes[page * FLASH_LOG_PAGE_SIZE];
+        for (int i = 0; i < FLASH_LOG_PAGE_SIZE; i++) {
+            if (dst[i] != 0xFF) violations++;
+            dst[i] &= data[i];
+        }
+    }
+
+    void eraseRow(uint16_t firstPage) {
+        memset(&bytes[firstPage * FLASH_LOG_PAGE_SIZE], 0xFF, FLASH_LOG_PAGES_PER_ROW * FLASH_LOG_PAGE_SIZE);
+        erases++;
+    }
+
+    std::vector<uint8_t> bytes;
+    unsigned long erases;
+    unsigned long violations;
+};
+
+// 帧里的样本应该和当时每分钟的样本相同（期望值按分钟计数存放）
+static unsigned long checkSamples(const BatchSample* samples, int n) {
+    unsigned long mismatches = 0;
+    for (int i = 0; i < n; i++) {
+        size_t minute = samples[i].minute;
+        if (minute >= replayResult->expected.size() ||
+            memcmp(&samples[i], &replayResult->expected[minute], sizeof(BatchSample)) != 0) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+// 和固件的persistFrame()一样
+static int persistFrame(const uint8_t* frame, uint8_t size) {
+    BatchHeader header;
+    BatchSample samples[BATCH_CAPACITY];
+    int n = UplinkBatch::decode(frame, size, header, samples, BATCH_CAPACITY);
+    if (n <= 0) return 0;
+    replayLog->append(header, samples, n);
+    return n;
+}
+
+static void sendUplink(ReportReason reason) {
+    uint8_t frame[BATCH_MAX_FRAME];
+    unsigned long now = replayClock->now();
+
+    // 队列满：存进flash
+    if (replayQueue->isFull()) {
+        while (replayBatch->pending() > 0) {
+            uint8_t size = replayBatch->encode(frame, BATCH_MAX_FRAME);
+            replayResult->samplesStored += persistFrame(frame, size);
+            replayBatch->consume();
+        }
+        replayPolicy->sent(reason, now);
+        return;
+    }
+
+    uint8_t size = replayBatch->encode(frame + BATCH_PREFIX_SIZE,
+                                       UplinkBatch::maxPayload(replayConfig.dataRate) - BATCH_PREFIX_SIZE);
+    if (size == 0) return;
+
+    // 解码后应该正好是下一段还没发出的样本
+    BatchHeader header;
+    BatchSample decoded[255];
+    int n = UplinkBatch::decode(frame + BATCH_PREFIX_SIZE, size, header, decoded, 255);
+    if (n != replayBatch->getEncodedCount() || decoded[n - 1].minute != replayBatch->getEncodedLastMinute()) {
+        replayResult->batchMismatches++;
+    }
+    replayResult->batchMismatches += checkSamples(decoded, n);
+
+    size += BATCH_PREFIX_SIZE;
+    replayQueue->push(BATCH_PORT, frame, size, n, reason == REPORT_ALARM, 0, 0, replayBatch->getEncodedLastMinute());
+    replayResult->frameBytes += size;
+    replayResult->samplesSent += n;
+    replayBatch->consume();
+
+    if (now - lastSentTime > replayResult->longestSilence) {
+        replayResult->longestSilence = now - lastSentTime;
+    }
+    lastSentTime = now;
+    replayPolicy->sent(reason, now);
+    replayResult->sent[reason]++;
+}
+
+// 和固件的uploadLoRaData()一样：没变化就跳过，丢掉这段样本
+static void uplinkTask() {
+    replayResult->uploads++;
+    ReportReason reason = replayPolicy->decide(replayClock->now());
+    if (reason == REPORT_NONE) {
+        replayPolicy->suppressed();
+        replayResult->suppressed++;
+        replayResult->discarded += replayBatch->discard();
+        return;
+    }
+    sendUplink(reason);
+}
+
+static void radioTask() {
+    UplinkEvent event = replayQueue->poll();
+    if (event == UPLINK_EVENT_NONE || event == UPLINK_EVENT_RETRY) return;
+
+    const QueuedFrame& frame = replayQueue->lastFrame();
+    if (frame.tag != 0) {
+        // 补发帧：送达才从日志里移除
+        if (event == UPLINK_EVENT_ACKED) {
+            replayLog->consume(backfillSamples);
+            replayResult->samplesBackfilled += backfillSamples;
+        }
+        backfillSamples = 0;
+        return;
+    }
+
+    if (event == UPLINK_EVENT_DROPPED) {
+        replayResult->samplesDropped += persistFrame(frame.data + BATCH_PREFIX_SIZE, frame.size - BATCH_PREFIX_SIZE);
+    } else if (replayTransport->lastFrameLost()) {
+        replayResult->samplesLost += frame.samples;
+    } else {
+        replayResult->samplesDelivered += frame.samples;
+    }
+}
+
+// 和固件的sessionTask()一样：发送期间不查询，计数快用完预留时写flash
+static void sessionTask() {
+    if (replayQueue->isBusy()) return;
+    replaySession->reserve(replayTransport->getFcntUp(), 0);
+}
+
+// 和固件的backfillTask()一样
+static void backfillTask() {
+    if (backfillSamples > 0 || replayQueue->size() > 0 || replayQueue->isLinkDown() ||
+        !replayLog->hasPending()) {
+        return;
+    }
+
+    BatchHeader status;
+    uint16_t recordBoot = 0;
+    BatchSample samples[BATCH_CAPACITY];
+    int n = replayLog->read(status, recordBoot, samples, BATCH_CAPACITY);
+    if (n == 0) return;
+
+    replayBackfillBatch->clear();
+    replayBackfillBatch->setStatus(status.fruit, status.stage, status.remainDays, status.spoil);
+    for (int i = 0; i < n; i++) replayBackfillBatch->addSample(samples[i]);
+
+    uint8_t frame[BATCH_MAX_FRAME];
+    uint8_t maxBytes = UplinkBatch::maxPayload(replayConfig.dataRate) - BACKFILL_PREFIX_SIZE;
+    uint8_t size = replayBackfillBatch->encode(frame + BACKFILL_PREFIX_SIZE, maxBytes);
+    int count = replayBackfillBatch->getEncodedCount();
+    frame[0] = recordBoot >> 8;
+    frame[1] = recordBoot & 0xFF;
+    frame[2] = 0xFF;
+    frame[3] = 0xFF;
+
+    // 补发帧解码后应该是日志里的样本（年龄由队列在发送时写，模拟的模块检查）
+    BatchHeader header;
+    BatchSample decoded[BATCH_CAPACITY];
+    int decodedCount = UplinkBatch::decode(frame + BACKFILL_PREFIX_SIZE, size, header, decoded, BATCH_CAPACITY);
+    if (decodedCount != count || recordBoot != replayLog->getBoot()) {
+        replayResult->backfillMismatches++;
+    } else {
+        replayResult->backfillMismatches += checkSamples(decoded, decodedCount);
+    }
+
+    replayQueue->push(BACKFILL_PORT, frame, size + BACKFILL_PREFIX_SIZE, count, true, 1,
+                      BACKFILL_PREFIX_SIZE - BATCH_PREFIX_SIZE, samples[count - 1].minute);
+    replayResult->backfillFrames++;
+    backfillSamples = count;
+}
+
+static void priorityUplink() {
+    if (replayPolicy->decide(replayClock->now()) == REPORT_ALARM) {
+        sendUplink(REPORT_ALARM);
+    }
+}
+
+static void onSnapshot(const Snapshot& snapshot) {
+    replayResult->samples++;
+
+    BatchSample sample = UplinkBatch::quantize(snapshot);
+    if (replayResult->expected.empty() || replayResult->expected.back().minute != sample.minute) {
+        replayResult->expected.push_back(sample);
+    }
+    replayBatch->add(snapshot);
+
+    bool alarm = replayRules.checkEnvironmentSpoilage(snapshot.data.gasDelta, snapshot.score);
+    if (replayPolicy->observe(snapshot, alarm, replayClock->now())) {
+        replayScheduler->postDelayed(priorityUplink, 0);
+    }
+
+    if (!haveStage || snapshot.stage != lastStage) {
+        char line[96];
+        snprintf(line, sizeof(line), "  %8.3f h  %-10s score %6.2f\n",
+                 snapshot.timestamp / 3600000.0, stageName(snapshot.stage), snapshot.score);
+        replayResult->transitions += line;
+        lastStage = snapshot.stage;
+        haveStage = true;
+    }
+}
+
+static ReplayResult runReplay(const ReplayConfig& config) {
+    ReplayResult result;
+    result.samples = 0;
+    result.uploads = 0;
+    result.frameBytes = 0;
+    result.samplesSent = 0;
+    result.batchMismatches = 0;
+    result.discarded = 0;
+    result.suppressed = 0;
+    result.longestSilence = 0;
+    for (int i = 0; i < REPORT_REASON_COUNT; i++) result.sent[i] = 0;
+    result.samplesDelivered = 0;
+    result.samplesLost = 0;
+    result.samplesDropped = 0;
+    result.samplesStored = 0;
+    result.samplesBackfilled = 0;
+    result.backfillFrames = 0;
+    result.backfillMismatches = 0;
+    result.ageChecked = 0;
+    result.ageMismatches = 0;
+    result.maxAge = 0;
+    result.fcntOverruns = 0;
+
+    SimulatedClock clock;
+    Sensors sensors;
+    FreshnessModel model(clock);
+    AcquisitionPipeline pipeline(sensors, model, clock);
+    TaskScheduler scheduler(clock);
+    UplinkBatch batch;
+    ReportDeadband deadband = ReportPolicy::defaults();
+    if (!config.deadband) {
+        deadband.temperatureX10 = 0;
+        deadband.humidityX10 = 0;
+        deadband.gasDelta = 0;
+    }
+    ReportPolicy policy(deadband, REPORT_MAX_SILENCE);
+    SimulatedTransport transport(clock, config.lossPercent);
+    UplinkQueue queue(transport, clock);
+    SimulatedFlash flash(FLASH_LOG_ROWS);
+    FlashLog log(flash);
+    UplinkBatch backfillBatch;
+    log.begin();
+
+    // 入网后保存的会话（密钥内容无关紧要）
+    SimulatedFlash sessionFlash(SESSION_STORE_ROWS);
+    SessionStore session(sessionFlash);
+    session.begin();
+    LoRaSession joined;
+    memset(&joined, 0x5A, sizeof(joined));
+    joined.fcntUp = 0;
+    joined.fcntDown = 0;
+    session.save(joined);
+
+    replayClock = &clock;
+    replayPipeline = &pipeline;
+    replayConfig = config;
+    replayResult = &result;
+    replayBatch = &batch;
+    replayPolicy = &policy;
+    replayQueue = &queue;
+    replayTransport = &transport;
+    replayLog = &log;
+    replayBackfillBatch = &backfillBatch;
+    backfillSamples = 0;
+    replaySession = &session;
+    replayScheduler = &scheduler;
+    lastSentTime = 0;
+    haveStage = false;
+
+    hostSetAnalogSource(gasSource);
+    sensors.begin();
+    for (int i = 0; i < 10; i++) {
+        sensors.calibrateGasSensor();
+    }
+
+    model.setFruitType(config.fruit);
+    pipeline.subscribe(onSnapshot);
+
+    // 和固件一样：启动完成时采样和上传任务同时开始计时
+    scheduler.addTask("sample", sampleTask, DISPLAY_UPDATE_INTERVAL, DISPLAY_UPDATE_INTERVAL);
+    scheduler.addTask("uplink", uplinkTask, UPLOAD_INTERVAL, UPLOAD_INTERVAL);
+    scheduler.addTask("radio", radioTask, UPLINK_POLL_INTERVAL, UPLINK_POLL_INTERVAL);
+    scheduler.addTask("backfill", backfillTask, BACKFILL_INTERVAL, BACKFILL_INTERVAL);
+    scheduler.addTask("session", sessionTask, SESSION_CHECK_INTERVAL, SESSION_CHECK_INTERVAL);
+
+    unsigned long end = config.days * 86400000UL;
+    while (true) {
+        unsigned long due = scheduler.nextDue();
+        if (due > end) break;
+        clock.set(due);
+        scheduler.run();
+    }
+
+    result.finalStage = pipeline.latest().stage;
+    result.finalScore = pipeline.latest().score;
+    result.pendingSamples = batch.pending();
+    result.overflows = batch.getOverflows();
+    // 队列里的补发帧不算实时样本（它的样本还在日志里）
+    result.samplesQueued = queue.getQueuedSamples() - backfillSamples;
+    result.radioSent = queue.getSent();
+    result.radioAcked = queue.getAcked();
+    result.radioRetries = queue.getRetries();
+    result.radioDropped = queue.getDropped();
+    result.samplesInFlash = log.getPendingSamples();
+    result.samplesOverwritten = log.getSamplesOverwritten();
+    result.flashErases = flash.erases;
+    result.flashViolations = flash.violations;
+
+    // 模拟重启：重新扫描日志，未发送的样本数不变；写过记录时启动编号加1
+    FlashLog reopened(flash);
+    reopened.begin();
+    result.reopenMatches = reopened.getPendingSamples() == log.getPendingSamples() &&
+                           reopened.getBoot() == log.getBoot() + (log.getRecordsWritten() > 0 ? 1 : 0);
+
+    // 模拟重启后恢复会话：从预留值开始计数，不会用到已经用过的计数
+    result.fcntUp = transport.getFcntUp();
+    result.sessionWrites = session.getWrites();
+    result.flashViolations += sessionFlash.violations;
+    SessionStore restored(sessionFlash);
+    LoRaSession saved;
+    result.sessionCovers = restored.begin() && restored.load(saved) && saved.fcntUp >= transport.getFcntUp() &&
+                           memcmp(saved.devAddr, joined.devAddr, sizeof(saved.devAddr)) == 0;
+    hostSetAnalogSource(NULL);
+    return result;
+}
+
+int main(int argc, char** argv) {
+    ReplayConfig config;
+    config.fruit = FRUIT_BANANA;
+    config.days = 7;
+    config.temperature = 20.0f;
+    config.humidity = 65.0f;
+    config.gasRise = 40;
+    config.dataRate = 0;
+    config.deadband = true;
+    config.lossPercent = 0;
+    config.outageStart = 0;
+    config.outageLength = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--fruit") == 0) config.fruit = (FruitType)atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--days") == 0) config.days = atol(argv[i + 1]);
+        else if (strcmp(argv[i], "--temp") == 0) config.temperature = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--humidity") == 0) config.humidity = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--gas-rise") == 0) config.gasRise = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--dr") == 0) config.dataRate = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--loss") == 0) config.lossPercent = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--outage") == 0) {
+            unsigned long startHour = 0;
+            unsigned long hours = 0;
+            if (sscanf(argv[i + 1], "%lu:%lu", &startHour, &hours) != 2) {
+                fprintf(stderr, "--outage expects START_HOUR:HOURS\n");
+                return 1;
+            }
+            config.outageStart = startHour * 3600000UL;
+            config.outageLength = hours * 3600000UL;
+        }
+        else if (strcmp(argv[i], "--deadband") == 0) config.deadband = strcmp(argv[i + 1], "off") != 0;
+        else {
+            fprintf(stderr, "unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (config.fruit < FRUIT_BANANA || config.fruit > FRUIT_GRAPE || config.days == 0 ||
+        config.days > 40) {
+        fprintf(stderr, "fruit must be 0-3 and days 1-40\n");
+        return 1;
+    }
+
+    hostSetSerialEnabled(false);
+
+    ReplayResult first = runReplay(config);
+    ReplayResult second = runReplay(config);
+
+    printf("%s, %lu days, %.1f C (+/-2), %.1f %%RH, gas +%d ADC\n",
+           FruitDatabase::getTypeName(config.fruit), config.days,
+           config.temperature, config.humidity, config.gasRise);
+    printf("Stage transitions:\n%s", first.transitions.c_str());
+    printf("Final: %s, score %.2f\n", stageName(first.finalStage), first.finalScore);
+
+    unsigned long duration = config.days * 86400000UL;
+    unsigned long expectedSamples = duration / DISPLAY_UPDATE_INTERVAL;
+    unsigned long expectedUploads = duration / UPLOAD_INTERVAL;
+
+    bool pass = true;
+    printf("Samples: %lu (expected %lu)\n", first.samples, expectedSamples);
+    printf("Uploads: %lu (expected %lu)\n", first.uploads, expectedUploads);
+
+    if (first.samples != expectedSamples || first.uploads != expectedUploads) {
+        pass = false;
+    }
+
+    // 上报策略：每个上传周期要么发要么跳过，报警的优先上传另算
+    unsigned long frames = 0;
+    for (int r = 0; r < REPORT_REASON_COUNT; r++) frames += first.sent[r];
+    unsigned long periodicFrames = frames - first.sent[REPORT_ALARM];
+    printf("Reports (deadband %s): %lu frames (first %lu, change %lu, heartbeat %lu, alarm %lu), "
+           "%lu of %lu periods suppressed, longest silence %lu min\n",
+           config.deadband ? "on" : "off", frames, first.sent[REPORT_FIRST], first.sent[REPORT_CHANGE],
+           first.sent[REPORT_HEARTBEAT], first.sent[REPORT_ALARM], first.suppressed, first.uploads,
+           first.longestSilence / 60000);
+
+    if (periodicFrames + first.suppressed != first.uploads ||
+        first.longestSilence > REPORT_MAX_SILENCE + UPLOAD_INTERVAL) {
+        pass = false;
+    }
+
+    // 上传帧：每个样本正好发一次或随跳过的周期丢掉，最后还没发的留在缓冲里
+    unsigned long uplinkBytes = first.uploads * LORA_PAYLOAD_SIZE;
+    printf("Batch DR%d: %lu of %lu minute samples in %lu frames, %lu bytes "
+           "(%.1f bytes/sample, %.1f samples/frame)\n",
+           config.dataRate, first.samplesSent, (unsigned long)first.expected.size(), frames,
+           first.frameBytes, first.samplesSent ? (double)first.frameBytes / first.samplesSent : 0.0,
+           frames ? (double)first.samplesSent / frames : 0.0);
+    printf("        %lu dropped as unchanged, %lu pending, %lu overflowed, %lu mismatches "
+           "(one %d-byte snapshot per period would be %lu bytes)\n",
+           first.discarded, first.pendingSamples, first.overflows, first.batchMismatches,
+           LORA_PAYLOAD_SIZE, uplinkBytes);
+
+    if (first.batchMismatches != 0 ||
+        first.samplesSent + first.samplesStored + first.discarded + first.pendingSamples + first.overflows !=
+            first.expected.size()) {
+        pass = false;
+    }
+    // 发送队列：打包的样本都有去处；不丢帧时全部送达
+    printf("Radio (%d%% loss, %lu h outage): %lu frames sent (%lu acked), %lu retries, %lu dropped; "
+           "samples %lu delivered, %lu lost unconfirmed, %lu to flash, %lu queued\n",
+           config.lossPercent, config.outageLength / 3600000UL, first.radioSent, first.radioAcked, first.radioRetries, first.radioDropped,
+           first.samplesDelivered, first.samplesLost, first.samplesDropped, first.samplesQueued);
+
+    if (first.samplesDelivered + first.samplesLost + first.samplesDropped + first.samplesQueued !=
+            first.samplesSent ||
+        (config.lossPercent == 0 && config.outageLength == 0 && first.samplesDelivered + first.samplesQueued != first.samplesSent)) {
+        pass = false;
+    }
+
+    // 断网日志：存进flash的样本要么补发送达、要么还在日志里、要么被覆盖
+    printf("Flash log: %lu samples stored (%lu queue full), %lu backfilled in %lu frames, "
+           "%lu pending, %lu overwritten, %lu row erases, %lu mismatches\n",
+           first.samplesDropped + first.samplesStored, first.samplesStored, first.samplesBackfilled,
+           first.backfillFrames, first.samplesInFlash, first.samplesOverwritten, first.flashErases,
+           first.backfillMismatches);
+
+    if (first.samplesDropped + first.samplesStored !=
+            first.samplesBackfilled + first.samplesInFlash + first.samplesOverwritten ||
+        first.backfillMismatches != 0 || first.flashViolations != 0 || !first.reopenMatches) {
+        if (first.flashViolations != 0) printf("%lu writes to pages that were not erased\n", first.flashViolations);
+        if (!first.reopenMatches) printf("Reopened log differs\n");
+        pass = false;
+    }
+
+    // 帧里的年龄：不管排队、退避了多久，发送时都能算回最后一个样本的时间
+    printf("Frame age: %lu frames checked at send, oldest last sample %lu min, %lu mismatches\n",
+           first.ageChecked, first.maxAge, first.ageMismatches);
+
+    if (first.ageMismatches != 0 || (first.radioSent + first.radioRetries + first.radioDropped > 0 &&
+                                     first.ageChecked == 0)) {
+        pass = false;
+    }
+
+    // 会话：上行计数一直在预留值之内，写flash的次数约为帧数/预留步长
+    printf("Session: %lu frames, %lu counter saves (step %d), %lu overruns\n",
+           first.fcntUp, first.sessionWrites, SESSION_FCNT_STEP, first.fcntOverruns);
+
+    if (first.fcntOverruns != 0 || !first.sessionCovers ||
+        first.sessionWrites > first.fcntUp / (SESSION_FCNT_STEP - SESSION_FCNT_MARGIN) + 1) {
+        if (!first.sessionCovers) printf("Restored session would reuse frame counters\n");
+        pass = false;
+    }
+
+    if (first.transitions != second.transitions || first.samples != second.samples ||
+        first.uploads != second.uploads || first.frameBytes != second.frameBytes) {
+        printf("Second run differs from the first\n");
+        pass = false;
+    }
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
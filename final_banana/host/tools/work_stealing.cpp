@@ -0,0 +1,71 @@
+/*
+ * Work Stealing Implementation
+ */
+
+#include "work_stealing.h"
+
+WorkStealingPool::WorkStealingPool(int threads) {
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+        if (threads <= 0) threads = 1;
+    }
+    threadCount = threads;
+    steals = 0;
+}
+
+bool WorkStealingPool::popLocal(WorkerQueue& queue, int& tile) {
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.tiles.empty()) return false;
+    tile = queue.tiles.back();
+    queue.tiles.pop_back();
+    return true;
+}
+
+// 从下一个线程开始依次尝试，偷队列头部（最早分配、离主人最远的tile）
+bool WorkStealingPool::steal(std::vector<WorkerQueue>& queues, int thief, int& tile) {
+    int count = (int)queues.size();
+    for (int i = 1; i < count; i++) {
+        WorkerQueue& victim = queues[(thief + i) % count];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.tiles.empty()) {
+            tile = victim.tiles.front();
+            victim.tiles.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::run(int tiles, const TileFunction& work) {
+    std::vector<WorkerQueue> queues(threadCount);
+    for (int t = 0; t < tiles; t++) {
+        queues[t % threadCount].tiles.push_back(t);
+    }
+
+    // tile不会产生新tile，所有队列都空了就可以结束
+    auto worker = [&](int id) {
+        long stolen = 0;
+        int tile;
+        while (true) {
+            if (popLocal(queues[id], tile)) {
+                work(tile, id);
+            } else if (steal(queues, id, tile)) {
+                stolen++;
+                work(tile, id);
+            } else {
+                break;
+            }
+        }
+        std::lock_guard<std::mutex> guard(statsLock);
+        steals += stolen;
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) {
+        threads.push_back(std::thread(worker, i));
+    }
+    worker(0);
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
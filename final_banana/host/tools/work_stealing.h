@@ -0,0 +1,43 @@
+/*
+ * Work Stealing - 工作窃取线程池
+ *
+ * 任务（tile）先轮流分给各个线程的双端队列；线程从自己队列尾部取，
+ * 空了就从别的线程队列头部偷。tile之间耗时差别大时也能把核跑满。
+ */
+
+#ifndef WORK_STEALING_H
+#define WORK_STEALING_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    // work(tile, worker)，worker从0开始
+    typedef std::function<void(int tile, int worker)> TileFunction;
+
+    explicit WorkStealingPool(int threads);
+
+    void run(int tiles, const TileFunction& work);
+
+    int getThreads() const { return threadCount; }
+    long getSteals() const { return steals; }
+
+private:
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<int> tiles;
+    };
+
+    int threadCount;
+    long steals;
+    std::mutex statsLock;
+
+    bool popLocal(WorkerQueue& queue, int& tile);
+    bool steal(std::vector<WorkerQueue>& queues, int thief, int& tile);
+};
+
+#endif
@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+Fruit profile generator - 水果参数表生成器
+
+读取 fruit_profiles.csv（每行一种水果的存储参数），生成
+fruit_profiles_table.h：FruitType枚举、逐个水果展开的X宏，以及每种水果
+一个 FruitTraits<F> 特化，里面是编译期常量——原始浮点值、四舍五入后的
+定点值，和评分时要用的最佳点、温湿度和、预乘好的扣分系数。
+范围检查在 fruit_profiles.cpp 里用 static_assert 做，这里先挡住明显的错。
+
+用法：
+    python3 gen_fruit_profiles.py            # 重新生成头文件
+    python3 gen_fruit_profiles.py --check    # 只检查头文件是否和CSV一致（主机构建用）
+"""
+
+import argparse
+import csv
+import os
+import sys
+from decimal import Decimal, ROUND_HALF_UP
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_INPUT = os.path.join(HERE, "fruit_profiles.csv")
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "Arduino", "FruitMonitor_2Buttons", "fruit_profiles_table.h")
+
+FLOAT_COLUMNS = ["min_temp", "max_temp", "min_humidity", "max_humidity", "gas_threshold",
+                 "temp_decay", "humid_decay", "gas_decay", "time_decay", "initial_score"]
+
+
+def scaled(value, scale):
+    return int((Decimal(value) * scale).quantize(Decimal(1), rounding=ROUND_HALF_UP))
+
+
+def c_float(value):
+    text = str(Decimal(value))
+    if "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def c_string(s):
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        rows = [line for line in f if line.strip() and not line.startswith("#")]
+    fruits = list(csv.DictReader(rows))
+    if not fruits:
+        sys.exit("%s: no fruit rows" % path)
+
+    for fruit in fruits:
+        for col in FLOAT_COLUMNS:
+            Decimal(fruit[col])
+        if Decimal(fruit["min_temp"]) >= Decimal(fruit["max_temp"]):
+            sys.exit("%s: min_temp must be below max_temp" % fruit["id"])
+        if Decimal(fruit["min_humidity"]) >= Decimal(fruit["max_humidity"]):
+            sys.exit("%s: min_humidity must be below max_humidity" % fruit["id"])
+        int(fruit["life_days"])
+    return fruits
+
+
+def traits(fruit):
+    """一种水果的全部常量：(C++类型, 名字, 值, 注释)，分三组"""
+    f = fruit
+    temp_sum = scaled(f["min_temp"], 10) + scaled(f["max_temp"], 10)
+    hum_sum = scaled(f["min_humidity"], 10) + scaled(f["max_humidity"], 10)
+    optimal_temp = (Decimal(f["min_temp"]) + Decimal(f["max_temp"])) / 2
+    optimal_hum = (Decimal(f["min_humidity"]) + Decimal(f["max_humidity"])) / 2
+
+    raw = [
+        ("const char*", "name", c_string(f["name"]), ""),
+        ("const char*", "emoji", c_string(f["emoji"]), ""),
+        ("float", "minTemp", c_float(f["min_temp"]), "°C"),
+        ("float", "maxTemp", c_float(f["max_temp"]), "°C"),
+        ("float", "minHumidity", c_float(f["min_humidity"]), "%"),
+        ("float", "maxHumidity", c_float(f["max_humidity"]), "%"),
+        ("float", "gasThreshold", c_float(f["gas_threshold"]), ""),
+        ("float", "tempDecayCoeff", c_float(f["temp_decay"]), "分/°C"),
+        ("float", "humidDecayCoeff", c_float(f["humid_decay"]), "分/%"),
+        ("float", "gasDecayCoeff", c_float(f["gas_decay"]), "分/单位气体变化"),
+        ("float", "timeDecayCoeff", c_float(f["time_decay"]), "分/小时"),
+        ("float", "initialScore", c_float(f["initial_score"]), ""),
+        ("int", "expectedLifeDays", str(int(f["life_days"])), "天"),
+    ]
+    fixed = [
+        ("int16_t", "minTempX10", scaled(f["min_temp"], 10), "0.1°C"),
+        ("int16_t", "maxTempX10", scaled(f["max_temp"], 10), "0.1°C"),
+        ("int16_t", "minHumidityX10", scaled(f["min_humidity"], 10), "0.1%"),
+        ("int16_t", "maxHumidityX10", scaled(f["max_humidity"], 10), "0.1%"),
+        ("int16_t", "tempDecayCenti", scaled(f["temp_decay"], 100), "×100"),
+        ("int16_t", "humidDecayCenti", scaled(f["humid_decay"], 100), "×100"),
+        ("int16_t", "gasDecayCenti", scaled(f["gas_decay"], 100), "×100"),
+        ("int16_t", "timeDecayCenti", scaled(f["time_decay"], 100), "×100"),
+        ("int16_t", "initialScoreCenti", scaled(f["initial_score"], 100), "×100"),
+    ]
+    derived = [
+        ("float", "optimalTemp", c_float(optimal_temp), "(min+max)/2"),
+        ("float", "optimalHumidity", c_float(optimal_hum), "(min+max)/2"),
+        ("int16_t", "tempSumX10", temp_sum, "min+max (0.1°C)"),
+        ("int16_t", "humiditySumX10", hum_sum, "min+max (0.1%)"),
+        ("int32_t", "initialScoreE4", scaled(f["initial_score"], 10000), "初始评分 (0.0001分)"),
+        ("int32_t", "tempPenaltyE4", scaled(f["temp_decay"], 100) * 5, "每0.05°C偏差扣分 (0.0001分)"),
+        ("int32_t", "humidPenaltyE4", scaled(f["humid_decay"], 100) * 5, "每0.05%偏差扣分 (0.0001分)"),
+        ("int32_t", "gasPenaltyE4", scaled(f["gas_decay"], 100) * 100, "每单位气体变化扣分 (0.0001分)"),
+    ]
+    return raw, fixed, derived
+
+
+def member_lines(members):
+    width = max(len("static constexpr %s %s = %s;" % (t, n, v)) for t, n, v, _ in members)
+    lines = []
+    for ctype, name, value, note in members:
+        text = "static constexpr %s %s = %s;" % (ctype, name, value)
+        lines.append(("    " + text.ljust(width) + ("  // " + note if note else "")).rstrip())
+    return lines
+
+
+def render(fruits, source):
+    lines = [
+        "/*",
+        " * Fruit Profile Table - 水果参数常量表",
+        " * 由 tools/gen_fruit_profiles.py 根据 tools/%s 生成，请勿手动修改" % source,
+        " */",
+        "",
+        "#ifndef FRUIT_PROFILES_TABLE_H",
+        "#define FRUIT_PROFILES_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// 水果类型枚举",
+        "enum FruitType {",
+    ]
+    for i, fruit in enumerate(fruits):
+        sep = "," if i + 1 < len(fruits) else ""
+        entry = "%s = %d%s" % (fruit["id"], i, sep)
+        lines.append("    %s  // %s" % (entry.ljust(20), fruit["name"]))
+    lines += [
+        "};",
+        "",
+        "#define FRUIT_COUNT %d" % len(fruits),
+        "",
+        "// 按枚举顺序对每种水果展开一次 X(type)",
+        "#define FRUIT_TABLE_FOR_EACH(X) \\",
+    ]
+    for i, fruit in enumerate(fruits):
+        lines.append("    X(%s)%s" % (fruit["id"], " \\" if i + 1 < len(fruits) else ""))
+    lines += [
+        "",
+        "// 每种水果的编译期常量（只按值使用，不要取地址或绑定到引用）",
+        "template <FruitType F> struct FruitTraits;",
+        "",
+    ]
+
+    for fruit in fruits:
+        raw, fixed, derived = traits(fruit)
+        lines.append("template <> struct FruitTraits<%s> {" % fruit["id"])
+        lines.append("    // 原始参数")
+        lines += member_lines(raw)
+        lines.append("")
+        lines.append("    // 定点参数（四舍五入）")
+        lines += member_lines(fixed)
+        lines.append("")
+        lines.append("    // 派生常数")
+        lines += member_lines(derived)
+        lines.append("};")
+        lines.append("")
+
+    lines.append("#endif")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("-i", "--input", default=DEFAULT_INPUT)
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    parser.add_argument("--check", action="store_true",
+                        help="compare with the existing header instead of writing it")
+    args = parser.parse_args()
+
+    text = render(load(args.input), os.path.basename(args.input))
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except IOError:
+            current = None
+        if current != text:
+            sys.exit("%s is out of date, run tools/gen_fruit_profiles.py" % os.path.normpath(args.output))
+        print("%s is up to date" % os.path.normpath(args.output))
+        return
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("wrote %s" % os.path.normpath(args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+Glyph atlas generator - 预渲染字形表生成器
+
+把Arduino_GFX默认5x7字体按UIManager实际用到的字号放大，
+生成1bpp位图（Adafruit drawBitmap格式：逐行、高位在前）写入
+glyph_atlas.h，设备端每个字形只需一次地址窗口写入。
+
+用法：
+    python3 gen_glyph_atlas.py                      # 使用内置字体表
+    python3 gen_glyph_atlas.py --font <glcdfont.h>  # 从Arduino_GFX库读取字体
+"""
+
+import argparse
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "Arduino", "FruitMonitor_2Buttons", "glyph_atlas.h")
+
+PRINTABLE = "".join(chr(c) for c in range(0x20, 0x7F))
+
+# 每个字号需要的字符（只生成实际用到的）
+#   1、2号：数值、单位、阶段名、提示语，生成完整可打印ASCII
+#   3、4号：只有少数标题，按字符串收集
+SIZE_STRINGS = {
+    1: [PRINTABLE],
+    2: [PRINTABLE],
+    3: ["Calibrating", "Joining", "Returning to", "Environment Mode", "TFT TEST OK!"],
+    4: ["Fruit Monitor", "ERROR", "DO NOT EAT", "OK TO EAT",
+        "Banana", "Orange", "Apple", "Grape"],
+}
+
+# Arduino_GFX / Adafruit glcdfont 的可打印ASCII部分（0x20-0x7E），每字符5列，低位在上
+BUILTIN_FONT = [
+    0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x5F, 0x00, 0x00,  0x00, 0x07, 0x00, 0x07, 0x00,
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  0x24, 0x2A, 0x7F, 0x2A, 0x12,  0x23, 0x13, 0x08, 0x64, 0x62,
+    0x36, 0x49, 0x56, 0x20, 0x50,  0x00, 0x08, 0x07, 0x03, 0x00,  0x00, 0x1C, 0x22, 0x41, 0x00,
+    0x00, 0x41, 0x22, 0x1C, 0x00,  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  0x08, 0x08, 0x3E, 0x08, 0x08,
+    0x00, 0x80, 0x70, 0x30, 0x00,  0x08, 0x08, 0x08, 0x08, 0x08,  0x00, 0x00, 0x60, 0x60, 0x00,
+    0x20, 0x10, 0x08, 0x04, 0x02,  0x3E, 0x51, 0x49, 0x45, 0x3E,  0x00, 0x42, 0x7F, 0x40, 0x00,
+    0x72, 0x49, 0x49, 0x49, 0x46,  0x21, 0x41, 0x49, 0x4D, 0x33,  0x18, 0x14, 0x12, 0x7F, 0x10,
+    0x27, 0x45, 0x45, 0x45, 0x39,  0x3C, 0x4A, 0x49, 0x49, 0x31,  0x41, 0x21, 0x11, 0x09, 0x07,
+    0x36, 0x49, 0x49, 0x49, 0x36,  0x46, 0x49, 0x49, 0x29, 0x1E,  0x00, 0x00, 0x14, 0x00, 0x00,
+    0x00, 0x40, 0x34, 0x00, 0x00,  0x00, 0x08, 0x14, 0x22, 0x41,  0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x41, 0x22, 0x14, 0x08,  0x02, 0x01, 0x59, 0x09, 0x06,  0x3E, 0x41, 0x5D, 0x59, 0x4E,
+    0x7C, 0x12, 0x11, 0x12, 0x7C,  0x7F, 0x49, 0x49, 0x49, 0x36,  0x3E, 0x41, 0x41, 0x41, 0x22,
+    0x7F, 0x41, 0x41, 0x41, 0x3E,  0x7F, 0x49, 0x49, 0x49, 0x41,  0x7F, 0x09, 0x09, 0x09, 0x01,
+    0x3E, 0x41, 0x41, 0x51, 0x73,  0x7F, 0x08, 0x08, 0x08, 0x7F,  0x00, 0x41, 0x7F, 0x41, 0x00,
+    0x20, 0x40, 0x41, 0x3F, 0x01,  0x7F, 0x08, 0x14, 0x22, 0x41,  0x7F, 0x40, 0x40, 0x40, 0x40,
+    0x7F, 0x02, 0x1C, 0x02, 0x7F,  0x7F, 0x04, 0x08, 0x10, 0x7F,  0x3E, 0x41, 0x41, 0x41, 0x3E,
+    0x7F, 0x09, 0x09, 0x09, 0x06,  0x3E, 0x41, 0x51, 0x21, 0x5E,  0x7F, 0x09, 0x19, 0x29, 0x46,
+    0x26, 0x49, 0x49, 0x49, 0x32,  0x03, 0x01, 0x7F, 0x01, 0x03,  0x3F, 0x40, 0x40, 0x40, 0x3F,
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  0x3F, 0x40, 0x38, 0x40, 0x3F,  0x63, 0x14, 0x08, 0x14, 0x63,
+    0x03, 0x04, 0x78, 0x04, 0x03,  0x61, 0x59, 0x49, 0x4D, 0x43,  0x00, 0x7F, 0x41, 0x41, 0x41,
+    0x02, 0x04, 0x08, 0x10, 0x20,  0x00, 0x41, 0x41, 0x41, 0x7F,  0x04, 0x02, 0x01, 0x02, 0x04,
+    0x40, 0x40, 0x40, 0x40, 0x40,  0x00, 0x03, 0x07, 0x08, 0x00,  0x20, 0x54, 0x54, 0x78, 0x40,
+    0x7F, 0x28, 0x44, 0x44, 0x38,  0x38, 0x44, 0x44, 0x44, 0x28,  0x38, 0x44, 0x44, 0x28, 0x7F,
+    0x38, 0x54, 0x54, 0x54, 0x18,  0x00, 0x08, 0x7E, 0x09, 0x02,  0x18, 0xA4, 0xA4, 0x9C, 0x78,
+    0x7F, 0x08, 0x04, 0x04, 0x78,  0x00, 0x44, 0x7D, 0x40, 0x00,  0x20, 0x40, 0x40, 0x3D, 0x00,
+    0x7F, 0x10, 0x28, 0x44, 0x00,  0x00, 0x41, 0x7F, 0x40, 0x00,  0x7C, 0x04, 0x78, 0x04, 0x78,
+    0x7C, 0x08, 0x04, 0x04, 0x78,  0x38, 0x44, 0x44, 0x44, 0x38,  0xFC, 0x18, 0x24, 0x24, 0x18,
+    0x18, 0x24, 0x24, 0x18, 0xFC,  0x7C, 0x08, 0x04, 0x04, 0x08,  0x48, 0x54, 0x54, 0x54, 0x24,
+    0x04, 0x04, 0x3F, 0x44, 0x24,  0x3C, 0x40, 0x40, 0x20, 0x7C,  0x1C, 0x20, 0x40, 0x20, 0x1C,
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  0x44, 0x28, 0x10, 0x28, 0x44,  0x4C, 0x90, 0x90, 0x90, 0x7C,
+    0x44, 0x64, 0x54, 0x4C, 0x44,  0x00, 0x08, 0x36, 0x41, 0x00,  0x00, 0x00, 0x77, 0x00, 0x00,
+    0x00, 0x41, 0x36, 0x08, 0x00,  0x02, 0x01, 0x02, 0x04, 0x02,
+]
+
+
+def load_font(path):
+    """从glcdfont.h读取完整256字符表，返回{字符码: 5列}"""
+    if path is None:
+        return {0x20 + i: BUILTIN_FONT[i * 5:i * 5 + 5] for i in range(len(BUILTIN_FONT) // 5)}
+
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index("{", text.index("font")) + 1:text.index("};")]
+    values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+    return {c: values[c * 5:c * 5 + 5] for c in range(len(values) // 5)}
+
+
+def rasterize(columns, size):
+    """放大一个字形：6x8单元（含右侧间隔列）× size"""
+    width, height = 6 * size, 8 * size
+    stride = (width + 7) // 8
+    out = bytearray(stride * height)
+    for col in range(6):
+        line = columns[col] if col < 5 else 0
+        for row in range(8):
+            if not (line >> row) & 1:
+                continue
+            for dy in range(size):
+                y = row * size + dy
+                for dx in range(size):
+                    x = col * size + dx
+                    out[y * stride + x // 8] |= 0x80 >> (x % 8)
+    return width, height, bytes(out)
+
+
+def charset(size):
+    chars = set()
+    for s in SIZE_STRINGS[size]:
+        chars.update(s)
+    return "".join(sorted(chars))
+
+
+def c_string(s):
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--font", help="Arduino_GFX glcdfont.h path")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    font = load_font(args.font)
+
+    lines = [
+        "/*",
+        " * Glyph Atlas - 预渲染字形表",
+        " * 由 tools/gen_glyph_atlas.py 生成，请勿手动修改",
+        " */",
+        "",
+        "#ifndef GLYPH_ATLAS_H",
+        "#define GLYPH_ATLAS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "#define GLYPH_NONE  0xFF",
+        "",
+        "struct GlyphSet {",
+        "    uint8_t size;               // setTextSize倍数",
+        "    uint8_t width;              // 字形宽度（像素，含间隔列）",
+        "    uint8_t height;             // 字形高度（像素）",
+        "    uint8_t bytesPerGlyph;      // 每个字形的位图字节数",
+        "    const uint8_t* index;       // ASCII 0x20-0x7E -> 字形序号",
+        "    const uint8_t* bitmaps;     // 1bpp位图，逐行高位在前",
+        "};",
+        "",
+    ]
+
+    sets = []
+    for size in sorted(SIZE_STRINGS):
+        chars = charset(size)
+        index = [0xFF] * 95
+        data = bytearray()
+        width = height = per_glyph = 0
+        for i, ch in enumerate(chars):
+            width, height, bitmap = rasterize(font[ord(ch)], size)
+            per_glyph = len(bitmap)
+            index[ord(ch) - 0x20] = i
+            data += bitmap
+
+        lines.append("// %d号字：%d个字形，%dx%d像素，共%d字节" % (size, len(chars), width, height, len(data)))
+        lines.append("// %s" % chars.replace("\\", "\\\\"))
+        lines.append("static const uint8_t GLYPH_INDEX_%d[95] PROGMEM = {" % size)
+        for row in range(0, 95, 16):
+            lines.append("    " + ", ".join("0x%02X" % v for v in index[row:row + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+        lines.append("static const uint8_t GLYPH_BITMAPS_%d[] PROGMEM = {" % size)
+        for row in range(0, len(data), per_glyph):
+            chunk = data[row:row + per_glyph]
+            lines.append("    " + ", ".join("0x%02X" % v for v in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+        sets.append((size, width, height, per_glyph))
+
+    lines.append("static const GlyphSet GLYPH_SETS[] = {")
+    for size, width, height, per_glyph in sets:
+        lines.append("    { %d, %d, %d, %d, GLYPH_INDEX_%d, GLYPH_BITMAPS_%d }," %
+                     (size, width, height, per_glyph, size, size))
+    lines.append("};")
+    lines.append("")
+    lines.append("#define GLYPH_SET_COUNT  %d" % len(sets))
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+    print("wrote %s" % os.path.normpath(args.output))
+
+
+if __name__ == "__main__":
+    main()
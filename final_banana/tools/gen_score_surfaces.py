@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Score surface generator - 温湿度评分面生成器
+
+按 fruit_profiles.csv 为每种水果算一张 温度×湿度 的环境评分网格
+（定点模型里初始分减去温度、湿度扣分的部分），写入
+score_surface_table.h。设备端对网格做双线性插值，再减去气体和时间扣分。
+
+环境评分是 |温度-最佳点| 和 |湿度-最佳点| 的线性和，只要最佳点落在网格
+节点上，每个格子里都是线性的，双线性插值和定点公式逐位相同。
+生成时检查这一点，不满足就报错（改网格步长或CSV）。
+
+用法：
+    python3 gen_score_surfaces.py            # 重新生成头文件
+    python3 gen_score_surfaces.py --check    # 只检查头文件是否和CSV一致（主机构建用）
+"""
+
+import argparse
+import os
+import sys
+
+sys.dont_write_bytecode = True
+from gen_fruit_profiles import DEFAULT_INPUT, HERE, load, scaled
+
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "Arduino", "FruitMonitor_2Buttons", "score_surface_table.h")
+
+# 网格（0.1°C、0.1%为单位）：-10..50°C 每1°C，0..100% 每2.5%
+TEMP_MIN_X10 = -100
+TEMP_STEP_X10 = 10
+TEMP_NODES = 61
+HUMIDITY_STEP_X10 = 25
+HUMIDITY_NODES = 41
+
+# 节点值单位：0.005分（50个0.0001分），int16放得下±163分
+UNIT_E4 = 50
+INT16_MIN = -32768
+INT16_MAX = 32767
+
+
+def condition_e4(fruit, temp_x10, humidity_x10):
+    """和 conditionScoreFixed<F>() 相同的公式（0.0001分，气体为0）"""
+    temp_sum = scaled(fruit["min_temp"], 10) + scaled(fruit["max_temp"], 10)
+    hum_sum = scaled(fruit["min_humidity"], 10) + scaled(fruit["max_humidity"], 10)
+    return (scaled(fruit["initial_score"], 10000)
+            - abs(2 * temp_x10 - temp_sum) * scaled(fruit["temp_decay"], 100) * 5
+            - abs(2 * humidity_x10 - hum_sum) * scaled(fruit["humid_decay"], 100) * 5)
+
+
+def surface(fruit):
+    temp_sum = scaled(fruit["min_temp"], 10) + scaled(fruit["max_temp"], 10)
+    hum_sum = scaled(fruit["min_humidity"], 10) + scaled(fruit["max_humidity"], 10)
+    if temp_sum % (2 * TEMP_STEP_X10) or hum_sum % (2 * HUMIDITY_STEP_X10):
+        sys.exit("%s: optimal point is not on a grid node, the surface would not be exact" % fruit["id"])
+
+    exact = []
+    for i in range(TEMP_NODES):
+        row = []
+        for j in range(HUMIDITY_NODES):
+            value = condition_e4(fruit, TEMP_MIN_X10 + i * TEMP_STEP_X10, j * HUMIDITY_STEP_X10)
+            if value % UNIT_E4:
+                sys.exit("%s: node value %d is not a multiple of %d" % (fruit["id"], value, UNIT_E4))
+            row.append(value // UNIT_E4)
+        exact.append(row)
+
+    # 太低的节点截到int16下限：只要所在格子的节点全是负分，插值结果仍然是负分，最终评分同样是0
+    nodes = [[max(INT16_MIN, v) for v in row] for row in exact]
+    for i in range(TEMP_NODES - 1):
+        for j in range(HUMIDITY_NODES - 1):
+            cell = [nodes[i][j], nodes[i + 1][j], nodes[i][j + 1], nodes[i + 1][j + 1]]
+            if min(cell) == INT16_MIN and max(cell) >= 0:
+                sys.exit("%s: clamped cell at node (%d, %d) crosses zero" % (fruit["id"], i, j))
+    if max(max(row) for row in nodes) > INT16_MAX:
+        sys.exit("%s: node value exceeds int16" % fruit["id"])
+    return nodes
+
+
+def render(fruits, source):
+    lines = [
+        "/*",
+        " * Score Surface Table - 温湿度评分面",
+        " * 由 tools/gen_score_surfaces.py 根据 tools/%s 生成，请勿手动修改" % source,
+        " */",
+        "",
+        "#ifndef SCORE_SURFACE_TABLE_H",
+        "#define SCORE_SURFACE_TABLE_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "#define SURFACE_FRUIT_COUNT         %d" % len(fruits),
+        "#define SURFACE_TEMP_MIN_X10        %-6d// 网格起点 (0.1°C)" % TEMP_MIN_X10,
+        "#define SURFACE_TEMP_STEP_X10       %-6d// 温度步长 (0.1°C)" % TEMP_STEP_X10,
+        "#define SURFACE_TEMP_NODES          %d" % TEMP_NODES,
+        "#define SURFACE_HUMIDITY_STEP_X10   %-6d// 湿度步长 (0.1%%)，从0%%开始" % HUMIDITY_STEP_X10,
+        "#define SURFACE_HUMIDITY_NODES      %d" % HUMIDITY_NODES,
+        "#define SURFACE_UNIT_E4             %-6d// 节点值单位 (0.0001分)" % UNIT_E4,
+        "",
+        "// 每种水果一张网格，按温度行、湿度列存放（%d字节/种）" % (TEMP_NODES * HUMIDITY_NODES * 2),
+        "static const int16_t SCORE_SURFACES[SURFACE_FRUIT_COUNT][SURFACE_TEMP_NODES * SURFACE_HUMIDITY_NODES] PROGMEM = {",
+    ]
+    for fruit in fruits:
+        lines.append("    {   // %s" % fruit["name"])
+        for i, row in enumerate(surface(fruit)):
+            lines.append("        // %d°C" % ((TEMP_MIN_X10 + i * TEMP_STEP_X10) // 10))
+            for k in range(0, len(row), 14):
+                lines.append("        " + ", ".join("%d" % v for v in row[k:k + 14]) + ",")
+        lines.append("    },")
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("-i", "--input", default=DEFAULT_INPUT)
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    parser.add_argument("--check", action="store_true",
+                        help="compare with the existing header instead of writing it")
+    args = parser.parse_args()
+
+    text = render(load(args.input), os.path.basename(args.input))
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except IOError:
+            current = None
+        if current != text:
+            sys.exit("%s is out of date, run tools/gen_score_surfaces.py" % os.path.normpath(args.output))
+        print("%s is up to date" % os.path.normpath(args.output))
+        return
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("wrote %s" % os.path.normpath(args.output))
+
+
+if __name__ == "__main__":
+    main()